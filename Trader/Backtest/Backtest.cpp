@@ -0,0 +1,132 @@
+#include <chrono>
+
+#include "Trader/Backtest/Backtest.hpp"
+
+IRSTD_TOPIC_USE_ALIAS(TraderBacktest, Trader, Backtest);
+
+namespace
+{
+	/**
+	 * Minimal replayed time between 2 processing of the strategy
+	 */
+	uint64_t getTriggerPeriodMs(const Trader::ConfigurationStrategy::Trigger trigger)
+	{
+		switch (trigger)
+		{
+		case Trader::ConfigurationStrategy::Trigger::ON_RATE_CHANGE:
+			return 0;
+		case Trader::ConfigurationStrategy::Trigger::EVERY_SECOND:
+			return 1000;
+		case Trader::ConfigurationStrategy::Trigger::EVERY_MINUTE:
+			return 60 * 1000;
+		case Trader::ConfigurationStrategy::Trigger::EVERY_HOUR:
+			return 60 * 60 * 1000;
+		case Trader::ConfigurationStrategy::Trigger::EVERY_DAY:
+			return 24 * 60 * 60 * 1000;
+		default:
+			IRSTD_UNREACHABLE(TraderBacktest);
+		}
+		return 0;
+	}
+}
+
+// ---- Trader::Backtest::Report ----------------------------------------------
+
+IrStd::Type::Decimal Trader::Backtest::Report::getProfit() const noexcept
+{
+	return m_finalEstimate - m_initialEstimate;
+}
+
+double Trader::Backtest::Report::getTicksPerSecond() const noexcept
+{
+	return (m_durationMs) ? (m_nbTicks * 1000. / m_durationMs) : static_cast<double>(m_nbTicks);
+}
+
+void Trader::Backtest::Report::toStream(std::ostream& out) const
+{
+	out << "Backtest of " << m_strategyId << ": " << m_nbTicks << " tick(s) replayed in "
+			<< m_durationMs << "ms (" << static_cast<uint64_t>(getTicksPerSecond()) << " ticks/s), "
+			<< m_nbProcess << " process call(s), history [" << m_firstTimestamp << ", "
+			<< m_lastTimestamp << "], estimate " << m_initialEstimate << " -> " << m_finalEstimate
+			<< " " << m_estimateCurrency << " (profit: " << std::showpos << getProfit()
+			<< std::noshowpos << " " << m_estimateCurrency << ")";
+}
+
+std::ostream& operator<<(std::ostream& os, const Trader::Backtest::Report& report)
+{
+	report.toStream(os);
+	return os;
+}
+
+// ---- Trader::Backtest ------------------------------------------------------
+
+Trader::Backtest::Backtest(
+		std::shared_ptr<const RateHistory> pHistory,
+		const IrStd::Type::Decimal feePercent,
+		const IrStd::Type::Decimal initialBalanceValue)
+		: m_pHistory(pHistory)
+		, m_feePercent(feePercent)
+		, m_initialBalanceValue(initialBalanceValue)
+{
+	IRSTD_THROW_ASSERT(TraderBacktest, m_pHistory, "A rate history must be provided");
+}
+
+Trader::Backtest::Report Trader::Backtest::run(Strategy& strategy)
+{
+	IRSTD_THROW_ASSERT(TraderBacktest, !m_pHistory->getTicks().empty(), "The rate history is empty");
+
+	auto pExchange = std::make_shared<ExchangeBacktest>(m_pHistory, m_feePercent, m_initialBalanceValue);
+	pExchange->connectSynchronous();
+
+	// Simulated fills and profits must not end up in the live records
+	strategy.setRecordDirectory("");
+	strategy.setup(pExchange);
+	strategy.initialize();
+
+	Report report;
+	report.m_strategyId = strategy.getId();
+	report.m_nbProcess = 0;
+	report.m_firstTimestamp = m_pHistory->getFirstTimestamp();
+	report.m_lastTimestamp = m_pHistory->getLastTimestamp();
+	report.m_estimateCurrency = pExchange->getEstimateCurrency();
+	report.m_initialEstimate = pExchange->getEstimate();
+
+	const uint64_t triggerPeriodMs = ::getTriggerPeriodMs(strategy.getConfiguration().getTrigger());
+	const uint64_t orderPollingPeriodMs = pExchange->getConfiguration().getOrderPollingPeriodMs();
+	IrStd::Type::Timestamp lastProcessedTimestamp = 0;
+	IrStd::Type::Timestamp lastPolledTimestamp = pExchange->getReplayTimestamp();
+
+	const auto start = std::chrono::steady_clock::now();
+	while (!pExchange->isCompleted())
+	{
+		pExchange->stepRates();
+		const auto timestamp = pExchange->getReplayTimestamp();
+
+		// Orders and balance are polled periodically, like a real exchange
+		if (static_cast<uint64_t>(timestamp - lastPolledTimestamp) >= orderPollingPeriodMs)
+		{
+			pExchange->stepBalanceAndOrders();
+			lastPolledTimestamp = timestamp;
+		}
+
+		if (!lastProcessedTimestamp || static_cast<uint64_t>(timestamp - lastProcessedTimestamp) >= triggerPeriodMs)
+		{
+			strategy.process(++report.m_nbProcess);
+			lastProcessedTimestamp = timestamp;
+		}
+	}
+
+	// Settle the last orders
+	pExchange->stepBalanceAndOrders();
+
+	report.m_durationMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::steady_clock::now() - start).count();
+	report.m_nbTicks = pExchange->getNbTicksReplayed();
+	report.m_finalEstimate = pExchange->getEstimate();
+
+	pExchange->stop();
+
+	IRSTD_LOG_INFO(TraderBacktest, report);
+
+	return report;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <ostream>
+
+#include "Trader/Backtest/RateHistory.hpp"
+#include "Trader/ExchangeImpl/Backtest/ExchangeBacktest.hpp"
+#include "Trader/Strategy/Strategy.hpp"
+
+namespace Trader
+{
+	/**
+	 * Run a strategy against recorded rates, as fast as possible.
+	 * Everything runs from the calling thread and the strategy trigger
+	 * follows the replayed time, hence the same history always gives
+	 * the same result.
+	 */
+	class Backtest
+	{
+	public:
+		/**
+		 * Outcome of a run
+		 */
+		struct Report
+		{
+			Id m_strategyId;
+			size_t m_nbTicks;
+			size_t m_nbProcess;
+			uint64_t m_durationMs;
+			IrStd::Type::Timestamp m_firstTimestamp;
+			IrStd::Type::Timestamp m_lastTimestamp;
+			CurrencyPtr m_estimateCurrency;
+			IrStd::Type::Decimal m_initialEstimate;
+			IrStd::Type::Decimal m_finalEstimate;
+
+			/**
+			 * Profit (or loss) in the estimate currency
+			 */
+			IrStd::Type::Decimal getProfit() const noexcept;
+
+			/**
+			 * Number of ticks replayed per second of wall time
+			 */
+			double getTicksPerSecond() const noexcept;
+
+			void toStream(std::ostream& out) const;
+		};
+
+		explicit Backtest(std::shared_ptr<const RateHistory> pHistory,
+				const IrStd::Type::Decimal feePercent = ExchangeBacktest::FEE_PERCENT,
+				const IrStd::Type::Decimal initialBalanceValue = ExchangeBacktest::INITIAL_BALANCE_VALUE);
+
+		/**
+		 * Create a strategy of type \p T and run it
+		 */
+		template<class T>
+		Report run(const IrStd::Type::Gson::Map& config = {})
+		{
+			T strategy(config);
+			return run(strategy);
+		}
+
+		/**
+		 * Replay the whole history with \p strategy on a fresh exchange.
+		 * The strategy must not be attached to any other exchange.
+		 */
+		Report run(Strategy& strategy);
+
+	private:
+		std::shared_ptr<const RateHistory> m_pHistory;
+		const IrStd::Type::Decimal m_feePercent;
+		const IrStd::Type::Decimal m_initialBalanceValue;
+	};
+}
+
+std::ostream& operator<<(std::ostream& os, const Trader::Backtest::Report& report);
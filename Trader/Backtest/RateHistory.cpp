@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <dirent.h>
+
+#include "Trader/Backtest/RateHistory.hpp"
+
+IRSTD_TOPIC_REGISTER(Trader, Backtest);
+IRSTD_TOPIC_USE_ALIAS(TraderBacktest, Trader, Backtest);
+
+namespace
+{
+	/**
+	 * Extract the currencies from a file name formated as pair-X-Y.csv
+	 */
+	bool parseFileName(const char* const pName, Trader::CurrencyPtr& initialCurrency,
+			Trader::CurrencyPtr& finalCurrency)
+	{
+		static const char PREFIX[] = "pair-";
+		static const char SUFFIX[] = ".csv";
+		const size_t length = std::strlen(pName);
+		if (length <= sizeof(PREFIX) + sizeof(SUFFIX) - 2
+				|| std::strncmp(pName, PREFIX, sizeof(PREFIX) - 1)
+				|| std::strcmp(pName + length - sizeof(SUFFIX) + 1, SUFFIX))
+		{
+			return false;
+		}
+
+		const std::string ticker(pName + sizeof(PREFIX) - 1, length - sizeof(PREFIX) - sizeof(SUFFIX) + 2);
+		if (ticker.find('-') == std::string::npos)
+		{
+			return false;
+		}
+		const auto currencyPair = Trader::Currency::tickerToCurrency(ticker.c_str(), '-');
+		initialCurrency = currencyPair.first;
+		finalCurrency = currencyPair.second;
+		return (initialCurrency && finalCurrency);
+	}
+}
+
+// ---- Trader::RateHistory ---------------------------------------------------
+
+Trader::RateHistory::RateHistory(const std::string& directory)
+{
+	std::vector<std::string> fileNameList;
+	{
+		DIR* const pDir = ::opendir(directory.c_str());
+		IRSTD_THROW_ASSERT(TraderBacktest, pDir, "Cannot open directory '" << directory << "'");
+		while (const struct dirent* const pEntry = ::readdir(pDir))
+		{
+			fileNameList.push_back(pEntry->d_name);
+		}
+		::closedir(pDir);
+	}
+
+	// Sort the files to ensure that the timeline is always built the same way
+	std::sort(fileNameList.begin(), fileNameList.end());
+
+	for (const auto& fileName : fileNameList)
+	{
+		CurrencyPtr initialCurrency;
+		CurrencyPtr finalCurrency;
+		if (::parseFileName(fileName.c_str(), initialCurrency, finalCurrency))
+		{
+			std::string filePath(directory);
+			IrStd::FileSystem::append(filePath, fileName.c_str());
+			load(filePath, initialCurrency, finalCurrency);
+		}
+	}
+
+	// Merge all pairs into a single timeline, stable to keep the file order for equal timestamps
+	std::stable_sort(m_tickList.begin(), m_tickList.end(), [](const Tick& tick1, const Tick& tick2) {
+		return tick1.m_timestamp < tick2.m_timestamp;
+	});
+
+	IRSTD_LOG_INFO(TraderBacktest, "Loaded " << m_tickList.size() << " tick(s) for "
+			<< m_pairList.size() << " pair(s) from '" << directory << "'");
+}
+
+void Trader::RateHistory::load(
+		const std::string& filePath,
+		const CurrencyPtr initialCurrency,
+		const CurrencyPtr finalCurrency)
+{
+	// Look for the pair, in one direction or the other
+	size_t pairIndex = 0;
+	bool isInverted = false;
+	for (; pairIndex < m_pairList.size(); ++pairIndex)
+	{
+		const auto& pair = m_pairList[pairIndex];
+		if (pair.m_initialCurrency == initialCurrency && pair.m_finalCurrency == finalCurrency)
+		{
+			break;
+		}
+		if (pair.m_initialCurrency == finalCurrency && pair.m_finalCurrency == initialCurrency)
+		{
+			isInverted = true;
+			break;
+		}
+	}
+	if (pairIndex == m_pairList.size())
+	{
+		m_pairList.push_back(Pair{initialCurrency, finalCurrency, false, false});
+	}
+
+	std::ifstream file(filePath);
+	IRSTD_THROW_ASSERT(TraderBacktest, file.good(), "Cannot open '" << filePath << "'");
+
+	size_t nbTicks = 0;
+	std::string line;
+	while (std::getline(file, line))
+	{
+		// Each line is formated as: timestamp,rate
+		const char* const pLine = line.c_str();
+		char* pEnd = nullptr;
+		const uint64_t timestamp = std::strtoull(pLine, &pEnd, 10);
+		if (pEnd == pLine || (*pEnd != ',' && *pEnd != ';'))
+		{
+			continue;
+		}
+		const char* const pRate = pEnd + 1;
+		const double rate = std::strtod(pRate, &pEnd);
+		if (pEnd == pRate || rate <= 0)
+		{
+			continue;
+		}
+		m_tickList.push_back(Tick{IrStd::Type::Timestamp(timestamp), pairIndex, isInverted, rate});
+		nbTicks++;
+	}
+
+	if (nbTicks)
+	{
+		auto& pair = m_pairList[pairIndex];
+		((isInverted) ? pair.m_isInvertedRecorded : pair.m_isRecorded) = true;
+	}
+
+	IRSTD_LOG_DEBUG(TraderBacktest, "Loaded " << nbTicks << " tick(s) from '" << filePath << "'");
+}
+
+const std::vector<Trader::RateHistory::Pair>& Trader::RateHistory::getPairs() const noexcept
+{
+	return m_pairList;
+}
+
+const std::vector<Trader::RateHistory::Tick>& Trader::RateHistory::getTicks() const noexcept
+{
+	return m_tickList;
+}
+
+IrStd::Type::Timestamp Trader::RateHistory::getFirstTimestamp() const noexcept
+{
+	return (m_tickList.empty()) ? IrStd::Type::Timestamp(0) : m_tickList.front().m_timestamp;
+}
+
+IrStd::Type::Timestamp Trader::RateHistory::getLastTimestamp() const noexcept
+{
+	return (m_tickList.empty()) ? IrStd::Type::Timestamp(0) : m_tickList.back().m_timestamp;
+}
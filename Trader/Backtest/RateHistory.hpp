@@ -0,0 +1,67 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "IrStd/IrStd.hpp"
+
+#include "Trader/Exchange/Currency/Currency.hpp"
+
+IRSTD_TOPIC_USE(Trader, Backtest);
+
+namespace Trader
+{
+	/**
+	 * Rates recorded by the exchange rates recorder (pair-X-Y.csv files),
+	 * merged into a single timeline. This is read-only once loaded and
+	 * can be shared between several backtests.
+	 */
+	class RateHistory
+	{
+	public:
+		/**
+		 * A recorded pair, the direction is given as recorded,
+		 * pairs are registered once even if both directions are recorded.
+		 */
+		struct Pair
+		{
+			CurrencyPtr m_initialCurrency;
+			CurrencyPtr m_finalCurrency;
+			/// Tells which directions have been recorded
+			bool m_isRecorded;
+			bool m_isInvertedRecorded;
+		};
+
+		/**
+		 * A single rate change of a pair
+		 */
+		struct Tick
+		{
+			IrStd::Type::Timestamp m_timestamp;
+			size_t m_pairIndex;
+			/// Set if the rate is recorded for the inverted pair
+			bool m_isInverted;
+			IrStd::Type::Decimal m_rate;
+		};
+
+		/**
+		 * Load all the pair-X-Y.csv files from \p directory
+		 */
+		explicit RateHistory(const std::string& directory);
+
+		const std::vector<Pair>& getPairs() const noexcept;
+		const std::vector<Tick>& getTicks() const noexcept;
+
+		/**
+		 * Timestamps of the first and last tick, 0 if empty
+		 */
+		IrStd::Type::Timestamp getFirstTimestamp() const noexcept;
+		IrStd::Type::Timestamp getLastTimestamp() const noexcept;
+
+	private:
+		void load(const std::string& filePath, const CurrencyPtr initialCurrency, const CurrencyPtr finalCurrency);
+
+		std::vector<Pair> m_pairList;
+		std::vector<Tick> m_tickList;
+	};
+}
@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <random>
+#include <thread>
+
+#include "Trader/Backtest/Sweep.hpp"
+
+IRSTD_TOPIC_USE_ALIAS(TraderBacktest, Trader, Backtest);
+
+// ---- Trader::Sweep ---------------------------------------------------------
+
+Trader::Sweep::Sweep(
+		std::shared_ptr<const RateHistory> pHistory,
+		const size_t nbThreads,
+		const IrStd::Type::Decimal feePercent,
+		const IrStd::Type::Decimal initialBalanceValue)
+		: m_pHistory(pHistory)
+		, m_nbThreads((nbThreads) ? nbThreads : std::max<size_t>(std::thread::hardware_concurrency(), 1))
+		, m_feePercent(feePercent)
+		, m_initialBalanceValue(initialBalanceValue)
+{
+	IRSTD_THROW_ASSERT(TraderBacktest, m_pHistory, "A rate history must be provided");
+}
+
+void Trader::Sweep::addParameter(
+		const std::string& key,
+		const std::vector<double>& valueList)
+{
+	IRSTD_THROW_ASSERT(TraderBacktest, !valueList.empty(), "No value set for the parameter '" << key << "'");
+	m_parameterList.push_back(Parameter{key, valueList, /*isRange*/false, 0, 0});
+}
+
+void Trader::Sweep::addParameter(
+		const std::string& key,
+		const double min,
+		const double max,
+		const size_t nbSteps)
+{
+	IRSTD_THROW_ASSERT(TraderBacktest, min <= max && nbSteps,
+			"Invalid range for the parameter '" << key << "'");
+	std::vector<double> valueList;
+	for (size_t i = 0; i < nbSteps; ++i)
+	{
+		valueList.push_back((nbSteps == 1) ? min : min + (max - min) * i / (nbSteps - 1));
+	}
+	m_parameterList.push_back(Parameter{key, std::move(valueList), /*isRange*/true, min, max});
+}
+
+std::vector<Trader::Sweep::ParameterSet> Trader::Sweep::generateGrid() const
+{
+	std::vector<ParameterSet> parameterSetList{ParameterSet()};
+	for (const auto& parameter : m_parameterList)
+	{
+		std::vector<ParameterSet> nextParameterSetList;
+		for (const auto& parameterSet : parameterSetList)
+		{
+			for (const auto value : parameter.m_valueList)
+			{
+				nextParameterSetList.push_back(parameterSet);
+				nextParameterSetList.back().push_back({parameter.m_key, value});
+			}
+		}
+		parameterSetList = std::move(nextParameterSetList);
+	}
+	return parameterSetList;
+}
+
+std::vector<Trader::Sweep::ParameterSet> Trader::Sweep::generateRandom(
+		const size_t nbSamples,
+		const uint64_t seed) const
+{
+	// Seeded generator, to be able to reproduce a search
+	std::mt19937_64 generator(seed);
+	std::vector<ParameterSet> parameterSetList(nbSamples);
+	for (auto& parameterSet : parameterSetList)
+	{
+		for (const auto& parameter : m_parameterList)
+		{
+			double value;
+			if (parameter.m_isRange)
+			{
+				value = std::uniform_real_distribution<double>(parameter.m_min, parameter.m_max)(generator);
+			}
+			else
+			{
+				const auto index = std::uniform_int_distribution<size_t>(0, parameter.m_valueList.size() - 1)(generator);
+				value = parameter.m_valueList[index];
+			}
+			parameterSet.push_back({parameter.m_key, value});
+		}
+	}
+	return parameterSetList;
+}
+
+std::vector<Trader::Sweep::Result> Trader::Sweep::run(
+		const Runner& runner,
+		const std::vector<ParameterSet>& parameterSetList) const
+{
+	IRSTD_LOG_INFO(TraderBacktest, "Sweeping " << parameterSetList.size()
+			<< " configuration(s) over " << m_nbThreads << " thread(s)");
+
+	std::vector<Result> resultList(parameterSetList.size());
+	// Not a vector<bool>, as each entry is written by a different thread
+	std::vector<char> isValidList(parameterSetList.size(), false);
+	std::atomic<size_t> nextIndex(0);
+
+	// Each worker picks the next configuration to run until all are done
+	const auto worker = [&]() {
+		Backtest backtest(m_pHistory, m_feePercent, m_initialBalanceValue);
+		for (size_t index = nextIndex++; index < parameterSetList.size(); index = nextIndex++)
+		{
+			const auto& parameterSet = parameterSetList[index];
+			IrStd::Type::Gson::Map config;
+			for (const auto& parameter : parameterSet)
+			{
+				config[parameter.first] = parameter.second;
+			}
+
+			try
+			{
+				resultList[index].m_report = runner(backtest, config);
+				resultList[index].m_parameterSet = parameterSet;
+				isValidList[index] = true;
+			}
+			catch (const IrStd::Exception& e)
+			{
+				IRSTD_LOG_ERROR(TraderBacktest, "Backtest #" << index << " failed: " << e << ", ignore.");
+			}
+			catch (...)
+			{
+				IRSTD_LOG_ERROR(TraderBacktest, "Backtest #" << index << " failed with an unknown error, ignore.");
+			}
+		}
+	};
+
+	{
+		std::vector<std::thread> threadList;
+		for (size_t i = 1; i < std::min(m_nbThreads, parameterSetList.size()); ++i)
+		{
+			threadList.emplace_back(worker);
+		}
+		// The current thread is also part of the pool
+		worker();
+		for (auto& thread : threadList)
+		{
+			thread.join();
+		}
+	}
+
+	// Remove failed runs and rank the others by profit
+	{
+		size_t index = 0;
+		resultList.erase(std::remove_if(resultList.begin(), resultList.end(), [&](const Result&) {
+			return !isValidList[index++];
+		}), resultList.end());
+	}
+	std::stable_sort(resultList.begin(), resultList.end(), [](const Result& result1, const Result& result2) {
+		return result1.m_report.getProfit() > result2.m_report.getProfit();
+	});
+
+	return resultList;
+}
+
+void Trader::Sweep::toStreamReport(
+		std::ostream& out,
+		const std::vector<Result>& resultList)
+{
+	constexpr size_t CELL_WIDTH = 15;
+
+	out << std::left << std::setw(6) << "Rank" << std::setw(CELL_WIDTH) << "Profit"
+			<< std::setw(CELL_WIDTH) << "Estimate" << std::setw(CELL_WIDTH) << "Process"
+			<< std::setw(CELL_WIDTH) << "Ticks/s" << "Parameters" << std::endl;
+
+	size_t rank = 0;
+	for (const auto& result : resultList)
+	{
+		const auto& report = result.m_report;
+		out << std::setw(6) << ++rank << std::setw(CELL_WIDTH) << report.getProfit()
+				<< std::setw(CELL_WIDTH) << report.m_finalEstimate << std::setw(CELL_WIDTH) << report.m_nbProcess
+				<< std::setw(CELL_WIDTH) << static_cast<uint64_t>(report.getTicksPerSecond());
+		for (const auto& parameter : result.m_parameterSet)
+		{
+			out << parameter.first << "=" << parameter.second << " ";
+		}
+		out << std::endl;
+	}
+	out << std::right;
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Trader/Backtest/Backtest.hpp"
+
+namespace Trader
+{
+	/**
+	 * Search the configuration of a strategy giving the best profit.
+	 * Each configuration is backtested on its own exchange, all runs are
+	 * spread over a pool of threads and share the same read-only rate history.
+	 */
+	class Sweep
+	{
+	public:
+		typedef std::vector<std::pair<std::string, double>> ParameterSet;
+
+		/**
+		 * Outcome of a single configuration
+		 */
+		struct Result
+		{
+			ParameterSet m_parameterSet;
+			Backtest::Report m_report;
+		};
+
+		/**
+		 * \param nbThreads Number of backtests to run in parallel, 0 to use all cores
+		 */
+		explicit Sweep(std::shared_ptr<const RateHistory> pHistory, const size_t nbThreads = 0,
+				const IrStd::Type::Decimal feePercent = ExchangeBacktest::FEE_PERCENT,
+				const IrStd::Type::Decimal initialBalanceValue = ExchangeBacktest::INITIAL_BALANCE_VALUE);
+
+		/**
+		 * Add a configuration key to the search, with its possible values
+		 */
+		void addParameter(const std::string& key, const std::vector<double>& valueList);
+
+		/**
+		 * Add a configuration key to the search, within [min; max].
+		 * A grid search uses \p nbSteps evenly spaced values, a random search
+		 * picks any value of the range.
+		 */
+		void addParameter(const std::string& key, const double min, const double max, const size_t nbSteps);
+
+		/**
+		 * Backtest every combination of the parameters
+		 */
+		template<class T>
+		std::vector<Result> runGrid()
+		{
+			return run(createRunner<T>(), generateGrid());
+		}
+
+		/**
+		 * Backtest \p nbSamples random combinations of the parameters
+		 */
+		template<class T>
+		std::vector<Result> runRandom(const size_t nbSamples, const uint64_t seed = 0)
+		{
+			return run(createRunner<T>(), generateRandom(nbSamples, seed));
+		}
+
+		/**
+		 * Print the results, they are expected to be ranked already
+		 */
+		static void toStreamReport(std::ostream& out, const std::vector<Result>& resultList);
+
+	private:
+		typedef std::function<Backtest::Report(Backtest&, const IrStd::Type::Gson::Map&)> Runner;
+
+		template<class T>
+		static Runner createRunner()
+		{
+			return [](Backtest& backtest, const IrStd::Type::Gson::Map& config) {
+				return backtest.run<T>(config);
+			};
+		}
+
+		/**
+		 * Run all the sets of parameters and rank them by profit
+		 */
+		std::vector<Result> run(const Runner& runner, const std::vector<ParameterSet>& parameterSetList) const;
+
+		std::vector<ParameterSet> generateGrid() const;
+		std::vector<ParameterSet> generateRandom(const size_t nbSamples, const uint64_t seed) const;
+
+		struct Parameter
+		{
+			std::string m_key;
+			std::vector<double> m_valueList;
+			// Set if the values are a sampling of a range
+			bool m_isRange;
+			double m_min;
+			double m_max;
+		};
+
+		std::shared_ptr<const RateHistory> m_pHistory;
+		const size_t m_nbThreads;
+		const IrStd::Type::Decimal m_feePercent;
+		const IrStd::Type::Decimal m_initialBalanceValue;
+		std::vector<Parameter> m_parameterList;
+	};
+}
@@ -1,3 +1,5 @@
+#include <thread>
+
 #include "Trader/Exchange/Balance/Balance.hpp"
 #include "Trader/Exchange/Exchange.hpp"
 
@@ -9,66 +11,152 @@ IRSTD_TOPIC_USE_ALIAS(TraderBalance, Trader, Balance);
 constexpr double Trader::Balance::INVALID_AMOUNT;
 
 Trader::Balance::Balance()
-		: m_pExchange(nullptr)
+		: m_sequence(0)
+		, m_pExchange(nullptr)
 		, m_initialEstimate(Trader::Balance::INVALID_AMOUNT)
 {
+	clear();
 }
 
 Trader::Balance::Balance(Exchange& exchange)
-		: m_pExchange(&exchange)
+		: m_sequence(0)
+		, m_pExchange(&exchange)
 		, m_initialEstimate(Trader::Balance::INVALID_AMOUNT)
 {
+	clear();
 }
 
 Trader::Balance::Balance(Balance&& rhs)
+		: Balance()
 {
 	*this = std::move(rhs);
 }
 
 Trader::Balance& Trader::Balance::operator=(Balance&& rhs)
 {
-	auto scope1 = m_lock.writeScope();
-	auto scope2 = rhs.m_lock.readScope();
+	Snapshot snapshot;
+	rhs.getSnapshot(snapshot);
+
+	{
+		std::lock_guard<std::mutex> lock(m_writeLock);
+		beginWriteNoLock();
+		for (size_t ordinal = 0; ordinal < Currency::NB_CURRENCIES; ++ordinal)
+		{
+			setFundNoLock(ordinal, snapshot.m_fundList[ordinal]);
+			setReservedFundNoLock(ordinal, snapshot.m_reservedFundList[ordinal]);
+		}
+		m_fundMask.store(snapshot.m_fundMask, std::memory_order_relaxed);
+		m_reservedFundMask.store(snapshot.m_reservedFundMask, std::memory_order_relaxed);
+		endWriteNoLock();
+	}
 
-	m_fundList = std::move(rhs.m_fundList);
-	m_reservedFundList = std::move(rhs.m_reservedFundList);
 	m_pExchange = rhs.m_pExchange;
 	m_initialEstimate = rhs.m_initialEstimate;
 
 	return *this;
 }
 
+// ---- Trader::Balance (seqlock) ---------------------------------------------
+
+void Trader::Balance::beginWriteNoLock() noexcept
+{
+	// Odd sequence, readers will wait and retry
+	m_sequence.fetch_add(1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+}
+
+void Trader::Balance::endWriteNoLock() noexcept
+{
+	m_sequence.fetch_add(1, std::memory_order_release);
+}
+
+template<class F>
+void Trader::Balance::readConsistent(const F& read) const noexcept
+{
+	while (true)
+	{
+		const auto sequence = m_sequence.load(std::memory_order_acquire);
+		// A writer is updating the balance
+		if (sequence & 1)
+		{
+			std::this_thread::yield();
+			continue;
+		}
+		read();
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (m_sequence.load(std::memory_order_relaxed) == sequence)
+		{
+			return;
+		}
+	}
+}
+
+void Trader::Balance::getSnapshot(Snapshot& snapshot) const noexcept
+{
+	readConsistent([&]() {
+		snapshot.m_fundMask = m_fundMask.load(std::memory_order_relaxed);
+		snapshot.m_reservedFundMask = m_reservedFundMask.load(std::memory_order_relaxed);
+		for (size_t ordinal = 0; ordinal < Currency::NB_CURRENCIES; ++ordinal)
+		{
+			snapshot.m_fundList[ordinal] = m_fundList[ordinal].load(std::memory_order_relaxed);
+			snapshot.m_reservedFundList[ordinal] = m_reservedFundList[ordinal].load(std::memory_order_relaxed);
+		}
+	});
+}
+
+void Trader::Balance::setFundNoLock(const size_t ordinal, const IrStd::Type::Decimal amount) noexcept
+{
+	m_fundList[ordinal].store(amount, std::memory_order_relaxed);
+}
+
+void Trader::Balance::setReservedFundNoLock(const size_t ordinal, const IrStd::Type::Decimal amount) noexcept
+{
+	m_reservedFundList[ordinal].store(amount, std::memory_order_relaxed);
+}
+
+// ---- Trader::Balance -------------------------------------------------------
+
 void Trader::Balance::compareFunds(
 		const Balance& balance,
 		const std::function<void(const CurrencyPtr, const IrStd::Type::Decimal)>& callback) const noexcept
 {
-	// Lock both balances for reading
-	auto scope1 = m_lock.readScope();
-	auto scope2 = balance.m_lock.readScope();
-
-	// Check currencies that are present in the current balance
-	getCurrencies([&](const CurrencyPtr currency) {
-		const auto diffAmount = balance.getWithReserve(currency) - getWithReserve(currency);
-		if (diffAmount)
+	Snapshot snapshot1;
+	Snapshot snapshot2;
+	getSnapshot(snapshot1);
+	balance.getSnapshot(snapshot2);
+
+	for (size_t ordinal = 0; ordinal < Currency::NB_CURRENCIES; ++ordinal)
+	{
+		// Check currencies that are present in the current balance
+		if (snapshot1.m_fundMask & getMask(ordinal))
 		{
-			callback(currency, diffAmount);
+			const auto diffAmount = snapshot2.m_fundList[ordinal] - snapshot1.m_fundList[ordinal];
+			if (diffAmount)
+			{
+				callback(Currency::fromOrdinal(ordinal), diffAmount);
+			}
 		}
-	});
-
-	// Check currencies that are only present in the second balance
-	balance.getCurrencies([&](const CurrencyPtr currency) {
-		if (m_fundList.find(currency) == m_fundList.end())
+		// Check currencies that are only present in the second balance
+		else if (snapshot2.m_fundMask & getMask(ordinal))
 		{
-			callback(currency, balance.getWithReserve(currency));
+			callback(Currency::fromOrdinal(ordinal), snapshot2.m_fundList[ordinal]);
 		}
-	});
+	}
 }
 
 void Trader::Balance::setFunds(const Balance& balance)
 {
-	auto scope1 = m_lock.writeScope();
-	auto scope2 = balance.m_lock.readScope();
-	m_fundList = balance.m_fundList;
+	Snapshot snapshot;
+	balance.getSnapshot(snapshot);
+
+	std::lock_guard<std::mutex> lock(m_writeLock);
+	beginWriteNoLock();
+	for (size_t ordinal = 0; ordinal < Currency::NB_CURRENCIES; ++ordinal)
+	{
+		setFundNoLock(ordinal, snapshot.m_fundList[ordinal]);
+	}
+	m_fundMask.store(snapshot.m_fundMask, std::memory_order_relaxed);
+	endWriteNoLock();
 }
 
 void Trader::Balance::setFundsAndUpdateReserve(
@@ -76,120 +164,170 @@ void Trader::Balance::setFundsAndUpdateReserve(
 		const Exchange& exchange,
 		const bool isBalanceincludeReserve)
 {
-	auto scope1 = m_lock.writeScope();
-	auto scope2 = balance.m_lock.readScope();
-	m_fundList = balance.m_fundList;
+	// Build the new content first, so that readers are not held
+	// while reading the reserve ledger
+	Snapshot snapshot;
+	balance.getSnapshot(snapshot);
+	snapshot.m_reservedFundMask = 0;
+	for (size_t ordinal = 0; ordinal < Currency::NB_CURRENCIES; ++ordinal)
+	{
+		snapshot.m_reservedFundList[ordinal] = 0;
+	}
 
 	// Update the money reserved
+	exchange.getTrackOrderList().eachReserve([&](const CurrencyPtr currency, const IrStd::Type::Decimal amount) {
+		const auto ordinal = currency->getOrdinal();
+		// If the balance does not include the reserve, add it
+		if (!isBalanceincludeReserve)
+		{
+			snapshot.m_fundList[ordinal] += amount;
+			snapshot.m_fundMask |= getMask(ordinal);
+		}
+		snapshot.m_reservedFundList[ordinal] += amount;
+		snapshot.m_reservedFundMask |= getMask(ordinal);
+	});
+
+	std::lock_guard<std::mutex> lock(m_writeLock);
+	beginWriteNoLock();
+	for (size_t ordinal = 0; ordinal < Currency::NB_CURRENCIES; ++ordinal)
 	{
-		m_reservedFundList.clear();
-		exchange.getTrackOrderList().each([&](const TrackOrder& track) {
-			const auto currency = track.getOrder().getInitialCurrency();
-			const auto amount = track.getAmount();
-			// If the balance does not include the reserve, add it
-			if (!isBalanceincludeReserve)
-			{
-				const auto currentAmount = getWithReserveNoLock(currency);
-				m_fundList[currency] = currentAmount + amount;
-			}
-			reserveNoLock(currency, amount);
-		});
+		setFundNoLock(ordinal, snapshot.m_fundList[ordinal]);
+		setReservedFundNoLock(ordinal, snapshot.m_reservedFundList[ordinal]);
 	}
+	m_fundMask.store(snapshot.m_fundMask, std::memory_order_relaxed);
+	m_reservedFundMask.store(snapshot.m_reservedFundMask, std::memory_order_relaxed);
+	endWriteNoLock();
 }
 
 void Trader::Balance::updateReserve(const Exchange& exchange)
 {
+	IrStd::Type::Decimal reservedFundList[Currency::NB_CURRENCIES];
+	uint64_t reservedFundMask = 0;
+	for (size_t ordinal = 0; ordinal < Currency::NB_CURRENCIES; ++ordinal)
 	{
-		auto scope = m_lock.writeScope();
-
-		m_reservedFundList.clear();
-		exchange.getTrackOrderList().each([&](const TrackOrder& track) {
-			const auto currency = track.getOrder().getInitialCurrency();
-			const auto amount = track.getAmount();
-			reserveNoLock(currency, amount);
-		});
+		reservedFundList[ordinal] = 0;
 	}
+
+	exchange.getTrackOrderList().eachReserve([&](const CurrencyPtr currency, const IrStd::Type::Decimal amount) {
+		const auto ordinal = currency->getOrdinal();
+		reservedFundList[ordinal] = amount;
+		reservedFundMask |= getMask(ordinal);
+	});
+
+	std::lock_guard<std::mutex> lock(m_writeLock);
+	beginWriteNoLock();
+	for (size_t ordinal = 0; ordinal < Currency::NB_CURRENCIES; ++ordinal)
+	{
+		setReservedFundNoLock(ordinal, reservedFundList[ordinal]);
+	}
+	m_reservedFundMask.store(reservedFundMask, std::memory_order_relaxed);
+	endWriteNoLock();
 }
 
 void Trader::Balance::clear() noexcept
 {
-	auto scope = m_lock.writeScope();
-	m_fundList.clear();
-	m_reservedFundList.clear();
+	std::lock_guard<std::mutex> lock(m_writeLock);
+	beginWriteNoLock();
+	for (size_t ordinal = 0; ordinal < Currency::NB_CURRENCIES; ++ordinal)
+	{
+		setFundNoLock(ordinal, 0);
+		setReservedFundNoLock(ordinal, 0);
+	}
+	m_fundMask.store(0, std::memory_order_relaxed);
+	m_reservedFundMask.store(0, std::memory_order_relaxed);
+	endWriteNoLock();
+}
+
+size_t Trader::Balance::getVersion() const noexcept
+{
+	return m_sequence.load(std::memory_order_acquire);
 }
 
 bool Trader::Balance::empty() const noexcept
 {
-	return m_fundList.empty() && m_reservedFundList.empty();
+	bool isEmpty = true;
+	readConsistent([&]() {
+		isEmpty = !m_fundMask.load(std::memory_order_relaxed)
+				&& !m_reservedFundMask.load(std::memory_order_relaxed);
+	});
+	return isEmpty;
 }
 
 void Trader::Balance::set(const CurrencyPtr currency, const IrStd::Type::Decimal amount)
 {
-	auto scope = m_lock.writeScope();
-	m_fundList[currency] = amount;
+	const auto ordinal = currency->getOrdinal();
+
+	std::lock_guard<std::mutex> lock(m_writeLock);
+	beginWriteNoLock();
+	setFundNoLock(ordinal, amount);
+	m_fundMask.fetch_or(getMask(ordinal), std::memory_order_relaxed);
+	endWriteNoLock();
 }
 
 void Trader::Balance::add(const CurrencyPtr currency, const IrStd::Type::Decimal amount)
 {
-	auto scope = m_lock.writeScope();
-	const auto currentAmount = getWithReserveNoLock(currency);
-	m_fundList[currency] = currentAmount + amount;
+	const auto ordinal = currency->getOrdinal();
+
+	std::lock_guard<std::mutex> lock(m_writeLock);
+	beginWriteNoLock();
+	setFundNoLock(ordinal, m_fundList[ordinal].load(std::memory_order_relaxed) + amount);
+	m_fundMask.fetch_or(getMask(ordinal), std::memory_order_relaxed);
+	endWriteNoLock();
 }
 
 void Trader::Balance::reserve(const CurrencyPtr currency, const IrStd::Type::Decimal amount)
 {
-	auto scope = m_lock.writeScope();
-	reserveNoLock(currency, amount);
-}
+	const auto ordinal = currency->getOrdinal();
 
-void Trader::Balance::reserveNoLock(const CurrencyPtr currency, const IrStd::Type::Decimal amount)
-{
-	IRSTD_ASSERT(TraderBalance, m_lock.isWriteScope(), "This operation can only be processed under a valid scope");
-	auto it = m_reservedFundList.find(currency);
-	if (it == m_reservedFundList.end())
-	{
-		m_reservedFundList[currency] = amount;
-	}
-	else
-	{
-		m_reservedFundList[currency] += amount;
-	}
-}
-
-IrStd::Type::Decimal Trader::Balance::getWithReserveNoLock(const CurrencyPtr currency) const noexcept
-{
-	IRSTD_ASSERT(TraderBalance, m_lock.isScope(), "This operation can only be processed under a valid scope");
-	auto it = m_fundList.find(currency);
-	return (it == m_fundList.end()) ? IrStd::Type::Decimal(0) : it->second;
+	std::lock_guard<std::mutex> lock(m_writeLock);
+	beginWriteNoLock();
+	setReservedFundNoLock(ordinal, m_reservedFundList[ordinal].load(std::memory_order_relaxed) + amount);
+	m_reservedFundMask.fetch_or(getMask(ordinal), std::memory_order_relaxed);
+	endWriteNoLock();
 }
 
 IrStd::Type::Decimal Trader::Balance::getWithReserve(const CurrencyPtr currency) const noexcept
 {
-	auto scope = m_lock.readScope();
-	return getWithReserveNoLock(currency);
+	const auto ordinal = currency->getOrdinal();
+	IrStd::Type::Decimal amount = 0;
+	readConsistent([&]() {
+		amount = m_fundList[ordinal].load(std::memory_order_relaxed);
+	});
+	return amount;
 }
 
 IrStd::Type::Decimal Trader::Balance::get(const CurrencyPtr currency) const noexcept
 {
-	auto scope = m_lock.readScope();
-	auto amount = getWithReserveNoLock(currency);
+	const auto ordinal = currency->getOrdinal();
+	IrStd::Type::Decimal amount = 0;
+	IrStd::Type::Decimal reserve = 0;
+	readConsistent([&]() {
+		amount = m_fundList[ordinal].load(std::memory_order_relaxed);
+		reserve = m_reservedFundList[ordinal].load(std::memory_order_relaxed);
+	});
 
 	// Subtract the reserved part
-	const auto it = m_reservedFundList.find(currency);
-	if (it != m_reservedFundList.end())
-	{
-		amount -= it->second;
-	}
+	return amount - reserve;
+}
 
-	return amount;
+IrStd::Type::Decimal Trader::Balance::getInitialEstimate() const noexcept
+{
+	return (m_initialEstimate == Trader::Balance::INVALID_AMOUNT) ? IrStd::Type::Decimal(0.) : m_initialEstimate;
 }
 
 void Trader::Balance::getCurrencies(const std::function<void(const CurrencyPtr)>& callback) const noexcept
 {
-	auto scope = m_lock.readScope();
-	for (const auto it : m_fundList)
+	uint64_t fundMask = 0;
+	readConsistent([&]() {
+		fundMask = m_fundMask.load(std::memory_order_relaxed);
+	});
+
+	for (size_t ordinal = 0; ordinal < Currency::NB_CURRENCIES; ++ordinal)
 	{
-		callback(it.first);
+		if (fundMask & getMask(ordinal))
+		{
+			callback(Currency::fromOrdinal(ordinal));
+		}
 	}
 }
 
@@ -225,11 +363,13 @@ IrStd::Type::Decimal Trader::Balance::estimate(
 	IRSTD_ASSERT(TraderBalance, pExchange, "Balance::estimate can only be called with an associated exchange");
 	IrStd::Type::Decimal value = 0;
 
+	Snapshot snapshot;
+	getSnapshot(snapshot);
+	for (size_t ordinal = 0; ordinal < Currency::NB_CURRENCIES; ++ordinal)
 	{
-		auto scope = m_lock.readScope();
-		for (const auto& fund : m_fundList)
+		if (snapshot.m_fundMask & getMask(ordinal))
 		{
-			const auto curEstimate = estimate(fund.first, fund.second, pExchange);
+			const auto curEstimate = estimate(Currency::fromOrdinal(ordinal), snapshot.m_fundList[ordinal], pExchange);
 			if (curEstimate == Trader::Balance::INVALID_AMOUNT)
 			{
 				return Trader::Balance::INVALID_AMOUNT;
@@ -241,50 +381,55 @@ IrStd::Type::Decimal Trader::Balance::estimate(
 	return value;
 }
 
-void Trader::Balance::toJson(IrStd::Json& json, const Exchange* const pExchange) const
+void Trader::Balance::toJson(JsonWriter& json, const Exchange* const pExchange) const
 {
 	IRSTD_ASSERT(TraderBalance, pExchange || m_pExchange, "Balance::toJson can only be called with an associated exchange");
 
 	const auto pCurExchange = (pExchange) ? pExchange : m_pExchange;
 	IrStd::Type::Decimal estimateBalance = 0;
 
+	Snapshot snapshot;
+	getSnapshot(snapshot);
+
+	json.beginObject();
 	{
-		auto scope = m_lock.readScope();
-		for (const auto& fund : m_fundList)
+		for (size_t ordinal = 0; ordinal < Currency::NB_CURRENCIES; ++ordinal)
 		{
-			const auto currency = fund.first;
-			const auto amount = fund.second;
-			// Look if there are reserved currency
-			const auto it = m_reservedFundList.find(fund.first);
-			const auto reserve = (it != m_reservedFundList.end()) ? it->second : IrStd::Type::Decimal(0.);
-			const auto estimateAmount = estimate(currency, amount, pCurExchange);
-
-			if (estimateAmount == Trader::Balance::INVALID_AMOUNT)
+			if (!(snapshot.m_fundMask & getMask(ordinal)))
 			{
-				const IrStd::Json itemJson({{"amount", amount}, {"reserve", reserve}});
-				json.add(currency->getId(), itemJson);
+				continue;
 			}
-			else 
+			const auto currency = Currency::fromOrdinal(ordinal);
+			const auto amount = snapshot.m_fundList[ordinal];
+			const auto reserve = snapshot.m_reservedFundList[ordinal];
+			const auto estimateAmount = estimate(currency, amount, pCurExchange);
+
+			json.key(currency->getId()).beginObject()
+					.member("amount", amount)
+					.member("reserve", reserve);
+			if (estimateAmount != Trader::Balance::INVALID_AMOUNT)
 			{
-				const IrStd::Json itemJson({{"amount", amount}, {"reserve", reserve}, {"estimate", estimateAmount}});
-				json.add(currency->getId(), itemJson);
+				json.member("estimate", estimateAmount);
 				estimateBalance += estimateAmount;
 			}
+			json.endObject();
 		}
 
 		// Add estimate and diff from begining and estimate currency
-		{
-			const IrStd::Json itemJson({{"estimate", estimateBalance}, {"initial",
-					(m_initialEstimate == Trader::Balance::INVALID_AMOUNT) ? IrStd::Type::Decimal(0.) : m_initialEstimate}});
-			json.add("total", itemJson);
-			json.add("estimate", pCurExchange->getEstimateCurrency()->getId());
-		}
+		json.key("total").beginObject()
+				.member("estimate", estimateBalance)
+				.member("initial", getInitialEstimate())
+				.endObject();
+		json.member("estimate", pCurExchange->getEstimateCurrency()->getId());
 	}
+	json.endObject();
 }
 
 void Trader::Balance::toStream(std::ostream& out) const
 {
-	auto scope = m_lock.readScope();
+	Snapshot snapshot;
+	getSnapshot(snapshot);
+
 	out << std::left << "      " << std::setw(16) << std::left << "Funds" << "("
 			<< std::setw(16) << "Reserved" << ")";
 	if (m_pExchange)
@@ -294,18 +439,21 @@ void Trader::Balance::toStream(std::ostream& out) const
 	out << std::endl;
 
 	IrStd::Type::Decimal balanceValue = 0;
-	for (const auto& fund : m_fundList)
+	for (size_t ordinal = 0; ordinal < Currency::NB_CURRENCIES; ++ordinal)
 	{
-		const auto amount = fund.second;
-		const auto currency = fund.first;
+		if (!(snapshot.m_fundMask & getMask(ordinal)))
+		{
+			continue;
+		}
+		const auto amount = snapshot.m_fundList[ordinal];
+		const auto currency = Currency::fromOrdinal(ordinal);
 
 		out << std::setw(4) << currency << ": " << std::setw(16) << amount;
 
 		// Look if there are reserved currency
-		auto it = m_reservedFundList.find(fund.first);
-		if (it != m_reservedFundList.end())
+		if (snapshot.m_reservedFundMask & getMask(ordinal))
 		{
-			out << "(" << std::setw(16) << it->second << ")";
+			out << "(" << std::setw(16) << snapshot.m_reservedFundList[ordinal] << ")";
 		}
 		else
 		{
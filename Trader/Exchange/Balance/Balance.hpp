@@ -1,12 +1,13 @@
 #pragma once
 
-#include <map>
 #include <atomic>
+#include <cstdint>
 #include <ostream>
 #include <mutex>
 #include "IrStd/IrStd.hpp"
 
 #include "Trader/Exchange/Currency/Currency.hpp"
+#include "Trader/Generic/Json/JsonWriter.hpp"
 
 namespace Trader
 {
@@ -64,6 +65,11 @@ namespace Trader
 		 */
 		void updateReserve(const Exchange& exchange);
 
+		/**
+		 * \brief Number changing with every update of the funds or the reserve
+		 */
+		size_t getVersion() const noexcept;
+
 		/**
 		 * Tell whether or not the balance is empty
 		 */
@@ -88,6 +94,11 @@ namespace Trader
 		IrStd::Type::Decimal estimate(const CurrencyPtr currency, const IrStd::Type::Decimal amount,
 				const Exchange* const pExchange) const noexcept;
 
+		/**
+		 * \brief First estimate of the balance made, 0 if none yet
+		 */
+		IrStd::Type::Decimal getInitialEstimate() const noexcept;
+
 		/**
 		 * List all availabel currencies
 		 */
@@ -95,17 +106,57 @@ namespace Trader
 
 		void toStream(std::ostream& out) const;
 
-		void toJson(IrStd::Json& json, const Exchange* const pExchange = nullptr) const;
+		void toJson(JsonWriter& json, const Exchange* const pExchange = nullptr) const;
 
 	private:
-		void reserveNoLock(const CurrencyPtr currency, const IrStd::Type::Decimal amount);
-		IrStd::Type::Decimal getWithReserveNoLock(const CurrencyPtr currency) const noexcept;
+		/**
+		 * Consistent copy of the balance content
+		 */
+		struct Snapshot
+		{
+			uint64_t m_fundMask;
+			uint64_t m_reservedFundMask;
+			IrStd::Type::Decimal m_fundList[Currency::NB_CURRENCIES];
+			IrStd::Type::Decimal m_reservedFundList[Currency::NB_CURRENCIES];
+		};
+
+		/**
+		 * Read the whole balance, this never blocks and retries if a writer
+		 * updated the balance in the meantime.
+		 */
+		void getSnapshot(Snapshot& snapshot) const noexcept;
+
+		/**
+		 * Read the content using \p read, it might be called several times
+		 */
+		template<class F>
+		void readConsistent(const F& read) const noexcept;
+
+		/**
+		 * Must be called by writers, under m_writeLock, around an update
+		 */
+		void beginWriteNoLock() noexcept;
+		void endWriteNoLock() noexcept;
+
+		void setFundNoLock(const size_t ordinal, const IrStd::Type::Decimal amount) noexcept;
+		void setReservedFundNoLock(const size_t ordinal, const IrStd::Type::Decimal amount) noexcept;
+
+		static constexpr uint64_t getMask(const size_t ordinal) noexcept
+		{
+			return static_cast<uint64_t>(1) << ordinal;
+		}
+
+		static_assert(Currency::NB_CURRENCIES <= 64, "The currency masks must fit into 64 bits");
 
-		// Main lock to allow multithread access
-		mutable IrStd::RWLock m_lock;
+		// Serialize the writers, readers rely on the sequence only (seqlock)
+		mutable std::mutex m_writeLock;
+		std::atomic<size_t> m_sequence;
 
-		std::map<CurrencyPtr, IrStd::Type::Decimal> m_fundList;
-		std::map<CurrencyPtr, IrStd::Type::Decimal> m_reservedFundList;
+		// Funds indexed by the currency ordinal
+		std::atomic<uint64_t> m_fundMask;
+		std::atomic<uint64_t> m_reservedFundMask;
+		std::atomic<IrStd::Type::Decimal> m_fundList[Currency::NB_CURRENCIES];
+		std::atomic<IrStd::Type::Decimal> m_reservedFundList[Currency::NB_CURRENCIES];
 		Exchange* m_pExchange;
 
 		// Related to currency estimates
@@ -8,12 +8,18 @@ IRSTD_TOPIC_USE_ALIAS(TraderBalanceMovements, Trader, Balance, Movements);
 Trader::BalanceMovements::BalanceMovements()
 		: m_timestamp(0)
 {
+	for (size_t ordinal = 0; ordinal < Currency::NB_CURRENCIES; ++ordinal)
+	{
+		m_incomeTotalList[ordinal] = 0;
+	}
 }
 
-void Trader::BalanceMovements::update(const Balance& balance)
+void Trader::BalanceMovements::update(
+		const Balance& balance,
+		const IrStd::Type::Timestamp timestamp)
 {
 	auto scope = m_lock.writeScope();
-	m_timestamp = IrStd::Type::Timestamp::now();
+	m_timestamp = timestamp;
 	const bool isNew = m_fundList.empty();
 
 	// Compare currencies that are registered
@@ -28,6 +34,7 @@ void Trader::BalanceMovements::update(const Balance& balance)
 		{
 			m_fundList[currency] = newAmount;
 			m_movements.push(m_timestamp, std::make_pair(newAmount - amount, currency));
+			pushIncomeNoLock(m_timestamp, newAmount - amount, currency);
 		}
 	}
 
@@ -41,6 +48,7 @@ void Trader::BalanceMovements::update(const Balance& balance)
 			if (!isNew)
 			{
 				m_movements.push(m_timestamp, std::make_pair(amount, currency));
+				pushIncomeNoLock(m_timestamp, amount, currency);
 			}
 		}
 	});
@@ -90,6 +98,11 @@ IrStd::Type::Decimal Trader::BalanceMovements::consume(
 		++pos;
 	}
 
+	if (isPositive)
+	{
+		consumeIncomeNoLock(oldTimestamp, amount - amountLeft, currency);
+	}
+
 	return amountLeft;
 }
 
@@ -105,6 +118,80 @@ bool Trader::BalanceMovements::get(
 	});
 }
 
+IrStd::Type::Decimal Trader::BalanceMovements::getIncome(
+		const IrStd::Type::Timestamp oldTimestamp,
+		const CurrencyPtr currency) const noexcept
+{
+	auto scope = m_lock.writeScope();
+	discardIncomeNoLock(oldTimestamp);
+	return std::max(IrStd::Type::Decimal(0), m_incomeTotalList[currency->getOrdinal()]);
+}
+
+void Trader::BalanceMovements::pushIncomeNoLock(
+		const IrStd::Type::Timestamp timestamp,
+		const IrStd::Type::Decimal amount,
+		const CurrencyPtr currency)
+{
+	if (amount <= 0)
+	{
+		return;
+	}
+
+	// Keep as many entries as the movements themselves
+	if (m_incomeList.size() >= NB_RECORDS)
+	{
+		const auto& income = m_incomeList.front();
+		m_incomeTotalList[income.m_ordinal] -= income.m_amount;
+		m_incomeList.pop_front();
+	}
+
+	const auto ordinal = currency->getOrdinal();
+	m_incomeList.push_back(Income{timestamp, ordinal, amount});
+	m_incomeTotalList[ordinal] += amount;
+}
+
+void Trader::BalanceMovements::discardIncomeNoLock(const IrStd::Type::Timestamp oldTimestamp) const noexcept
+{
+	while (!m_incomeList.empty() && m_incomeList.front().m_timestamp < oldTimestamp)
+	{
+		const auto& income = m_incomeList.front();
+		m_incomeTotalList[income.m_ordinal] -= income.m_amount;
+		m_incomeList.pop_front();
+	}
+
+	// Avoid accumulating rounding errors
+	if (m_incomeList.empty())
+	{
+		for (size_t ordinal = 0; ordinal < Currency::NB_CURRENCIES; ++ordinal)
+		{
+			m_incomeTotalList[ordinal] = 0;
+		}
+	}
+}
+
+void Trader::BalanceMovements::consumeIncomeNoLock(
+		const IrStd::Type::Timestamp oldTimestamp,
+		const IrStd::Type::Decimal amount,
+		const CurrencyPtr currency) noexcept
+{
+	const auto ordinal = currency->getOrdinal();
+	auto amountLeft = amount;
+	for (auto& income : m_incomeList)
+	{
+		if (amountLeft <= 0)
+		{
+			break;
+		}
+		if (income.m_ordinal == ordinal && income.m_timestamp >= oldTimestamp && income.m_amount > 0)
+		{
+			const auto amountConsumed = std::min(amountLeft, income.m_amount);
+			income.m_amount -= amountConsumed;
+			m_incomeTotalList[ordinal] -= amountConsumed;
+			amountLeft -= amountConsumed;
+		}
+	}
+}
+
 void Trader::BalanceMovements::clear() noexcept
 {
 	auto scope = m_lock.writeScope();
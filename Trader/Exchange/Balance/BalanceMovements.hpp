@@ -1,5 +1,7 @@
 #pragma once
 
+#include <deque>
+
 #include "Trader/Exchange/Balance/Balance.hpp"
 
 namespace Trader
@@ -17,7 +19,7 @@ namespace Trader
 		/**
 		 * \brief Update the balance the detect movements
 		 */
-		void update(const Balance& balance);
+		void update(const Balance& balance, const IrStd::Type::Timestamp timestamp);
 
 		/**
 		 * \brief Completly clear the movements
@@ -53,12 +55,42 @@ namespace Trader
 				const IrStd::Type::Timestamp oldTimestamp,
 				std::function<void(const IrStd::Type::Timestamp, const IrStd::Type::Decimal, const CurrencyPtr)> callback) const noexcept;
 
+		/**
+		 * \brief Sum of the positive movements of a currency since \p oldTimestamp
+		 * that have not been consumed yet.
+		 *
+		 * This is constant time, \p oldTimestamp is expected to only grow between calls,
+		 * movements older than it are discarded.
+		 */
+		IrStd::Type::Decimal getIncome(const IrStd::Type::Timestamp oldTimestamp,
+				const CurrencyPtr currency) const noexcept;
+
 	private:
+		/**
+		 * Positive movement, kept in chronological order
+		 */
+		struct Income
+		{
+			IrStd::Type::Timestamp m_timestamp;
+			size_t m_ordinal;
+			IrStd::Type::Decimal m_amount;
+		};
+
+		void pushIncomeNoLock(const IrStd::Type::Timestamp timestamp, const IrStd::Type::Decimal amount,
+				const CurrencyPtr currency);
+		void discardIncomeNoLock(const IrStd::Type::Timestamp oldTimestamp) const noexcept;
+		void consumeIncomeNoLock(const IrStd::Type::Timestamp oldTimestamp, const IrStd::Type::Decimal amount,
+				const CurrencyPtr currency) noexcept;
+
 		mutable IrStd::RWLock m_lock;
 
 		std::map<CurrencyPtr, IrStd::Type::Decimal> m_fundList;
 		IrStd::Type::RingBufferSorted<IrStd::Type::Timestamp,
 				std::pair<IrStd::Type::Decimal, Trader::CurrencyPtr>, NB_RECORDS> m_movements;
 		IrStd::Type::Timestamp m_timestamp;
+
+		// Running sum of the positive movements per currency ordinal
+		mutable std::deque<Income> m_incomeList;
+		mutable IrStd::Type::Decimal m_incomeTotalList[Currency::NB_CURRENCIES];
 	};
 }
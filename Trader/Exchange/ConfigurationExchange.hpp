@@ -62,7 +62,17 @@ namespace Trader
 					 * If set, the exchange will not perform order related operations.
 					 * and obviously also balance related.
 					 */
-					{"readOnly", false}
+					{"readOnly", false},
+					/**
+					 * Record the active orders into a journal in the output directory,
+					 * to restore them and their operations after a restart.
+					 */
+					{"journal", false},
+					/**
+					 * Keep a snapshot of the properties in the output directory, to
+					 * start with them while they are downloaded again.
+					 */
+					{"propertiesSnapshot", true}
 				})
 		{
 		}
@@ -131,6 +141,16 @@ namespace Trader
 			return m_json.getBool("readOnly");
 		}
 
+		bool isJournal() const noexcept
+		{
+			return m_json.getBool("journal");
+		}
+
+		bool isPropertiesSnapshot() const noexcept
+		{
+			return m_json.getBool("propertiesSnapshot");
+		}
+
 		RatesPolling getRatesPolling() const noexcept
 		{
 			const size_t ratesPollingValue = m_json.getNumber("ratesPolling");
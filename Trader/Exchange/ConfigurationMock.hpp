@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Trader/Generic/Configuration/Configuration.hpp"
+
+namespace Trader
+{
+	class ConfigurationMock : public Configuration<ConfigurationMock>
+	{
+	public:
+		enum class LatencyDistribution : size_t
+		{
+			CONSTANT = 0,
+			UNIFORM,
+			EXPONENTIAL,
+			NORMAL
+		};
+
+		ConfigurationMock()
+				: Configuration<ConfigurationMock>({
+					/**
+					 * Distribution of the server latency, for API calls and for
+					 * an order to reach the order book.
+					 */
+					{"latencyDistribution", IrStd::Type::toIntegral(LatencyDistribution::UNIFORM)},
+					/**
+					 * Mean latency in milliseconds
+					 */
+					{"latencyMeanMs", 1000},
+					/**
+					 * Spread of the latency in milliseconds, this is the half width for
+					 * the uniform distribution and the standard deviation for the normal one.
+					 */
+					{"latencyJitterMs", 1000},
+					/**
+					 * Probability in percent of a server failure on each API call
+					 */
+					{"failurePercent", 20},
+					/**
+					 * Value (in the estimate currency) already queued at the price level
+					 * of a new order, it must be traded before the order gets filled.
+					 */
+					{"queueAheadValue", 100},
+					/**
+					 * Value (in the estimate currency) traded at the price level of the
+					 * orders on each rate update. Orders are partially filled if larger.
+					 */
+					{"liquidityPerUpdateValue", 500},
+					/**
+					 * Fees in percent applied to resting (maker) and crossing (taker) orders,
+					 * negative to use the fee of the pair.
+					 */
+					{"feeMakerPercent", -1},
+					{"feeTakerPercent", -1},
+					/**
+					 * Seed of the random generator, 0 for a random seed
+					 */
+					{"seed", 0}
+				})
+		{
+		}
+
+		ConfigurationMock(const IrStd::Type::Gson::Map& map)
+				: ConfigurationMock()
+		{
+			merge(map, /*mustExists*/true);
+		}
+
+		LatencyDistribution getLatencyDistribution() const noexcept
+		{
+			const size_t latencyDistributionValue = m_json.getNumber("latencyDistribution");
+			return static_cast<LatencyDistribution>(latencyDistributionValue);
+		}
+
+		double getLatencyMeanMs() const noexcept
+		{
+			return m_json.getNumber("latencyMeanMs");
+		}
+
+		double getLatencyJitterMs() const noexcept
+		{
+			return m_json.getNumber("latencyJitterMs");
+		}
+
+		double getFailurePercent() const noexcept
+		{
+			return m_json.getNumber("failurePercent");
+		}
+
+		double getQueueAheadValue() const noexcept
+		{
+			return m_json.getNumber("queueAheadValue");
+		}
+
+		double getLiquidityPerUpdateValue() const noexcept
+		{
+			return m_json.getNumber("liquidityPerUpdateValue");
+		}
+
+		double getFeeMakerPercent() const noexcept
+		{
+			return m_json.getNumber("feeMakerPercent");
+		}
+
+		double getFeeTakerPercent() const noexcept
+		{
+			return m_json.getNumber("feeTakerPercent");
+		}
+
+		uint64_t getSeed() const noexcept
+		{
+			return m_json.getNumber("seed");
+		}
+	};
+}
@@ -7,7 +7,7 @@ IRSTD_TOPIC_REGISTER(Trader, Currency);
 IRSTD_TOPIC_USE_ALIAS(TraderCurrency, Trader, Currency);
 
 #define TRADER_CURRENCY_REGISTER(id, ...) \
-		static const Trader::CurrencyImpl IRSTD_PASTE(id, __)(#id, __VA_ARGS__); \
+		static const Trader::CurrencyImpl IRSTD_PASTE(id, __)(Ordinal::id, #id, __VA_ARGS__); \
 		const CurrencyPtr id = &IRSTD_PASTE(id, __);
 
 namespace Trader
@@ -15,7 +15,7 @@ namespace Trader
 	namespace Currency
 	{
 		// This is the none currency (or not set)
-		static const Trader::CurrencyImpl NONE__("-", "None", {}, /*isFiat*/false);
+		static const Trader::CurrencyImpl NONE__(Ordinal::NONE, "-", "None", {}, /*isFiat*/false);
 		const CurrencyPtr NONE = &NONE__;
 
 		// Register all supported currencies here 
@@ -64,6 +64,15 @@ namespace Trader
 
 // ---- Trader::Currency ------------------------------------------------------
 
+Trader::CurrencyPtr Trader::Currency::fromOrdinal(const size_t ordinal) noexcept
+{
+	static const CurrencyPtr currencyList[] = {TRADER_CURRENCY_LIST};
+	static_assert(sizeof(currencyList) / sizeof(CurrencyPtr) == NB_CURRENCIES,
+			"The currency list and the ordinals must match");
+	IRSTD_ASSERT(TraderCurrency, ordinal < NB_CURRENCIES, "Invalid currency ordinal: " << ordinal);
+	return currencyList[ordinal];
+}
+
 Trader::CurrencyPtr Trader::Currency::discover(const char* const pStr)
 {
 	CurrencyPtr currencyList[] = {TRADER_CURRENCY_LIST};
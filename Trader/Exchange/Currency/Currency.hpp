@@ -3,7 +3,7 @@
 #include "Trader/Exchange/Currency/CurrencyImpl.hpp"
 
 #define TRADER_CURRENCY_LIST NONE, BCC, BCH, BCU, BTC, CAD, CNH, DASH, DAO, DOGE, DSH, EOS, ETH, ETC, EUR, \
-				FTC, GBP, GNO, ICN, IOT, LTC, MLN, NMC, NVC, OMG, PPC, RRT, RUR, SAN, TRC, USD, USDT, \
+				FTC, GBP, GNO, ICN, IOT, LTC, MLN, NMC, NVC, OMG, PPC, REP, RRT, RUR, SAN, TRC, USD, USDT, \
 				XLM, XMR, XOT, XPM, XRP, ZEC
 
 namespace Trader
@@ -13,6 +13,28 @@ namespace Trader
 	{
 		extern const CurrencyPtr TRADER_CURRENCY_LIST;
 
+		/**
+		 * Ordinal of each currency, it follows the order of \ref TRADER_CURRENCY_LIST
+		 */
+		namespace Ordinal
+		{
+			enum : size_t
+			{
+				TRADER_CURRENCY_LIST,
+				COUNT
+			};
+		}
+
+		/**
+		 * Number of currencies supported
+		 */
+		constexpr size_t NB_CURRENCIES = Ordinal::COUNT;
+
+		/**
+		 * Get a currency from its ordinal
+		 */
+		CurrencyPtr fromOrdinal(const size_t ordinal) noexcept;
+
 		/**
 		 * Identify a currency from a string
 		 */
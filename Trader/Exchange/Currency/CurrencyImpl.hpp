@@ -5,9 +5,10 @@ namespace Trader
 	class CurrencyImpl
 	{
 	public:
-		constexpr CurrencyImpl(const char* const pId, const char* const pName,
+		constexpr CurrencyImpl(const size_t ordinal, const char* const pId, const char* const pName,
 			std::initializer_list<const char* const> pMatches, const bool isFiat, const double minAmount = 0)
-				: m_pId(pId)
+				: m_ordinal(ordinal)
+				, m_pId(pId)
 				, m_pName(pName)
 				, m_pMatches(pMatches)
 				, m_isFiat(isFiat)
@@ -15,6 +16,15 @@ namespace Trader
 		{
 		}
 
+		/**
+		 * Position of the currency within the currency list, it is contiguous
+		 * and starts from 0, which makes it suitable as an array index.
+		 */
+		constexpr size_t getOrdinal() const noexcept
+		{
+			return m_ordinal;
+		}
+
 		constexpr const char* getId() const noexcept
 		{
 			return m_pId;
@@ -46,6 +56,7 @@ namespace Trader
 		}
 
 	private:
+		const size_t m_ordinal;
 		const char* const m_pId;
 		const char* const m_pName;
 		std::initializer_list<const char* const> m_pMatches;
@@ -1,5 +1,6 @@
 #include "Trader/Exchange/Event/EventManager.hpp"
 #include "Trader/Exchange/Exchange.hpp"
+#include "Trader/Generic/Log/AsyncLog.hpp"
 
 IRSTD_TOPIC_REGISTER(Trader, Event);
 IRSTD_TOPIC_USE_ALIAS(TraderEvent, Trader, Event);
@@ -104,7 +105,7 @@ void Trader::EventManager::copyOrder(
 		const Id orderIdNew,
 		const Lifetime minLifetimeToKeep)
 {
-	IRSTD_LOG_TRACE(TraderEvent, "Copying events from order id#" << orderIdOriginal
+	TRADER_LOG_TRACE(TraderEvent, "Copying events from order id#" << orderIdOriginal
 			<< " to order id#" << orderIdNew);
 	{
 		auto scope = m_orderEventLock.writeScope();
@@ -120,7 +121,7 @@ void Trader::EventManager::copyOrder(
 		const OrderEvents& events,
 		const Lifetime minLifetimeToKeep)
 {
-	IRSTD_LOG_TRACE(TraderEvent, "Copying events to id#" << orderId);
+	TRADER_LOG_TRACE(TraderEvent, "Copying events to id#" << orderId);
 	{
 		auto scope = m_orderEventLock.writeScope();
 
@@ -149,7 +150,7 @@ void Trader::EventManager::garbageCollection(const Exchange& exchange)
 			// If the order does not exists, delete the event
 			if (!orderExists)
 			{
-				IRSTD_LOG_DEBUG(TraderEvent, "Deleting event onOrderComplete(id#" << it->first
+				TRADER_LOG_DEBUG(TraderEvent, "Deleting event onOrderComplete(id#" << it->first
 						<< "), as the referring order does not exists anymore");
 				it = m_orderEventList.erase(it);
 			}
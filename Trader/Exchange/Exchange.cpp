@@ -1,9 +1,12 @@
 #include <iomanip>
 #include <algorithm>
 #include <fstream>
+#include <sstream>
 #include "IrStd/IrStd.hpp"
 
 #include "Trader/Exchange/Exchange.hpp"
+#include "Trader/Exchange/Transaction/PropertiesSnapshot.hpp"
+#include "Trader/Generic/Log/AsyncLog.hpp"
 
 IRSTD_TOPIC_REGISTER(Trader, Exchange);
 IRSTD_TOPIC_REGISTER(Trader, Exchange, Mock);
@@ -30,6 +33,8 @@ Trader::Exchange::Exchange(
 		ConfigurationExchange&& config)
 		: m_id(generateUniqueId(id))
 		, m_status(Status::DISCONNECTED)
+		, m_isSynchronous(false)
+		, m_pClock(Clock::getDefault())
 		, m_connectedTimestamp(0)
 		, m_estimateCurrency(Currency::USD)
 		, m_balance(*this)
@@ -42,8 +47,9 @@ Trader::Exchange::Exchange(
 		, m_eventUpdateBalanceAndOrders("Balance&OrdersTrigger")
 		, m_timestampDelta(0)
 		, m_eventManager()
-		, m_orderTrackList(m_eventManager, m_configuration.getOrderRegisterTimeoutMs())
+		, m_orderTrackList(m_eventManager, m_configuration.getOrderRegisterTimeoutMs(), m_pClock)
 {
+	registerMetrics();
 }
 
 Trader::Id Trader::Exchange::generateUniqueId(const Id type)
@@ -135,6 +141,21 @@ const IrStd::Event& Trader::Exchange::getEventRates() const noexcept
 	return m_eventRates;
 }
 
+const IrStd::Event& Trader::Exchange::getEventBalance() const noexcept
+{
+	return m_eventBalance;
+}
+
+const IrStd::Event& Trader::Exchange::getEventOrders() const noexcept
+{
+	return m_eventOrders;
+}
+
+const IrStd::Event& Trader::Exchange::getEventProperties() const noexcept
+{
+	return m_eventProperties;
+}
+
 bool Trader::Exchange::waitForNewRates(const uint64_t timeoutMs) const noexcept
 {
 	return m_eventRates.waitForNext(timeoutMs);
@@ -169,7 +190,7 @@ void Trader::Exchange::ratesRecorderThread()
 
 		IRSTD_LOG_TRACE(TraderExchange, getId() << ": recording rates for " << getId());
 
-		const auto currentTimestamp = IrStd::Type::Timestamp::now();
+		const auto currentTimestamp = getClock().now();
 
 		// Loop through all existing transactions
 		getTransactionMap().getTransactions([&](const CurrencyPtr, const CurrencyPtr,
@@ -194,14 +215,16 @@ void Trader::Exchange::ratesRecorderThread()
 					// writing useless information
 					if (previousRate != rate)
 					{
-						file.write(static_cast<uint64_t>(timestamp), IrStd::Type::ShortString(rate, pTransaction->getDecimalPlace()));
+						char rateFormated[FixedPoint::MAX_STRING_SIZE];
+						FixedPoint(rate, pTransaction->getDecimalPlace()).normalize().toString(rateFormated);
+						file.write(static_cast<uint64_t>(timestamp), IrStd::Type::ShortString(rateFormated));
 						previousRate = rate;
 						nbRecordings++;
 					}
 				});
 				if (previousTimestamp && isComplete == false)
 				{
-					IRSTD_LOG_ERROR(TraderExchange, getId() << ": circular buffer looped before all rates were recorded in "
+					TRADER_LOG_ERROR(TraderExchange, getId() << ": circular buffer looped before all rates were recorded in "
 							<< filePath << ", expected data loss. Recording within ]" << previousTimestamp
 							<< ", " << currentTimestamp << "]: " << nbRecordings << " data point(s).");
 				}
@@ -315,7 +338,7 @@ bool Trader::Exchange::buildOrderChainMap()
 
 	if (isAnyMissing)
 	{
-		IRSTD_LOG_WARNING(TraderExchange, "Missing order chains for the following pair(s): " << missingStream.str());
+		TRADER_LOG_WARNING(TraderExchange, "Missing order chains for the following pair(s): " << missingStream.str());
 		return false;
 	}
 
@@ -519,7 +542,12 @@ void Trader::Exchange::connect()
 	IRSTD_LOG_INFO(TraderExchange, "Connecting to " << getId()
 			<< " with configuration " << m_configuration);
 
-	// Read properties before anything else
+	// Read properties before anything else, the ones of the previous run are
+	// used if available while the current ones are downloaded
+	if (m_configuration.isPropertiesSnapshot())
+	{
+		restorePropertiesSnapshot();
+	}
 	updatePropertiesStart();
 	if (!m_eventProperties.waitForAtLeast(1, CONNECTION_TIMEOUT_S * 1000))
 	{
@@ -533,21 +561,29 @@ void Trader::Exchange::connect()
 		IRSTD_THROW(TraderExchange, "Detected no activity on " << getId()
 				<< ", timeout exceeded " << CONNECTION_TIMEOUT_S << "s, abort.");
 	}
-	// Wait for all rates to be set
+	// Wait for all rates to be set, each transaction signals its first rate
 	{
-		getTransactionMap().getTransactions([&](const CurrencyPtr currency1, const CurrencyPtr currency2, const PairTransactionMap::PairTransactionPointer pTransaction) {
-			size_t timeout_s = CONNECTION_TIMEOUT_S;
-			while (!pTransaction->getNbRates() && timeout_s)
-			{
-				IrStd::Threads::sleep(1000);
-				--timeout_s;
-			}
-			if (!pTransaction->getNbRates())
-			{
-				IRSTD_THROW(TraderExchange, "Rate " << currency1 << "/" << currency2 << " for " << getId()
-						<< " was not updated within " << CONNECTION_TIMEOUT_S << "s, abort.");
-			}
+		size_t nbTransactions = 0;
+		getTransactionMap().getTransactions([&](const CurrencyPtr, const CurrencyPtr) {
+			++nbTransactions;
+		});
+		m_ratesReady.reset(nbTransactions);
+		getTransactionMap().getTransactions([&](const CurrencyPtr, const CurrencyPtr, const PairTransactionMap::PairTransactionPointer pTransaction) {
+			pTransaction->setFirstRateCountDown(&m_ratesReady);
 		});
+		if (!m_ratesReady.wait(CONNECTION_TIMEOUT_S * 1000))
+		{
+			std::stringstream missingStream;
+			getTransactionMap().getTransactions([&](const CurrencyPtr currency1, const CurrencyPtr currency2, const PairTransactionMap::PairTransactionPointer pTransaction) {
+				pTransaction->setFirstRateCountDown(nullptr);
+				if (!pTransaction->getNbRates())
+				{
+					missingStream << " " << currency1 << "/" << currency2;
+				}
+			});
+			IRSTD_THROW(TraderExchange, "Rates" << missingStream.str() << " for " << getId()
+					<< " were not updated within " << CONNECTION_TIMEOUT_S << "s, abort.");
+		}
 	}
 
 	// Switch on the rates recorder if any
@@ -569,6 +605,12 @@ void Trader::Exchange::connect()
 	// Only if orders are enable
 	if (!m_configuration.isReadOnly())
 	{
+		// Restore the orders of a previous run, only once
+		if (m_configuration.isJournal() && !m_pJournal)
+		{
+			restoreJournal();
+		}
+
 		updateBalanceAndOrdersStart();
 
 		// Wait for the first data to be available
@@ -589,14 +631,14 @@ void Trader::Exchange::connect()
 	}
 	catch (const IrStd::Exception& e)
 	{
-		IRSTD_LOG_ERROR(TraderExchange, "Sanity check failed for " << getId() << ": " << e);
+		TRADER_LOG_ERROR(TraderExchange, "Sanity check failed for " << getId() << ": " << e);
 	}
 
 	// Print
 	toStreamRates(std::cout);
 
 	// Set connected status
-	m_connectedTimestamp = IrStd::Type::Timestamp::now();
+	m_connectedTimestamp = getClock().now();
 	m_status = Status::CONNECTED;
 }
 
@@ -608,11 +650,13 @@ void Trader::Exchange::disconnect()
 
 	IRSTD_LOG_INFO(TraderExchange, "Disconnecting from " << getId() << "...");
 
-	// Wait until all jobs are done
-	waitForAllJobsToBeCompleted();
-
-	// Stop services
-	updateRatesStop();
+	// Stop services, in synchronous mode jobs are already done and
+	// the job pool might be used by other exchanges
+	if (!m_isSynchronous)
+	{
+		waitForAllJobsToBeCompleted();
+		updateRatesStop();
+	}
 
 	// Terminate all registered threads except watchdog
 	{
@@ -637,9 +681,70 @@ void Trader::Exchange::disconnect()
 
 	IRSTD_LOG_INFO(TraderExchange, getId() << ": disconnected");
 
+	m_isSynchronous = false;
 	m_status = Status::DISCONNECTED;
 }
 
+// ---- Trader::Exchange (synchronous) ----------------------------------------
+
+void Trader::Exchange::connectSynchronous()
+{
+	IRSTD_ASSERT(TraderExchange, m_status == Status::DISCONNECTED,
+			getId() << ": the exchange must be disconnected");
+	IRSTD_THROW_ASSERT(TraderExchange, m_configuration.getRatesPolling() == ConfigurationExchange::RatesPolling::UPDATE_RATES_IMPL,
+			getId() << ": synchronous mode is only supported with updateRatesImpl rates polling");
+
+	std::lock_guard<std::mutex> lock(m_connectMutex);
+
+	reset();
+	m_isSynchronous = true;
+	m_status = Status::CONNECTING;
+
+	IRSTD_LOG_INFO(TraderExchange, "Connecting synchronously to " << getId()
+			<< " with configuration " << m_configuration);
+
+	updateProperties();
+	IRSTD_THROW_ASSERT(TraderExchange, getNbCurrencies(), getId() << ": no properties available, abort.");
+
+	stepRates();
+
+	m_estimateCurrency = identifyEstimateCurrency();
+	updateTransactionsMinimalAmount();
+
+	if (!m_configuration.isReadOnly())
+	{
+		stepBalanceAndOrders();
+	}
+
+	m_connectedTimestamp = getClock().now();
+	m_status = Status::CONNECTED;
+}
+
+void Trader::Exchange::stepRates()
+{
+	IRSTD_ASSERT(TraderExchange, m_isSynchronous, getId() << ": only valid in synchronous mode");
+	request(Request::RATES, [&]() { updateRatesImpl(); });
+	m_eventRates.trigger();
+}
+
+void Trader::Exchange::stepBalanceAndOrders()
+{
+	IRSTD_ASSERT(TraderExchange, m_isSynchronous, getId() << ": only valid in synchronous mode");
+
+	// Limit the number of iterations, an update might keep asking for another one
+	// if orders are being canceled
+	size_t counter = 3;
+	while (updateBalanceAndOrders() && --counter)
+	{
+		// Do nothing
+	}
+}
+
+bool Trader::Exchange::isSynchronous() const noexcept
+{
+	return m_isSynchronous;
+}
+
 void Trader::Exchange::updateTransactionsMinimalAmount()
 {
 	std::map<CurrencyPtr, IrStd::Type::Decimal> minAmountMap;
@@ -663,7 +768,7 @@ void Trader::Exchange::updateTransactionsMinimalAmount()
 		}
 		else
 		{
-			IRSTD_LOG_WARNING(TraderExchange, getId() << ": no minimal amount identified for the currency " << currency);
+			TRADER_LOG_WARNING(TraderExchange, getId() << ": no minimal amount identified for the currency " << currency);
 		}
 	});
 
@@ -764,16 +869,17 @@ void Trader::Exchange::sanityCheck()
 				IRSTD_THROW_ASSERT(TraderExchange, pTransaction2->getRate() > 0,
 						"Rate for " << *pTransaction2 << " must be positive, rate="
 						<< pTransaction2->getRate());
-				const IrStd::Type::Decimal rateBack = IrStd::Type::doubleFormat(1. / pTransaction2->getRate(),
-						pTransaction1->getDecimalPlace());
-				const auto spread = rateBack - rate;
-				if (spread < 0)
+				// Rates are compared with the decimal places of the first pair
+				const FixedPoint fixedRate(rate, pTransaction1->getDecimalPlace());
+				const FixedPoint rateBack(1. / pTransaction2->getRate(), pTransaction1->getDecimalPlace());
+				const auto spread = rateBack - fixedRate;
+				if (spread < FixedPoint())
 				{
-					IRSTD_LOG_WARNING(TraderExchange, "Spread for " << *pTransaction1
+					TRADER_LOG_WARNING(TraderExchange, "Spread for " << *pTransaction1
 							<< " is negative which can happen but is unlikely, spread="
 							<< spread << ", rate=" << rate << ", rate.back=" << rateBack);
 				}
-				const auto spreadRatio = spread / rate;
+				const auto spreadRatio = spread.toDecimal() / fixedRate.toDecimal();
 				IRSTD_THROW_ASSERT(TraderExchange, spreadRatio <= ACCEPTABLE_SPREAD,
 						"Spreead ratio is out of bound for " << *pTransaction1 << ", spread.ratio=" << spreadRatio
 						<< ", spread=" << spread << ", rate=" << rate << ", rate.back=" << rateBack);
@@ -807,43 +913,7 @@ void Trader::Exchange::updatePropertiesThread()
 	{
 		try
 		{
-			IRSTD_LOG_TRACE(TraderExchange, "Updating properties for " << getId());
-
-			// Update a local version of the properties map
-			PairTransactionMap transactionMap;
-			IRSTD_HANDLE_RETRY(updatePropertiesImpl(transactionMap), 3);
-
-			if (m_transactionMap != transactionMap)
-			{
-				IRSTD_LOG_INFO(TraderExchange, "Properties updated for " << getId());
-
-				auto scope = m_lockProperties.writeScope();
-
-				// Copy transaction into the current one
-				m_transactionMap = transactionMap;
-
-				// Update the currency list
-				size_t nbTransactionPairs = 0;
-				{
-					m_currencyList.clear();
-					getTransactionMap().getTransactions([&](const CurrencyPtr currency1, const CurrencyPtr currency2) {
-						m_currencyList.insert(currency1);
-						m_currencyList.insert(currency2);
-						nbTransactionPairs++;
-					});
-				}
-				IRSTD_LOG_INFO(TraderExchange, "Identified " << m_currencyList.size() << " currencies and "
-						<< nbTransactionPairs << " transaction pairs for " << getId());
-
-				// Build the order chains
-				{
-					m_orderChainMap.clear();
-					buildOrderChainMap();
-				}
-
-				// Notify that the properties have been updated
-				m_eventProperties.trigger();
-			}
+			updateProperties();
 		}
 		catch (const IrStd::Exception& e)
 		{
@@ -851,7 +921,120 @@ void Trader::Exchange::updatePropertiesThread()
 			IRSTD_LOG_FATAL(TraderExchange, getId() << ": unhandled error: " << e
 						<< ", trace=" << e.trace() << ", ignore.");
 		}
-	} while (IrStd::Threads::sleep(m_configuration.getPropertiesPollingPeriodMs()));
+	} while (getClock().sleep(m_configuration.getPropertiesPollingPeriodMs()));
+}
+
+void Trader::Exchange::updateProperties()
+{
+	IRSTD_LOG_TRACE(TraderExchange, "Updating properties for " << getId());
+
+	// Update a local version of the properties map
+	PairTransactionMap transactionMap;
+	IRSTD_HANDLE_RETRY(request(Request::PROPERTIES, [&]() { updatePropertiesImpl(transactionMap); }), 3);
+
+	if (m_transactionMap != transactionMap)
+	{
+		IRSTD_LOG_INFO(TraderExchange, "Properties updated for " << getId());
+
+		{
+			auto scope = m_lockProperties.writeScope();
+			setProperties(transactionMap);
+		}
+
+		if (m_configuration.isPropertiesSnapshot())
+		{
+			savePropertiesSnapshot();
+		}
+	}
+}
+
+void Trader::Exchange::setProperties(const PairTransactionMap& transactionMap)
+{
+	// Copy transaction into the current one
+	m_transactionMap = transactionMap;
+
+	// Update the currency list
+	size_t nbTransactionPairs = 0;
+	{
+		m_currencyList.clear();
+		getTransactionMap().getTransactions([&](const CurrencyPtr currency1, const CurrencyPtr currency2) {
+			m_currencyList.insert(currency1);
+			m_currencyList.insert(currency2);
+			nbTransactionPairs++;
+		});
+	}
+	IRSTD_LOG_INFO(TraderExchange, "Identified " << m_currencyList.size() << " currencies and "
+			<< nbTransactionPairs << " transaction pairs for " << getId());
+
+	// Build the order chains
+	{
+		m_orderChainMap.clear();
+		buildOrderChainMap();
+	}
+
+	// Notify that the properties have been updated
+	m_eventProperties.trigger();
+}
+
+// ---- Trader::Exchange (properties snapshot) --------------------------------
+
+std::string Trader::Exchange::getPropertiesSnapshotPath() const
+{
+	std::string path(m_configuration.getOutputDirectory());
+	path.append("/properties.bin");
+	return path;
+}
+
+bool Trader::Exchange::restorePropertiesSnapshot()
+{
+	// Only implementations able to rebuild their state can use it
+	std::string state;
+	if (!getPropertiesStateImpl(state))
+	{
+		return false;
+	}
+
+	PairTransactionMap transactionMap;
+	if (!PropertiesSnapshot::load(getPropertiesSnapshotPath(), getId(), transactionMap, state))
+	{
+		return false;
+	}
+
+	try
+	{
+		setPropertiesStateImpl(state, transactionMap);
+	}
+	catch (const IrStd::Exception& e)
+	{
+		TRADER_LOG_WARNING(TraderExchange, getId() << ": ignoring the properties snapshot: " << e);
+		return false;
+	}
+
+	IRSTD_LOG_INFO(TraderExchange, getId() << ": starting with the properties of the previous run");
+	{
+		auto scope = m_lockProperties.writeScope();
+		setProperties(transactionMap);
+	}
+	return true;
+}
+
+void Trader::Exchange::savePropertiesSnapshot()
+{
+	std::string state;
+	if (!getPropertiesStateImpl(state))
+	{
+		return;
+	}
+
+	try
+	{
+		auto scope = m_lockProperties.readScope();
+		PropertiesSnapshot::save(getPropertiesSnapshotPath(), getId(), m_transactionMap, state);
+	}
+	catch (const IrStd::Exception& e)
+	{
+		TRADER_LOG_WARNING(TraderExchange, getId() << ": cannot save the properties snapshot: " << e);
+	}
 }
 
 // ---- Trader::Exchange (rates) ----------------------------------------------
@@ -893,7 +1076,7 @@ void Trader::Exchange::updateRatesThread()
 			switch (m_configuration.getRatesPolling())
 			{
 			case ConfigurationExchange::RatesPolling::UPDATE_RATES_IMPL:
-				IRSTD_HANDLE_RETRY(updateRatesImpl(), 3);
+				IRSTD_HANDLE_RETRY(request(Request::RATES, [&]() { updateRatesImpl(); }), 3);
 				break;
 
 			case ConfigurationExchange::RatesPolling::UPDATE_RATES_SPECIFIC_CURRENCY_IMPL:
@@ -902,7 +1085,7 @@ void Trader::Exchange::updateRatesThread()
 					std::vector<std::future<bool>> asyncFetchList;
 					getCurrencies([&](const CurrencyPtr currency) {
 						std::future<bool> future = std::async(std::launch::async, [=]{
-							IRSTD_HANDLE_RETRY(updateRatesSpecificCurrencyImpl(currency), 3);
+							IRSTD_HANDLE_RETRY(request(Request::RATES, [&]() { updateRatesSpecificCurrencyImpl(currency); }), 3);
 							return true;
 						});
 						asyncFetchList.push_back(std::move(future));
@@ -925,7 +1108,9 @@ void Trader::Exchange::updateRatesThread()
 						if (!pTransaction->isInvertedTransaction())
 						{
 							std::future<bool> future = std::async(std::launch::async, [=]{
-								IRSTD_HANDLE_RETRY(updateRatesSpecificPairImpl(currency1, currency2), 3);
+								IRSTD_HANDLE_RETRY(request(Request::RATES, [&]() {
+									updateRatesSpecificPairImpl(currency1, currency2);
+								}), 3);
 								return true;
 							});
 							asyncFetchList.push_back(std::move(future));
@@ -954,7 +1139,7 @@ void Trader::Exchange::updateRatesThread()
 			IRSTD_LOG_FATAL(TraderExchange, getId() << ": unhandled error: " << e
 						<< ", trace=" << e.trace() << ", ignore.");
 		}
-	} while (IrStd::Threads::sleep(m_configuration.getRatesPollingPeriodMs()));
+	} while (getClock().sleep(m_configuration.getRatesPollingPeriodMs()));
 }
 
 void Trader::Exchange::updateRatesSpecificPairImpl(
@@ -993,11 +1178,30 @@ namespace
 		static IrStd::ThreadPool<8> pool("jobPool");
 		return pool;
 	}
+
+	// Jobs waiting for a thread of the pool
+	Trader::Metrics::Gauge& getJobPoolQueued()
+	{
+		static Trader::Metrics::Gauge gauge;
+		static const auto registration = Trader::Metrics::getDefault().add("trader_job_pool_queued",
+				"Number of jobs waiting for a thread of the pool", {}, gauge);
+		return gauge;
+	}
 }
 
 void Trader::Exchange::addJob(const std::function<void()>& job)
 {
-	::getJobPool().addJob(job);
+	// In synchronous mode, jobs are executed immediately
+	if (m_isSynchronous)
+	{
+		job();
+		return;
+	}
+	::getJobPoolQueued().add(1);
+	::getJobPool().addJob([job]() {
+		::getJobPoolQueued().add(-1);
+		job();
+	});
 }
 
 void Trader::Exchange::waitForAllJobsToBeCompleted()
@@ -1005,6 +1209,73 @@ void Trader::Exchange::waitForAllJobsToBeCompleted()
 	::getJobPool().waitForAllJobsToBeCompleted();
 }
 
+// ---- Trader::Exchange (metrics) --------------------------------------------
+
+constexpr size_t Trader::Exchange::NB_REQUESTS;
+
+const char* Trader::Exchange::getRequestToString(const Request request) noexcept
+{
+	switch (request)
+	{
+	case Request::PROPERTIES:
+		return "properties";
+	case Request::RATES:
+		return "rates";
+	case Request::BALANCE:
+		return "balance";
+	case Request::ORDERS:
+		return "orders";
+	case Request::PLACE:
+		return "place";
+	case Request::CANCEL:
+		return "cancel";
+	case Request::WITHDRAW:
+		return "withdraw";
+	default:
+		IRSTD_UNREACHABLE(TraderExchange, "request=" << IrStd::Type::toIntegral(request));
+	}
+}
+
+void Trader::Exchange::request(
+		const Request request,
+		const std::function<void()>& impl)
+{
+	auto& metrics = m_requestMetricList[static_cast<size_t>(request)];
+	Metrics::Timer timer(metrics.m_latency, metrics.m_nbErrors);
+	impl();
+}
+
+void Trader::Exchange::registerMetrics()
+{
+	auto& metrics = Metrics::getDefault();
+	const Metrics::Labels labels{{"exchange", getId().c_str()}};
+
+	// Rates can be pushed by the implementation, the event counts all the updates
+	m_metricList.push_back(metrics.add("trader_exchange_rates_updates_total", "Number of rates updates",
+			labels, [this]() { return static_cast<double>(m_eventRates.getCounter()); }, Metrics::Type::COUNTER));
+
+	for (size_t i = 0; i < NB_REQUESTS; ++i)
+	{
+		auto requestLabels = labels;
+		requestLabels.push_back(std::make_pair("request", getRequestToString(static_cast<Request>(i))));
+		m_metricList.push_back(metrics.add("trader_exchange_request_seconds",
+				"Latency of the requests to the exchange server, retries included", requestLabels,
+				m_requestMetricList[i].m_latency));
+		m_metricList.push_back(metrics.add("trader_exchange_request_errors_total",
+				"Number of requests to the exchange server that failed", requestLabels,
+				m_requestMetricList[i].m_nbErrors));
+	}
+
+	{
+		auto lockLabels = labels;
+		lockLabels.push_back(std::make_pair("lock", "orders"));
+		m_metricList.push_back(metrics.add("trader_exchange_lock_wait_seconds",
+				"Time spent waiting for a lock of the exchange", lockLabels, m_lockOrdersWait));
+	}
+
+	m_orderTrackList.registerMetrics(labels, m_metricList);
+}
+
 // ---- Trader::Exchange (process) --------------------------------------------
 
 void Trader::Exchange::process(
@@ -1018,7 +1289,7 @@ void Trader::Exchange::process(
 	{
 		copyOperation.onOrderError("retryOnFailure", [this, operation, nbRetries](
 				ContextHandle& /*contextProceed*/, const TrackOrder& track) {
-			IRSTD_LOG_INFO(TraderExchange, getId() << ": " << track.getIdForTrace()
+			TRADER_LOG_INFO(TraderExchange, getId() << ": " << track.getIdForTrace()
 					<< " failed, retrying (left: " << (nbRetries - 1) << ")...");
 			std::stringstream retryMessageStream;
 			retryMessageStream << "Retrying (left: " << (nbRetries - 1) << ")";
@@ -1029,7 +1300,7 @@ void Trader::Exchange::process(
 				const auto availableAmount = m_balance.getWithReserve(operation.m_order.getInitialCurrency());
 				if (availableAmount < operation.m_amount)
 				{
-					IRSTD_LOG_INFO(TraderExchange, getId() << ": amount available for failed " << track.getIdForTrace()
+					TRADER_LOG_INFO(TraderExchange, getId() << ": amount available for failed " << track.getIdForTrace()
 							<< " is lower than the amount requested: " << availableAmount
 							<< " vs " << operation.m_amount << ", adjusting");
 					retryMessageStream << ", adjusting amount to " << availableAmount;
@@ -1062,12 +1333,12 @@ void Trader::Exchange::process(
 
 	const auto& order = operation.m_order;
 	// Floor the amount to process
-	const auto amount = IrStd::Type::doubleFormat(operation.m_amount,
-			order.getTransaction()->getDecimalPlace(), IrStd::TypeFormat::FLAG_FLOOR);
+	const auto amount = FixedPoint(operation.m_amount, order.getTransaction()->getDecimalPlace(),
+			FixedPoint::Rounding::FLOOR).toDecimal();
 
 	// Create a track order for this operation, note this will
 	// also fix the order rate within the track order
-	TrackOrder trackOrder{order, amount};
+	TrackOrder trackOrder{order, amount, getClock().now()};
 	// Associate the context to the track order in order to track it
 	trackOrder.setContext(operation.m_context);
 	const auto id = trackOrder.getId();
@@ -1084,64 +1355,20 @@ void Trader::Exchange::process(
 		m_orderTrackList.add(std::move(trackOrder), message.c_str());
 		m_orderTrackList.activate(id, /*mustExists*/true);
 		m_orderTrackList.remove(TrackOrderList::RemoveCause::CANCEL, id, strStream.str().c_str(), /*mustExists*/true);
-		IRSTD_LOG_ERROR(TraderExchange, getId() << ": " << strStream.str());
+		TRADER_LOG_ERROR(TraderExchange, getId() << ": " << strStream.str());
 		return;
 	}
 
 	// Copy the operation to add extra events
 	auto updatedOperation = operation;
-
-	// If this order is a linked order, register an event on this order
-	if (order.getNext())
-	{
-		auto& nextOrder = *order.getNext();
-
-		// Note: do not copy onError events along the way. They should be used only
-		// for the first order and be renewed after
-		updatedOperation.onOrderComplete("nextOrder", [this, nextOrder, originalEvents](
-				ContextHandle& contextProceed,
-				const TrackOrder& track,
-				const IrStd::Type::Decimal amountProceed) {
-
-			const auto order = track.getOrder();
-			const auto finalAmount = order.getFirstOrderFinalAmount(amountProceed);
-
-			IRSTD_LOG_DEBUG(TraderExchange, getId() << ": finished processing " << amountProceed << " "
-					<< order.getInitialCurrency() << " of " << track.getIdForTrace()
-					<< ", now processing " << finalAmount << " "
-					<< order.getFinalCurrency() << " of " << nextOrder);
-
-			if (nextOrder.isValid(finalAmount))
-			{
-				// Create the operation and copy all events which minimum level is operation level
-				Operation nextOperation(nextOrder, finalAmount, contextProceed.cast<OperationContext>());
-				nextOperation.m_events.copy(originalEvents, EventManager::Lifetime::OPERATION);
-				std::stringstream messageStream;
-				messageStream << "Next order from " << track.getIdForTrace();
-				process(nextOperation, /*nbRetries*/10, messageStream.str().c_str());
-			}
-			else
-			{
-				IRSTD_LOG_WARNING(TraderExchange, getId() << ": do not proceed with next order from "
-						<< track.getIdForTrace() << " as it would be invalid, most likely too small ("
-						<< finalAmount << " " << nextOrder.getInitialCurrency() << "), ignoring");
-			}
-
-		}, EventManager::Lifetime::ORDER);
-	}
-
-	// Monitor timeout
-	updatedOperation.onOrderTimeout("monitorTimeout", [](
-			ContextHandle& contextProceed,
-			const TrackOrder& /*track*/) {
-		auto operationContext = contextProceed.cast<OperationContext>();
-		operationContext->setFailureCause(OperationContext::FailureCause::TIMEOUT);
-	}, EventManager::Lifetime::ORDER);
+	addOrderEvents(updatedOperation, originalEvents);
 
 	// These operation must be done atomically in order to ensure that the events are always
 	// registered at the same time as the order
 	{
+		const uint64_t waitStartUs = LatencyHistogram::nowUs();
 		auto scope = m_lockOrders.writeScope();
+		m_lockOrdersWait.record(LatencyHistogram::nowUs() - waitStartUs);
 
 		// Register the event(s) that are order level or higher
 		m_eventManager.copyOrder(id, updatedOperation.m_events, EventManager::Lifetime::ORDER);
@@ -1159,7 +1386,7 @@ void Trader::Exchange::process(
 
 		// Make the actual order
 		std::vector<Id> createdOrderIdList;
-		IRSTD_LOG_INFO(TraderExchange, getId() << ": placing " << idForTrace);
+		TRADER_LOG_INFO(TraderExchange, getId() << ": placing " << idForTrace);
 		try
 		{
 			// Do not allow any retry of the API, this is too dangerous
@@ -1167,10 +1394,10 @@ void Trader::Exchange::process(
 			{
 			case TrackOrder::Type::MARKET:
 			case TrackOrder::Type::LIMIT:
-				setOrderImpl(*pFirstOrder, amount, createdOrderIdList);
+				request(Request::PLACE, [&]() { setOrderImpl(*pFirstOrder, amount, createdOrderIdList); });
 				break;
 			case TrackOrder::Type::WITHDRAW:
-				withdrawImpl(pFirstOrder->getInitialCurrency(), amount);
+				request(Request::WITHDRAW, [&]() { withdrawImpl(pFirstOrder->getInitialCurrency(), amount); });
 				break;
 			default:
 				IRSTD_UNREACHABLE(TraderExchange);
@@ -1180,7 +1407,7 @@ void Trader::Exchange::process(
 		}
 		catch (const IrStd::Exception& e)
 		{
-			IRSTD_LOG_ERROR(TraderExchange, getId() << ": error while placing " << idForTrace
+			TRADER_LOG_ERROR(TraderExchange, getId() << ": error while placing " << idForTrace
 					<< " (" << *pFirstOrder << "): " << e);
 			m_orderTrackList.remove(TrackOrderList::RemoveCause::FAILED, id, e.what(), /*mustExists*/false);
 		}
@@ -1190,8 +1417,9 @@ void Trader::Exchange::process(
 		{
 			if (m_orderTrackList.match(id, createdOrderIdList, /*mustExists*/false))
 			{
-				IRSTD_LOG_INFO(TraderExchange, getId() << ": assign (" << IrStd::arrayJoin(createdOrderIdList) 
-					<< ") to " << idForTrace);
+				std::stringstream idStream;
+				idStream << IrStd::arrayJoin(createdOrderIdList);
+				TRADER_LOG_INFO(TraderExchange, getId() << ": assign (" << idStream.str() << ") to " << idForTrace);
 			}
 		}
 
@@ -1203,6 +1431,102 @@ void Trader::Exchange::process(
 	});
 }
 
+void Trader::Exchange::addOrderEvents(
+		Operation& operation,
+		const EventManager::OrderEvents& originalEvents)
+{
+	// If this order is a linked order, register an event on this order
+	if (operation.m_order.getNext())
+	{
+		auto& nextOrder = *operation.m_order.getNext();
+
+		// Note: do not copy onError events along the way. They should be used only
+		// for the first order and be renewed after
+		operation.onOrderComplete("nextOrder", [this, nextOrder, originalEvents](
+				ContextHandle& contextProceed,
+				const TrackOrder& track,
+				const IrStd::Type::Decimal amountProceed) {
+
+			const auto order = track.getOrder();
+			const auto finalAmount = order.getFirstOrderFinalAmount(amountProceed);
+
+			TRADER_LOG_DEBUG(TraderExchange, getId() << ": finished processing " << amountProceed << " "
+					<< order.getInitialCurrency() << " of " << track.getIdForTrace()
+					<< ", now processing " << finalAmount << " "
+					<< order.getFinalCurrency() << " of " << nextOrder);
+
+			if (nextOrder.isValid(finalAmount))
+			{
+				// Create the operation and copy all events which minimum level is operation level
+				Operation nextOperation(nextOrder, finalAmount, contextProceed.cast<OperationContext>());
+				nextOperation.m_events.copy(originalEvents, EventManager::Lifetime::OPERATION);
+				std::stringstream messageStream;
+				messageStream << "Next order from " << track.getIdForTrace();
+				process(nextOperation, /*nbRetries*/10, messageStream.str().c_str());
+			}
+			else
+			{
+				TRADER_LOG_WARNING(TraderExchange, getId() << ": do not proceed with next order from "
+						<< track.getIdForTrace() << " as it would be invalid, most likely too small ("
+						<< finalAmount << " " << nextOrder.getInitialCurrency() << "), ignoring");
+			}
+
+		}, EventManager::Lifetime::ORDER);
+	}
+
+	// Monitor timeout
+	operation.onOrderTimeout("monitorTimeout", [](
+			ContextHandle& contextProceed,
+			const TrackOrder& /*track*/) {
+		auto operationContext = contextProceed.cast<OperationContext>();
+		operationContext->setFailureCause(OperationContext::FailureCause::TIMEOUT);
+	}, EventManager::Lifetime::ORDER);
+}
+
+void Trader::Exchange::restoreJournal()
+{
+	std::string path(m_configuration.getOutputDirectory());
+	path.append("/journal.bin");
+	m_pJournal = std::make_shared<Journal>(path);
+
+	const auto trackOrderList = m_orderTrackList.restore(m_pJournal,
+			[this](const CurrencyPtr initialCurrency, const CurrencyPtr finalCurrency) {
+		return std::static_pointer_cast<Transaction>(getTransactionMap().getTransactionForWrite(initialCurrency, finalCurrency));
+	});
+
+	// Events are closures and cannot be journaled, rebuild them from the order chain
+	for (const auto& track : trackOrderList)
+	{
+		const auto context = track.getContext();
+		if (!context || !context->getType().isA(OperationContext::getContextType()))
+		{
+			continue;
+		}
+
+		try
+		{
+			Operation operation(track.getOrder(), track.getAmount(), context.cast<OperationContext>());
+			addOrderEvents(operation, EventManager::OrderEvents());
+
+			auto scope = m_lockOrders.writeScope();
+			m_eventManager.copyOrder(track.getId(), operation.m_events, EventManager::Lifetime::ORDER);
+		}
+		catch (const IrStd::Exception& e)
+		{
+			TRADER_LOG_WARNING(TraderExchange, getId() << ": cannot restore the events of "
+					<< track.getIdForTrace() << ": " << e);
+		}
+	}
+
+	{
+		auto scope = m_lockOrders.writeScope();
+		m_balance.updateReserve(*this);
+	}
+
+	IRSTD_LOG_INFO(TraderExchange, getId() << ": restored " << trackOrderList.size()
+			<< " order(s) from " << path);
+}
+
 // ---- Trader::Exchange (balance & orders) -----------------------------------
 
 void Trader::Exchange::updateBalanceAndOrdersThread()
@@ -1228,7 +1552,7 @@ void Trader::Exchange::updateBalanceAndOrdersThread()
 			catch (const IrStd::Exception& e)
 			{
 				// Any unhandled exception shall break the thread
-				IRSTD_LOG_ERROR(TraderExchange, getId() << ": unhandled error: " << e
+				TRADER_LOG_ERROR(TraderExchange, getId() << ": unhandled error: " << e
 						<< ", trace=" << e.trace() << ", abort.");
 				break;
 			}
@@ -1280,22 +1604,22 @@ bool Trader::Exchange::updateBalanceAndOrders()
 	// in order to catch movement balance if an order disappear
 	try
 	{
-		IRSTD_LOG_TRACE(TraderExchange, "Updating order list for " << getId());
+		TRADER_LOG_TRACE(TraderExchange, "Updating order list for " << getId());
 		IRSTD_HANDLE_RETRY({
 			trackOrderList.clear();
-			updateOrdersImpl(trackOrderList);
+			request(Request::ORDERS, [&]() { updateOrdersImpl(trackOrderList); });
 		}, 3);
 
-		IRSTD_LOG_TRACE(TraderExchange, "Updating balance for " << getId());
+		TRADER_LOG_TRACE(TraderExchange, "Updating balance for " << getId());
 		IRSTD_HANDLE_RETRY({
 			balance.clear();
-			updateBalanceImpl(balance);
+			request(Request::BALANCE, [&]() { updateBalanceImpl(balance); });
 			m_orderTrackList.updateBalance(balance);
 		}, 3);
 	}
 	catch (const IrStd::Exception& e)
 	{
-		IRSTD_LOG_ERROR(TraderExchange, getId() << ": error while fetching balance/orders: " << e
+		TRADER_LOG_ERROR(TraderExchange, getId() << ": error while fetching balance/orders: " << e
 				<< ", trace=" << e.trace() << ", ignore.");
 		return false;
 	}
@@ -1346,14 +1670,14 @@ bool Trader::Exchange::updateBalanceAndOrders()
 	try
 	{
 		needUpdate |= m_orderTrackList.cancelTimeout(getServerTimestamp(), [&](const TrackOrder& track) {
-			IRSTD_HANDLE_RETRY(cancelOrderImpl(track), 3);
-			IRSTD_LOG_INFO(TraderExchange, getId() << ": Order#" << track.getId() << " canceled");
+			IRSTD_HANDLE_RETRY(request(Request::CANCEL, [&]() { cancelOrderImpl(track); }), 3);
+			TRADER_LOG_INFO(TraderExchange, getId() << ": Order#" << track.getId() << " canceled");
 			return true;
 		});
 	}
 	catch (const IrStd::Exception& e)
 	{
-		IRSTD_LOG_ERROR(TraderExchange, getId() << ": error while canceling: " << e
+		TRADER_LOG_ERROR(TraderExchange, getId() << ": error while canceling: " << e
 				<< ", trace=" << e.trace() << ", ignore.");
 	}
 
@@ -1382,14 +1706,14 @@ void Trader::Exchange::watchdogThread()
 			}
 			catch (const IrStd::Exception& e)
 			{
-				IRSTD_LOG_ERROR(TraderExchange, "Error while connecting to "
+				TRADER_LOG_ERROR(TraderExchange, "Error while connecting to "
 						<< getId() << ": " << e << ", will retry in "
 						<< RETRY_CONNECT_S << "s");
 				disconnect();
 
 				// Wait for RETRY_CONNECT_S seconds
 				size_t counter = RETRY_CONNECT_S;
-				while (counter-- && IrStd::Threads::sleep(1000))
+				while (counter-- && getClock().sleep(1000))
 				{
 					// Do nothing
 				}
@@ -1410,7 +1734,7 @@ void Trader::Exchange::watchdogThread()
 		IrStd::Threads::setActive();
 		if (pEvent != nullptr && m_status == Status::CONNECTED)
 		{
-			IRSTD_LOG_ERROR(TraderExchange, "Watchdog detected inactivity on "
+			TRADER_LOG_ERROR(TraderExchange, "Watchdog detected inactivity on "
 					<< getId() << " for event " << *pEvent << " (timeout="
 					<< WATCHDOG_TIMEOUT_S << "s)");
 			restartCounter++;
@@ -1423,7 +1747,7 @@ void Trader::Exchange::watchdogThread()
 			{
 				if (!IrStd::Threads::isActive(it.second) && m_status == Status::CONNECTED)
 				{
-					IRSTD_LOG_ERROR(TraderExchange, getId() << ": thread ("
+					TRADER_LOG_ERROR(TraderExchange, getId() << ": thread ("
 							<< *IrStd::Threads::get(it.second) << ") is inactive");
 					restartCounter++;
 				}
@@ -1462,12 +1786,12 @@ void Trader::Exchange::watchdogStop()
 
 IrStd::Type::Timestamp Trader::Exchange::getServerTimestamp() const noexcept
 {
-	return IrStd::Type::Timestamp::now() + m_timestampDelta;
+	return getClock().now() + m_timestampDelta;
 }
 
 void Trader::Exchange::setServerTimestamp(const IrStd::Type::Timestamp timestamp) noexcept
 {
-	m_timestampDelta = timestamp - IrStd::Type::Timestamp::now();
+	m_timestampDelta = timestamp - getClock().now();
 }
 
 IrStd::Type::Timestamp Trader::Exchange::getConnectedTimestamp() const noexcept
@@ -1475,6 +1799,22 @@ IrStd::Type::Timestamp Trader::Exchange::getConnectedTimestamp() const noexcept
 	return m_connectedTimestamp;
 }
 
+// ---- Trader::Exchange (clock) ----------------------------------------------
+
+void Trader::Exchange::setClock(std::shared_ptr<Clock> pClock)
+{
+	IRSTD_THROW_ASSERT(TraderExchange, m_status == Status::DISCONNECTED,
+			getId() << ": the clock cannot be changed while connected");
+	IRSTD_THROW_ASSERT(TraderExchange, pClock, getId() << ": a clock must be provided");
+	m_pClock = pClock;
+	m_orderTrackList.setClock(pClock);
+}
+
+Trader::Clock& Trader::Exchange::getClock() const noexcept
+{
+	return *m_pClock;
+}
+
 // ---- Trader::Exchange::toStream* -------------------------------------------
 
 void Trader::Exchange::toStreamRates(std::ostream& out)
@@ -8,6 +8,9 @@
 #include "IrStd/IrStd.hpp"
 
 #include "Trader/Generic/Id/Id.hpp"
+#include "Trader/Generic/Clock/Clock.hpp"
+#include "Trader/Generic/Metrics/Metrics.hpp"
+#include "Trader/Generic/Event/CountDown.hpp"
 #include "Trader/Exchange/ConfigurationExchange.hpp"
 #include "Trader/Exchange/Balance/Balance.hpp"
 #include "Trader/Exchange/Currency/Currency.hpp"
@@ -83,6 +86,20 @@ namespace Trader
 		void stop();
 		Status getStatus() const noexcept;
 
+		/**
+		 * \brief Synchronous mode, used to replay recorded data.
+		 *
+		 * No thread is created, the caller drives the exchange with the step
+		 * functions and operations are placed from the calling thread.
+		 * The exchange is stopped with stop().
+		 * \{
+		 */
+		void connectSynchronous();
+		void stepRates();
+		void stepBalanceAndOrders();
+		bool isSynchronous() const noexcept;
+		/// \}
+
 		/**
 		 * Get the number of availabel currencies
 		 */
@@ -152,6 +169,16 @@ namespace Trader
 		 */
 		IrStd::Type::Timestamp getConnectedTimestamp() const noexcept;
 
+		/**
+		 * Set the clock driving this exchange, this cannot be done when the exchange is connected
+		 */
+		void setClock(std::shared_ptr<Clock> pClock);
+
+		/**
+		 * Clock to be used for all timing related to this exchange
+		 */
+		Clock& getClock() const noexcept;
+
 		/**
 		 * Available scopes
 		 * \{
@@ -176,6 +203,9 @@ namespace Trader
 		 * Get event instance
 		 */
 		const IrStd::Event& getEventRates() const noexcept;
+		const IrStd::Event& getEventBalance() const noexcept;
+		const IrStd::Event& getEventOrders() const noexcept;
+		const IrStd::Event& getEventProperties() const noexcept;
 
 		/**
 		 * This function freeze the current thread until new rates are available
@@ -211,6 +241,18 @@ namespace Trader
 	private:
 		void updatePropertiesStart();
 		void updatePropertiesThread();
+		void updateProperties();
+		/**
+		 * Install a new set of properties, it must be called with the properties lock
+		 */
+		void setProperties(const PairTransactionMap& transactionMap);
+
+		/**
+		 * Load the properties of the previous run, if any and if the implementation supports it
+		 */
+		bool restorePropertiesSnapshot();
+		void savePropertiesSnapshot();
+		std::string getPropertiesSnapshotPath() const;
 
 		void updateRatesStart();
 		void updateRatesStop();
@@ -264,6 +306,43 @@ namespace Trader
 		 */
 		void process(const Operation& operation, const std::string message);
 
+		/**
+		 * Register the events chaining the next order and monitoring the timeout,
+		 * common to all the orders placed by the exchange.
+		 */
+		void addOrderEvents(Operation& operation, const EventManager::OrderEvents& originalEvents);
+
+		/**
+		 * Restore the orders recorded in the journal and re-attach their events
+		 */
+		void restoreJournal();
+
+		/**
+		 * Requests made to the exchange server
+		 */
+		enum class Request : size_t
+		{
+			PROPERTIES = 0,
+			RATES,
+			BALANCE,
+			ORDERS,
+			PLACE,
+			CANCEL,
+			WITHDRAW
+		};
+		static constexpr size_t NB_REQUESTS = static_cast<size_t>(Request::WITHDRAW) + 1;
+		static const char* getRequestToString(const Request request) noexcept;
+
+		/**
+		 * Call the implementation of a request, measuring its latency and errors
+		 */
+		void request(const Request request, const std::function<void()>& impl);
+
+		/**
+		 * Register the metrics of the exchange
+		 */
+		void registerMetrics();
+
 		/**
 		 * Generate a unique Id for the Exchange
 		 */
@@ -276,6 +355,24 @@ namespace Trader
 		 * Virtual functions to be overwritten by the implementation
 		 */
 		virtual void updatePropertiesImpl(PairTransactionMap& transactionMap) = 0;
+		/**
+		 * \brief State of the implementation built by updatePropertiesImpl, saved
+		 *        along with the properties snapshot.
+		 * \return false if the implementation cannot start from a snapshot, default.
+		 */
+		virtual bool getPropertiesStateImpl(std::string& /*state*/) const
+		{
+			return false;
+		}
+		/**
+		 * \brief Restore the state saved with getPropertiesStateImpl.
+		 *
+		 * It is called before the restored pairs are installed, so the
+		 * implementation can complete them, with their data for instance.
+		 */
+		virtual void setPropertiesStateImpl(const std::string& /*state*/, PairTransactionMap& /*transactionMap*/)
+		{
+		}
 		virtual void updateRatesStartImpl();
 		virtual void updateRatesStopImpl();
 		virtual void updateRatesImpl();
@@ -312,6 +409,8 @@ namespace Trader
 
 		Id m_id;
 		Status m_status;
+		bool m_isSynchronous;
+		std::shared_ptr<Clock> m_pClock;
 
 		/**
 		 * \brief Connected until this timestamp
@@ -337,6 +436,8 @@ namespace Trader
 		IrStd::Event m_eventOrders;
 		IrStd::Event m_eventBalance;
 		IrStd::Event m_eventUpdateBalanceAndOrders;
+		// Signaled by the transactions on their first rate while connecting
+		CountDown m_ratesReady;
 
 		/**
 		 * Transaction pair map
@@ -360,5 +461,19 @@ namespace Trader
 
 		// Active order list
 		TrackOrderList m_orderTrackList;
+
+		// Journal of the active orders, to restore them after a restart
+		std::shared_ptr<Journal> m_pJournal;
+
+		// Metrics
+		struct RequestMetrics
+		{
+			LatencyHistogram m_latency;
+			Metrics::Counter m_nbErrors;
+		};
+		RequestMetrics m_requestMetricList[NB_REQUESTS];
+		LatencyHistogram m_lockOrdersWait;
+		// Declared last, to be unregistered before the metrics are destroyed
+		std::vector<Metrics::Registration> m_metricList;
 	};
 }
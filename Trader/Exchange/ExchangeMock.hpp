@@ -1,15 +1,14 @@
 #pragma once
 
 #include "Trader/Exchange/Exchange.hpp"
+#include "Trader/Exchange/ConfigurationMock.hpp"
+#include "Trader/Exchange/Order/MatchingEngine.hpp"
 
 IRSTD_TOPIC_USE(Trader, Exchange, Mock);
 
 namespace Trader
 {
-	static constexpr size_t AVG_SERVER_LAG_MS = 1000;
-	static constexpr size_t AVG_SERVER_LAG_REGISTER_ORDER_MS = 1000;
 	static constexpr size_t INTIAL_BALANCE_VALUE = 2000;
-	static constexpr size_t SERVER_FAILURE_PERCENT = 20;
 
 	template<class T>
 	class ExchangeMock : public T
@@ -19,6 +18,9 @@ namespace Trader
 		ExchangeMock(Args&& ... args)
 				: T(std::forward<Args>(args)...)
 				, m_id(123456)
+				, m_engine(ConfigurationMock(), [this](const CurrencyPtr currency, const IrStd::Type::Decimal value) {
+					return valueToAmount(currency, value);
+				})
 		{
 			// Note: no need to terminate the thread, it is done automatically by disconnect
 			this->createThread("Mock", &ExchangeMock::updateMockOrdersThread, this);
@@ -31,10 +33,28 @@ namespace Trader
 			this->terminateThread("Mock");
 		}
 
+		/**
+		 * Configure the emulated server (latency, failures, liquidity and fees)
+		 */
+		void setMockConfiguration(ConfigurationMock&& config)
+		{
+			std::lock_guard<std::mutex> lock(m_mockOrderLock);
+			m_engine.setConfiguration(std::move(config));
+		}
+
+		/**
+		 * Fill and latency statistics of the emulated server
+		 */
+		MatchingEngine::Statistics getMockStatistics() const
+		{
+			std::lock_guard<std::mutex> lock(m_mockOrderLock);
+			return m_engine.getStatistics();
+		}
+
 		void setOrderImpl(const Order& order, const IrStd::Type::Decimal amount, std::vector<Id>& idList) override final
 		{
-			sleepForAvgDelay(AVG_SERVER_LAG_MS);
-			emulateRandomServerFailure(SERVER_FAILURE_PERCENT, /*throwRetry*/false);
+			emulateLatency();
+			emulateRandomServerFailure(/*throwRetry*/false);
 
 			{
 				std::lock_guard<std::mutex> lock(m_mockOrderLock);
@@ -47,44 +67,36 @@ namespace Trader
 				IRSTD_THROW_ASSERT(IRSTD_TOPIC(Trader, Exchange, Mock), availableFund >= amount,
 						"Insufficient funds, availableFund=" << availableFund << ", amount=" << amount);
 
-				// Make sure the rate is ok
-				if (order.getTransaction()->getRate() < order.getRate())
-				{
-					const auto delayMs = IrStd::Rand().getNumber<size_t>(0, AVG_SERVER_LAG_REGISTER_ORDER_MS * 2);
-					const auto orderId = Id(m_id++);
-					IRSTD_LOG_INFO(IRSTD_TOPIC(Trader, Exchange, Mock), "Rate is too low for " << order << ", creating order #"
-							<< orderId << " with " << delayMs << "ms delay");
-					TrackOrder track(orderId, order, amount, IrStd::Type::Timestamp::now() + delayMs);
-					m_mockTrackOrderListLag.push_back(std::move(track));
-
-					idList.push_back(orderId);
-					return;
-				}
+				// Send the order to the book, it will be matched once it reaches it
+				const auto orderId = Id(m_id++);
+				const auto timestamp = this->getClock().now();
+				IRSTD_LOG_INFO(IRSTD_TOPIC(Trader, Exchange, Mock), "Creating order #" << orderId << " for " << order);
+				m_engine.add(TrackOrder(orderId, order, amount, timestamp), timestamp);
+				idList.push_back(orderId);
 
-				// Process immediatly
-				processOrder(order, amount);
+				// Orders crossing the market with no latency are filled immediatly
+				matchOrders(timestamp);
 			}
 		}
 
 		void updateOrdersImpl(std::vector<TrackOrder>& trackOrders) override final
 		{
-			sleepForAvgDelay(AVG_SERVER_LAG_MS);
-			emulateRandomServerFailure(SERVER_FAILURE_PERCENT, /*throwRetry*/true);
+			emulateLatency();
+			emulateRandomServerFailure(/*throwRetry*/true);
 
 			{
 				std::lock_guard<std::mutex> lock(m_mockOrderLock);
-				for (const auto& track : m_mockTrackOrderList)
-				{
+				m_engine.each([&](const TrackOrder& track) {
 					TrackOrder trackOrder(track.getId(), track.getOrder(), track.getAmount(), track.getCreationTime());
 					trackOrders.push_back(std::move(trackOrder));
-				}
+				});
 			}
 		}
 
 		void withdrawImpl(const CurrencyPtr currency, const IrStd::Type::Decimal amount) override final
 		{
-			sleepForAvgDelay(AVG_SERVER_LAG_MS);
-			emulateRandomServerFailure(SERVER_FAILURE_PERCENT, /*throwRetry*/true);
+			emulateLatency();
+			emulateRandomServerFailure(/*throwRetry*/true);
 
 			{
 				std::lock_guard<std::mutex> lock(m_mockOrderLock);
@@ -101,26 +113,19 @@ namespace Trader
 
 		void cancelOrderImpl(const TrackOrder& order) override final
 		{
-			sleepForAvgDelay(AVG_SERVER_LAG_MS);
-			emulateRandomServerFailure(SERVER_FAILURE_PERCENT, /*throwRetry*/false);
+			emulateLatency();
+			emulateRandomServerFailure(/*throwRetry*/false);
 
 			{
 				std::lock_guard<std::mutex> lock(m_mockOrderLock);
-				for (auto it = m_mockTrackOrderList.begin(); it != m_mockTrackOrderList.end(); it++)
-				{
-					if (it->getId() == order.getId())
-					{
-						m_mockTrackOrderList.erase(it);
-						return;
-					}
-				}
+				m_engine.cancel(order.getId());
 			}
 		}
 
 		void updateBalanceImpl(Balance& balance) override final
 		{
-			sleepForAvgDelay(AVG_SERVER_LAG_MS);
-			emulateRandomServerFailure(SERVER_FAILURE_PERCENT, /*throwRetry*/true);
+			emulateLatency();
+			emulateRandomServerFailure(/*throwRetry*/true);
 
 			{
 				std::lock_guard<std::mutex> lock(m_mockOrderLock);
@@ -153,75 +158,70 @@ namespace Trader
 				{
 					IrStd::Threads::setActive();
 					std::lock_guard<std::mutex> lock(m_mockOrderLock);
-
-					// Add orders if some are pending
-					for (auto it = m_mockTrackOrderListLag.begin(); it != m_mockTrackOrderListLag.end();)
-					{
-						const auto curTimestamp = IrStd::Type::Timestamp::now();
-						const auto timestamp = it->getCreationTime();
-						if (curTimestamp > timestamp)
-						{
-							m_mockTrackOrderList.push_back(std::move(*it));
-							it = m_mockTrackOrderListLag.erase(it);
-						}
-						else
-						{
-							it++;
-						}
-					}
-
-					// Process the orders if they can be
-					for (auto it = m_mockTrackOrderList.begin(); it != m_mockTrackOrderList.end();)
-					{
-						const auto& order = it->getOrder();
-						const auto rate = order.getRate();
-						const auto transactionRate = order.getTransaction()->getRate();
-						if (rate <= transactionRate)
-						{
-							// Process the order
-							processOrder(order, it->getAmount());
-							it = m_mockTrackOrderList.erase(it);
-						}
-						else
-						{
-							it++;
-						}
-					}
+					matchOrders(this->getClock().now());
 				}
 			}
 		}
 
-		void processOrder(const Order& order, const IrStd::Type::Decimal amount)
+		/**
+		 * Match the order book against the current rates, must be called under m_mockOrderLock
+		 */
+		void matchOrders(const IrStd::Type::Timestamp timestamp)
 		{
-			IRSTD_LOG_INFO(IRSTD_TOPIC(Trader, Exchange, Mock), "Processing order "
-					<< order << " with amount " << amount << " and rate "
-					<< order.getTransaction()->getRate());
-
-			// Make sure there is enough funds in the balance
-			{
+			m_engine.match(timestamp, [this](const TrackOrder& track, const IrStd::Type::Decimal amount,
+					const IrStd::Type::Decimal finalAmount) {
+				const auto& order = track.getOrder();
+				IRSTD_LOG_INFO(IRSTD_TOPIC(Trader, Exchange, Mock), "Filling order #" << track.getId()
+						<< " " << order << " with amount " << amount << " (remaining " << (track.getAmount() - amount)
+						<< ") and rate " << order.getTransaction()->getRate());
+
+				// Make sure there is enough funds in the balance
 				const auto balanceAmount = m_mockBalance.get(order.getInitialCurrency());
 				if (balanceAmount < amount)
 				{
 					IRSTD_LOG_ERROR(IRSTD_TOPIC(Trader, Exchange, Mock), "Insufficient funds ("
 							<< balanceAmount << " " << order.getInitialCurrency() << "), cancel");
-					return;
+					return false;
 				}
-			}
 
-			m_mockBalance.add(order.getInitialCurrency(), -amount);
-			m_mockBalance.add(order.getFirstOrderFinalCurrency(), order.getFirstOrderFinalAmount(amount));
+				m_mockBalance.add(order.getInitialCurrency(), -amount);
+				m_mockBalance.add(order.getFirstOrderFinalCurrency(), finalAmount);
+				return true;
+			});
 		}
 
-		void sleepForAvgDelay(const size_t avgDelayMs) const noexcept
+		/**
+		 * Amount of \p currency worth \p value in the estimate currency
+		 */
+		IrStd::Type::Decimal valueToAmount(const CurrencyPtr currency, const IrStd::Type::Decimal value) const noexcept
 		{
-			IrStd::Rand rand;
-			const auto delayMs = rand.getNumber<size_t>(0, avgDelayMs * 2);
-			std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+			const auto unitValue = this->getEstimate(currency, 1);
+			if (unitValue <= 0)
+			{
+				return 0;
+			}
+			return value / unitValue;
 		}
 
-		void emulateRandomServerFailure(const size_t ratePercent, const bool throwRetry) const
+		void emulateLatency()
 		{
-			const auto serverFailure = (IrStd::Rand().getNumber<size_t>(0, 100) < ratePercent);
+			uint64_t delayMs;
+			{
+				std::lock_guard<std::mutex> lock(m_mockOrderLock);
+				delayMs = m_engine.drawLatencyMs();
+			}
+			this->getClock().wait(delayMs);
+		}
+
+		void emulateRandomServerFailure(const bool throwRetry)
+		{
+			bool serverFailure;
+			double ratePercent;
+			{
+				std::lock_guard<std::mutex> lock(m_mockOrderLock);
+				serverFailure = m_engine.drawFailure();
+				ratePercent = m_engine.getConfiguration().getFailurePercent();
+			}
 			if (serverFailure)
 			{
 				if (throwRetry)
@@ -239,8 +239,7 @@ namespace Trader
 
 		Balance m_mockBalance;
 		size_t m_id;
-		std::mutex m_mockOrderLock;
-		std::vector<TrackOrder> m_mockTrackOrderList;
-		std::vector<TrackOrder> m_mockTrackOrderListLag;
+		mutable std::mutex m_mockOrderLock;
+		MatchingEngine m_engine;
 	};
 }
@@ -1,5 +1,6 @@
 #include "Operation.hpp"
 #include "Trader/Manager/Manager.hpp"
+#include "Trader/Generic/Writer/AsyncWriter.hpp"
 
 IRSTD_TOPIC_REGISTER(Trader, Operation);
 
@@ -22,14 +23,17 @@ Trader::Operation::Operation(
 }
 
 void Trader::Operation::recordTransaction(
-		ContextHandle& /*contextProceed*/,
+		ContextHandle& contextProceed,
 		const TrackOrder& trackProceed,
 		const IrStd::Type::Decimal amountProceed)
 {
-	static std::mutex mutex;
-	std::lock_guard<std::mutex> lock(mutex);
+	const auto& directory = contextProceed.cast<Trader::OperationContext>()->getRecordDirectory();
+	if (directory.empty())
+	{
+		return;
+	}
 
-	// Open the file and populate it with the data
+	// Queue the data to the file, the writer thread does the actual write
 	// Format:
 	// - Timestamp now
 	// - Creation timestamp
@@ -42,10 +46,9 @@ void Trader::Operation::recordTransaction(
 	// - Fee
 	{
 		const auto finalAmount = trackProceed.getOrder().getFirstOrderFinalAmount(amountProceed);
-		std::string path = Trader::Manager::getGlobalOutputDirectory();
+		std::string path = directory;
 		IrStd::FileSystem::append(path, "transactions.csv");
-		IrStd::FileSystem::FileCsv file(path);
-		file.write(static_cast<uint64_t>(IrStd::Type::Timestamp::now()),
+		AsyncWriter::getDefault().writeCsv(path, static_cast<uint64_t>(Clock::getDefault()->now()),
 				static_cast<uint64_t>(trackProceed.getCreationTime()),
 				trackProceed.getId(),
 				trackProceed.getTypeToString(),
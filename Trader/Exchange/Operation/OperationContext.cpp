@@ -1,15 +1,39 @@
 #include "Trader/Exchange/Operation/OperationContext.hpp"
 #include "Trader/Strategy/Strategy.hpp"
+#include "Trader/Manager/Manager.hpp"
 
 // ---- Trader::OperationContext ----------------------------------------------
 
 Trader::OperationContext::OperationContext(const Strategy& strategy)
 		: m_strategyId(strategy.getId())
+		, m_recordDirectory(strategy.getRecordDirectory())
 		, m_failureCause(FailureCause::NONE)
 		, m_profitRatio(0)
 {
 }
 
+Trader::OperationContext::OperationContext(
+		const Id strategyId,
+		Journal::Decoder& decoder)
+		: m_strategyId(strategyId)
+		, m_recordDirectory(Manager::getGlobalOutputDirectory())
+		, m_failureCause(FailureCause::NONE)
+		, m_profitRatio(0)
+{
+	m_description = decoder.getString();
+	m_failureCause = static_cast<FailureCause>(decoder.getU8());
+	m_profitRatio = decoder.getDecimal();
+	const size_t nbProfits = decoder.getU64();
+	for (size_t i = 0; i < nbProfits; ++i)
+	{
+		const size_t ordinal = decoder.getU64();
+		IRSTD_THROW_ASSERT(IRSTD_TOPIC(Trader, Journal), ordinal < Currency::NB_CURRENCIES, "Invalid currency ordinal: " << ordinal);
+		Profit& profit = m_profitMap[Currency::fromOrdinal(ordinal)];
+		profit.m_fixed = decoder.getDecimal();
+		profit.m_accumulated = decoder.getDecimal();
+	}
+}
+
 Trader::OperationContext::~OperationContext()
 {
 	IRSTD_LOG_INFO(m_description);
@@ -22,11 +46,31 @@ void Trader::OperationContext::toStream(std::ostream& os) const
 	os << ", " << m_description;
 }
 
+void Trader::OperationContext::encode(Journal::Encoder& encoder) const
+{
+	auto scope = m_lock.readScope();
+	encoder.putString(m_description);
+	encoder.putU8(static_cast<uint8_t>(m_failureCause));
+	encoder.putDecimal(m_profitRatio);
+	encoder.putU64(m_profitMap.size());
+	for (const auto& it : m_profitMap)
+	{
+		encoder.putU64(it.first->getOrdinal());
+		encoder.putDecimal(it.second.m_fixed);
+		encoder.putDecimal(it.second.m_accumulated);
+	}
+}
+
 Trader::Id Trader::OperationContext::getStrategyId() const noexcept
 {
 	return m_strategyId;
 }
 
+const std::string& Trader::OperationContext::getRecordDirectory() const noexcept
+{
+	return m_recordDirectory;
+}
+
 void Trader::OperationContext::setProfit(const CurrencyPtr currency, const IrStd::Type::Decimal profit) noexcept
 {
 	auto scope = m_lock.writeScope();
@@ -6,6 +6,7 @@
 #include "Trader/Generic/Event/Context.hpp"
 #include "Trader/Generic/Event/EventContainer.hpp"
 #include "Trader/Exchange/Currency/Currency.hpp"
+#include "Trader/Generic/Journal/Journal.hpp"
 
 namespace Trader
 {
@@ -14,6 +15,8 @@ namespace Trader
 	class Strategy;
 	class OperationContext : public Context
 	{
+		TRADER_CONTEXT_TYPE(OperationContext, Context)
+
 	public:
 		typedef std::function<void(const OperationContext&)> CompleteCallback;
 
@@ -25,8 +28,17 @@ namespace Trader
 		};
 
 		OperationContext(const Strategy& strategy);
+		/**
+		 * Restore a context previously serialized with encode()
+		 */
+		OperationContext(const Id strategyId, Journal::Decoder& decoder);
 		virtual ~OperationContext();
 
+		/**
+		 * Serialize the state of the context, this does not include the callbacks
+		 */
+		void encode(Journal::Encoder& encoder) const;
+
 		void toStream(std::ostream& os) const override;
 
 		/**
@@ -34,6 +46,12 @@ namespace Trader
 		 */
 		Id getStrategyId() const noexcept;
 
+		/**
+		 * Directory where the transactions of this operation are recorded,
+		 * empty if they are not recorded
+		 */
+		const std::string& getRecordDirectory() const noexcept;
+
 		/**
 		 * Return the current profit of the context
 		 */
@@ -94,6 +112,7 @@ namespace Trader
 		void setFailureCause(const FailureCause cause) noexcept;
 
 		const Id m_strategyId;
+		const std::string m_recordDirectory;
 
 		// Monitor the failure
 		FailureCause m_failureCause;
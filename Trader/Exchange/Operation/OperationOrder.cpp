@@ -11,6 +11,8 @@ namespace
 {
 	class ContextMonitorProfit : public Trader::OperationContext
 	{
+		TRADER_CONTEXT_TYPE(ContextMonitorProfit, Trader::OperationContext)
+
 	public:
 		ContextMonitorProfit(
 			const Trader::CurrencyPtr initialCurrency,
@@ -180,7 +182,8 @@ Trader::OperationOrder::OperationOrder(
 	const Order& order,
 	const IrStd::Type::Decimal amount,
 	const Strategy& strategy)
-		: Operation(order, amount, Context::create<::ContextMonitorProfit>(order.getInitialCurrency(), amount, strategy).cast<OperationContext>())
+		: Operation(order, amount, strategy.getContextPool().create<::ContextMonitorProfit>(
+				order.getInitialCurrency(), amount, strategy).cast<OperationContext>())
 {
 	onOrderComplete("monitorProfit", Trader::OperationOrder::monitorProfit, EventManager::Lifetime::OPERATION);
 }
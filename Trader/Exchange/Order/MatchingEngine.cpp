@@ -0,0 +1,273 @@
+#include <algorithm>
+
+#include "Trader/Exchange/Order/MatchingEngine.hpp"
+
+IRSTD_TOPIC_USE_ALIAS(TraderExchangeMock, Trader, Exchange, Mock);
+
+// ---- Trader::MatchingEngine::Statistics ------------------------------------
+
+void Trader::MatchingEngine::Statistics::toStream(std::ostream& os) const
+{
+	os << "orders=" << m_nbOrders << ", fills=" << m_nbFills << " (partial=" << m_nbPartialFills
+			<< ", taker=" << m_nbTakerFills << "), cancels=" << m_nbCancels
+			<< ", avgLatency=" << ((m_nbOrders) ? m_totalLatencyMs / m_nbOrders : 0)
+			<< "ms, avgTimeToFill=" << ((m_nbFilledOrders) ? m_totalTimeToFillMs / m_nbFilledOrders : 0) << "ms";
+}
+
+std::ostream& operator<<(std::ostream& os, const Trader::MatchingEngine::Statistics& statistics)
+{
+	statistics.toStream(os);
+	return os;
+}
+
+// ---- Trader::MatchingEngine ------------------------------------------------
+
+Trader::MatchingEngine::MatchingEngine(
+		ConfigurationMock&& config,
+		const ValueToAmount& valueToAmount)
+		: m_config(std::move(config))
+		, m_valueToAmount(valueToAmount)
+		, m_sequence(0)
+		, m_statistics()
+{
+	seed();
+}
+
+void Trader::MatchingEngine::setConfiguration(ConfigurationMock&& config)
+{
+	m_config = std::move(config);
+	seed();
+}
+
+void Trader::MatchingEngine::seed()
+{
+	const uint64_t seed = m_config.getSeed();
+	m_generator.seed((seed) ? seed : std::random_device()());
+}
+
+const Trader::ConfigurationMock& Trader::MatchingEngine::getConfiguration() const noexcept
+{
+	return m_config;
+}
+
+uint64_t Trader::MatchingEngine::drawLatencyMs()
+{
+	const double meanMs = m_config.getLatencyMeanMs();
+	const double jitterMs = m_config.getLatencyJitterMs();
+	double latencyMs = meanMs;
+
+	switch (m_config.getLatencyDistribution())
+	{
+	case ConfigurationMock::LatencyDistribution::CONSTANT:
+		break;
+	case ConfigurationMock::LatencyDistribution::UNIFORM:
+		latencyMs = std::uniform_real_distribution<double>(std::max(meanMs - jitterMs, 0.), meanMs + jitterMs)(m_generator);
+		break;
+	case ConfigurationMock::LatencyDistribution::EXPONENTIAL:
+		if (meanMs > 0)
+		{
+			latencyMs = std::exponential_distribution<double>(1. / meanMs)(m_generator);
+		}
+		break;
+	case ConfigurationMock::LatencyDistribution::NORMAL:
+		if (jitterMs > 0)
+		{
+			latencyMs = std::normal_distribution<double>(meanMs, jitterMs)(m_generator);
+		}
+		break;
+	default:
+		IRSTD_UNREACHABLE(TraderExchangeMock);
+	}
+
+	return static_cast<uint64_t>(std::max(latencyMs, 0.));
+}
+
+bool Trader::MatchingEngine::drawFailure()
+{
+	const double failurePercent = m_config.getFailurePercent();
+	return (failurePercent > 0 && std::uniform_real_distribution<double>(0, 100)(m_generator) < failurePercent);
+}
+
+void Trader::MatchingEngine::add(
+		const TrackOrder& track,
+		const IrStd::Type::Timestamp timestamp)
+{
+	const auto latencyMs = drawLatencyMs();
+	m_entryList.push_back(Entry{track, timestamp + latencyMs, m_sequence++, /*isInBook*/false,
+			/*isTaker*/false, /*queueAhead*/0});
+	m_statistics.m_nbOrders++;
+	m_statistics.m_totalLatencyMs += latencyMs;
+}
+
+bool Trader::MatchingEngine::cancel(const Id id)
+{
+	for (auto it = m_entryList.begin(); it != m_entryList.end(); ++it)
+	{
+		if (it->m_track.getId() == id)
+		{
+			m_entryList.erase(it);
+			m_statistics.m_nbCancels++;
+			return true;
+		}
+	}
+	return false;
+}
+
+void Trader::MatchingEngine::enterBook(Entry& entry)
+{
+	const auto& order = entry.m_track.getOrder();
+	entry.m_isInBook = true;
+	// An order crossing the market is filled without waiting in the queue
+	entry.m_isTaker = (entry.m_track.getRate() <= order.getTransaction()->getRate());
+	entry.m_queueAhead = 0;
+	if (!entry.m_isTaker && m_config.getQueueAheadValue() > 0)
+	{
+		entry.m_queueAhead = m_valueToAmount(order.getInitialCurrency(), m_config.getQueueAheadValue());
+	}
+}
+
+IrStd::Type::Decimal Trader::MatchingEngine::getFinalAmount(
+		const Entry& entry,
+		const IrStd::Type::Decimal amount) const noexcept
+{
+	const auto& order = entry.m_track.getOrder();
+	const double feePercent = (entry.m_isTaker) ? m_config.getFeeTakerPercent() : m_config.getFeeMakerPercent();
+	if (feePercent < 0)
+	{
+		return order.getFirstOrderFinalAmount(amount);
+	}
+	return order.getFirstOrderFinalAmount(amount, /*includeFee*/false) * IrStd::Type::Decimal(1. - feePercent / 100.);
+}
+
+void Trader::MatchingEngine::match(
+		const IrStd::Type::Timestamp timestamp,
+		const FillCallback& fill)
+{
+	// Group the orders of the book per pair, in order of submission to be deterministic
+	std::vector<std::pair<const Transaction*, std::vector<Entry*>>> bookList;
+	for (auto& entry : m_entryList)
+	{
+		if (!entry.m_isInBook && entry.m_arrivalTime <= timestamp)
+		{
+			enterBook(entry);
+		}
+		if (entry.m_isInBook)
+		{
+			const auto pTransaction = entry.m_track.getOrder().getTransaction();
+			auto it = std::find_if(bookList.begin(), bookList.end(),
+					[&](const std::pair<const Transaction*, std::vector<Entry*>>& book) {
+				return book.first == pTransaction;
+			});
+			if (it == bookList.end())
+			{
+				bookList.push_back({pTransaction, {}});
+				it = bookList.end() - 1;
+			}
+			it->second.push_back(&entry);
+		}
+	}
+
+	const bool isUnlimited = (m_config.getLiquidityPerUpdateValue() <= 0);
+	for (auto& book : bookList)
+	{
+		// Price-time priority, the lowest rate asked is the most aggressive
+		std::sort(book.second.begin(), book.second.end(), [](const Entry* pEntry1, const Entry* pEntry2) {
+			if (pEntry1->m_track.getRate() != pEntry2->m_track.getRate())
+			{
+				return pEntry1->m_track.getRate() < pEntry2->m_track.getRate();
+			}
+			return pEntry1->m_sequence < pEntry2->m_sequence;
+		});
+
+		const auto marketRate = book.first->getRate();
+		IrStd::Type::Decimal liquidity = 0;
+		if (!isUnlimited)
+		{
+			liquidity = m_valueToAmount(book.first->getInitialCurrency(), m_config.getLiquidityPerUpdateValue());
+		}
+
+		for (auto pEntry : book.second)
+		{
+			const auto rate = pEntry->m_track.getRate();
+			if (rate > marketRate)
+			{
+				break;
+			}
+
+			// The market traded through this price level, the queue is gone
+			if (rate < marketRate)
+			{
+				pEntry->m_queueAhead = 0;
+			}
+
+			const auto remainingAmount = pEntry->m_track.getAmount();
+			IrStd::Type::Decimal amount = remainingAmount;
+			if (!isUnlimited)
+			{
+				if (pEntry->m_queueAhead > liquidity)
+				{
+					pEntry->m_queueAhead -= liquidity;
+					break;
+				}
+				liquidity -= pEntry->m_queueAhead;
+				pEntry->m_queueAhead = 0;
+				if (amount > liquidity)
+				{
+					amount = liquidity;
+				}
+				liquidity -= amount;
+			}
+			if (amount <= 0)
+			{
+				break;
+			}
+
+			const bool isCompleted = (amount >= remainingAmount);
+			m_statistics.m_nbFills++;
+			m_statistics.m_nbPartialFills += (isCompleted) ? 0 : 1;
+			m_statistics.m_nbTakerFills += (pEntry->m_isTaker) ? 1 : 0;
+
+			if (!fill(pEntry->m_track, amount, getFinalAmount(*pEntry, amount)))
+			{
+				m_statistics.m_nbCancels++;
+				pEntry->m_track.setAmount(0);
+			}
+			else if (isCompleted)
+			{
+				m_statistics.m_nbFilledOrders++;
+				m_statistics.m_totalTimeToFillMs += timestamp - pEntry->m_track.getCreationTime();
+				pEntry->m_track.setAmount(0);
+			}
+			else
+			{
+				pEntry->m_track.setAmount(remainingAmount - amount);
+			}
+		}
+	}
+
+	// Remove the orders completed or canceled
+	m_entryList.erase(std::remove_if(m_entryList.begin(), m_entryList.end(), [](const Entry& entry) {
+		return entry.m_isInBook && entry.m_track.getAmount() <= 0;
+	}), m_entryList.end());
+}
+
+void Trader::MatchingEngine::each(const std::function<void(const TrackOrder&)>& callback) const
+{
+	for (const auto& entry : m_entryList)
+	{
+		if (entry.m_isInBook)
+		{
+			callback(entry.m_track);
+		}
+	}
+}
+
+size_t Trader::MatchingEngine::size() const noexcept
+{
+	return m_entryList.size();
+}
+
+const Trader::MatchingEngine::Statistics& Trader::MatchingEngine::getStatistics() const noexcept
+{
+	return m_statistics;
+}
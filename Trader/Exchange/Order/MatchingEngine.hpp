@@ -0,0 +1,119 @@
+#pragma once
+
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "Trader/Exchange/ConfigurationMock.hpp"
+#include "Trader/Exchange/Order/TrackOrder.hpp"
+
+namespace Trader
+{
+	/**
+	 * Simulated order book with price-time priority, used to emulate the server side of an exchange.
+	 * The book only contains the orders placed through the simulation, the rest of the market is
+	 * modeled by the rates, a queue ahead of each new order and a liquidity traded per rate update.
+	 *
+	 * \note This class is not thread safe.
+	 */
+	class MatchingEngine
+	{
+	public:
+		/**
+		 * Convert a value expressed in the estimate currency into an amount of \p currency
+		 */
+		typedef std::function<IrStd::Type::Decimal(const CurrencyPtr currency, const IrStd::Type::Decimal value)> ValueToAmount;
+
+		/**
+		 * Called for each fill, \p amount is in the initial currency of the order and \p finalAmount
+		 * in its final currency (fee included). If it returns false, the order is canceled.
+		 */
+		typedef std::function<bool(const TrackOrder& track, const IrStd::Type::Decimal amount,
+				const IrStd::Type::Decimal finalAmount)> FillCallback;
+
+		struct Statistics
+		{
+			size_t m_nbOrders;
+			size_t m_nbCancels;
+			size_t m_nbFills;
+			size_t m_nbPartialFills;
+			size_t m_nbTakerFills;
+			size_t m_nbFilledOrders;
+			uint64_t m_totalLatencyMs;
+			uint64_t m_totalTimeToFillMs;
+
+			void toStream(std::ostream& os) const;
+		};
+
+		MatchingEngine(ConfigurationMock&& config, const ValueToAmount& valueToAmount);
+
+		/**
+		 * Change the configuration, this also resets the random generator
+		 */
+		void setConfiguration(ConfigurationMock&& config);
+		const ConfigurationMock& getConfiguration() const noexcept;
+
+		/**
+		 * Draw a server latency from the configured distribution
+		 */
+		uint64_t drawLatencyMs();
+
+		/**
+		 * Tells if the next API call must fail
+		 */
+		bool drawFailure();
+
+		/**
+		 * Submit an order, it reaches the book after a drawn latency
+		 */
+		void add(const TrackOrder& track, const IrStd::Type::Timestamp timestamp);
+
+		/**
+		 * Remove an order from the book
+		 */
+		bool cancel(const Id id);
+
+		/**
+		 * Match the orders of the book against the current rates
+		 */
+		void match(const IrStd::Type::Timestamp timestamp, const FillCallback& fill);
+
+		/**
+		 * Loop through the orders in the book, with their remaining amount
+		 */
+		void each(const std::function<void(const TrackOrder&)>& callback) const;
+
+		/**
+		 * Number of orders submitted, in the book or not yet
+		 */
+		size_t size() const noexcept;
+
+		const Statistics& getStatistics() const noexcept;
+
+	private:
+		struct Entry
+		{
+			TrackOrder m_track;
+			IrStd::Type::Timestamp m_arrivalTime;
+			size_t m_sequence;
+			bool m_isInBook;
+			// Taker orders were crossing the market when reaching the book
+			bool m_isTaker;
+			// Amount of the initial currency to be traded before this order
+			IrStd::Type::Decimal m_queueAhead;
+		};
+
+		void seed();
+		void enterBook(Entry& entry);
+		IrStd::Type::Decimal getFinalAmount(const Entry& entry, const IrStd::Type::Decimal amount) const noexcept;
+
+		ConfigurationMock m_config;
+		const ValueToAmount m_valueToAmount;
+		std::mt19937_64 m_generator;
+		std::vector<Entry> m_entryList;
+		size_t m_sequence;
+		Statistics m_statistics;
+	};
+}
+
+std::ostream& operator<<(std::ostream& os, const Trader::MatchingEngine::Statistics& statistics);
@@ -4,6 +4,7 @@
 
 #include "Trader/Exchange/Order/Order.hpp"
 #include "Trader/Exchange/Balance/Balance.hpp"
+#include "Trader/Generic/Clock/Clock.hpp"
 #include "Trader/Generic/Event/Context.hpp"
 #include "Trader/Generic/Id/Id.hpp"
 
@@ -13,7 +14,7 @@ namespace Trader
 	{
 	public:
 		TrackOrder(const Id id, const Order& order, const IrStd::Type::Decimal amount,
-				const IrStd::Type::Timestamp creationTime = IrStd::Type::Timestamp::now())
+				const IrStd::Type::Timestamp creationTime = Clock::getDefault()->now())
 				: m_id(id)
 				, m_order(order)
 				, m_type(identifyOrderType(order))
@@ -27,12 +28,12 @@ namespace Trader
 		}
 
 		TrackOrder(const Id id, std::shared_ptr<Transaction> transaction, const IrStd::Type::Decimal rate,
-				const IrStd::Type::Decimal amount, const IrStd::Type::Timestamp timestamp = IrStd::Type::Timestamp::now())
+				const IrStd::Type::Decimal amount, const IrStd::Type::Timestamp timestamp = Clock::getDefault()->now())
 				: TrackOrder(id, Order{transaction, rate}, amount, timestamp)
 		{
 		}
 
-		TrackOrder(const Order& order, const IrStd::Type::Decimal amount, const IrStd::Type::Timestamp timestamp = IrStd::Type::Timestamp::now())
+		TrackOrder(const Order& order, const IrStd::Type::Decimal amount, const IrStd::Type::Timestamp timestamp = Clock::getDefault()->now())
 				: TrackOrder(Trader::Id::unique(), order, amount, timestamp)
 		{
 		}
@@ -2,7 +2,9 @@
 
 #include "Trader/Generic/Event/Context.hpp"
 #include "Trader/Exchange/Order/TrackOrderList.hpp"
+#include "Trader/Exchange/Operation/OperationContext.hpp"
 #include "Trader/Strategy/Strategy.hpp"
+#include "Trader/Generic/Log/AsyncLog.hpp"
 
 IRSTD_TOPIC_USE_ALIAS(TraderTrackOrder, Trader, TrackOrder);
 
@@ -42,7 +44,7 @@ void Trader::TrackOrderList::TrackOrderEntry::matchTrackOrder(const TrackOrder&
 	m_trackOrder.setCreationTime(trackOrder.getCreationTime());
 	m_trackOrder.getOrderForWrite().setRate(trackOrder.getOrder().getRate());
 
-	IRSTD_LOG_DEBUG(TraderTrackOrder, "Matching " << trackOrder << " -> " << m_trackOrder);
+	TRADER_LOG_DEBUG(TraderTrackOrder, "Matching " << trackOrder << " -> " << m_trackOrder);
 }
 
 bool Trader::TrackOrderList::TrackOrderEntry::operator==(const TrackOrderEntry& entry) const noexcept
@@ -120,6 +122,167 @@ std::pair<IrStd::Type::Decimal, IrStd::Type::Decimal> Trader::TrackOrderList::Tr
 	return std::make_pair(initialAmountDiff, finalAmountDiff);
 }
 
+// ---- Trader::TrackOrderList::TrackOrderEntry (journal) ---------------------
+
+namespace
+{
+	// How the context of an entry is serialized
+	enum class JournalContext : uint8_t
+	{
+		NONE = 0,
+		CONTEXT,
+		OPERATION
+	};
+}
+
+void Trader::TrackOrderList::TrackOrderEntry::encode(Journal::Encoder& encoder) const
+{
+	encoder.putString(m_trackOrder.getId().c_str());
+	encoder.putDecimal(m_trackOrder.getAmount());
+	encoder.putU64(static_cast<uint64_t>(m_trackOrder.getCreationTime()));
+	encoder.putU8(static_cast<uint8_t>(m_type));
+	encoder.putU8(static_cast<uint8_t>(m_cancelCause));
+	encoder.putU64(static_cast<uint64_t>(m_cancelTimestamp));
+	encoder.putU64(static_cast<uint64_t>(m_activatedTimestamp));
+
+	// The order chain
+	size_t nbOrders = 0;
+	for (const Order* pOrder = &m_trackOrder.getOrder(); pOrder; pOrder = pOrder->getNext())
+	{
+		++nbOrders;
+	}
+	encoder.putU64(nbOrders);
+	for (const Order* pOrder = &m_trackOrder.getOrder(); pOrder; pOrder = pOrder->getNext())
+	{
+		encoder.putU64(pOrder->getInitialCurrency()->getOrdinal());
+		encoder.putU64(pOrder->getFirstOrderFinalCurrency()->getOrdinal());
+		encoder.putU8(pOrder->isFixedRate());
+		encoder.putDecimal(pOrder->getRate());
+		encoder.putU64(pOrder->getTimeout());
+	}
+
+	// The context
+	const auto context = m_trackOrder.getContext();
+	if (!context)
+	{
+		encoder.putU8(static_cast<uint8_t>(JournalContext::NONE));
+	}
+	else if (context->getType().isA(OperationContext::getContextType()))
+	{
+		const auto operationContext = context.cast<OperationContext>();
+		Journal::Encoder state;
+		operationContext->encode(state);
+
+		encoder.putU8(static_cast<uint8_t>(JournalContext::OPERATION));
+		encoder.putU64(context->getId());
+		encoder.putString(operationContext->getStrategyId().c_str());
+		encoder.putString(state.get());
+	}
+	else
+	{
+		encoder.putU8(static_cast<uint8_t>(JournalContext::CONTEXT));
+		encoder.putU64(context->getId());
+	}
+}
+
+Trader::TrackOrderList::TrackOrderEntry Trader::TrackOrderList::TrackOrderEntry::decode(
+		Journal::Decoder& decoder,
+		const TransactionResolver& getTransaction,
+		std::map<size_t, ContextHandle>& contextMap)
+{
+	const Id id(decoder.getString().c_str());
+	const IrStd::Type::Decimal amount = decoder.getDecimal();
+	const IrStd::Type::Timestamp creationTime(decoder.getU64());
+	const Type type = static_cast<Type>(decoder.getU8());
+	const RemoveCause cancelCause = static_cast<RemoveCause>(decoder.getU8());
+	const IrStd::Type::Timestamp cancelTimestamp(decoder.getU64());
+	const IrStd::Type::Timestamp activatedTimestamp(decoder.getU64());
+
+	// Rebuild the order chain
+	const size_t nbOrders = decoder.getU64();
+	IRSTD_THROW_ASSERT(TraderTrackOrder, nbOrders > 0, "The order #" << id << " has no order");
+	Order order;
+	IrStd::Type::Decimal rate = 0;
+	for (size_t i = 0; i < nbOrders; ++i)
+	{
+		const size_t initialOrdinal = decoder.getU64();
+		const size_t finalOrdinal = decoder.getU64();
+		const bool isFixedRate = (decoder.getU8() != 0);
+		const IrStd::Type::Decimal linkRate = decoder.getDecimal();
+		const size_t timeoutS = decoder.getU64();
+
+		IRSTD_THROW_ASSERT(TraderTrackOrder, initialOrdinal < Currency::NB_CURRENCIES
+				&& finalOrdinal < Currency::NB_CURRENCIES, "Invalid currencies for the order #" << id);
+		const auto initialCurrency = Currency::fromOrdinal(initialOrdinal);
+		const auto finalCurrency = Currency::fromOrdinal(finalOrdinal);
+		auto pTransaction = getTransaction(initialCurrency, finalCurrency);
+		IRSTD_THROW_ASSERT(TraderTrackOrder, pTransaction, "No transaction " << initialCurrency
+				<< " -> " << finalCurrency << " for the order #" << id);
+
+		Order link(pTransaction);
+		link.setTimeout(timeoutS);
+		if (isFixedRate)
+		{
+			link.setRate(linkRate);
+		}
+
+		if (i == 0)
+		{
+			order = std::move(link);
+			rate = linkRate;
+		}
+		else
+		{
+			order.addNext(link);
+		}
+	}
+
+	TrackOrder trackOrder(id, order, amount, creationTime);
+	// The constructor raises the rate to the current one, restore the original
+	trackOrder.getOrderForWrite().setRate(rate);
+
+	// Restore the context, shared with the other orders of the same operation
+	const JournalContext contextType = static_cast<JournalContext>(decoder.getU8());
+	switch (contextType)
+	{
+	case JournalContext::NONE:
+		break;
+	case JournalContext::CONTEXT:
+		{
+			const size_t contextId = decoder.getU64();
+			if (!contextMap[contextId])
+			{
+				contextMap[contextId] = Context::create<Context>();
+			}
+			trackOrder.setContext(contextMap[contextId]);
+		}
+		break;
+	case JournalContext::OPERATION:
+		{
+			const size_t contextId = decoder.getU64();
+			const Id strategyId(decoder.getString().c_str());
+			const std::string state = decoder.getString();
+			if (!contextMap[contextId])
+			{
+				Journal::Decoder stateDecoder(state);
+				contextMap[contextId] = Context::create<OperationContext>(strategyId, stateDecoder);
+			}
+			trackOrder.setContext(contextMap[contextId]);
+		}
+		break;
+	default:
+		IRSTD_THROW(TraderTrackOrder, "Invalid context type for the order #" << id);
+	}
+
+	TrackOrderEntry entry(trackOrder, /*isPlaceHolder*/true);
+	entry.m_type = type;
+	entry.m_cancelCause = cancelCause;
+	entry.m_cancelTimestamp = cancelTimestamp;
+	entry.m_activatedTimestamp = activatedTimestamp;
+
+	return entry;
+}
+
 // ---- Trader::TrackOrderList::TrackOrderEntry (cancel) ----------------------
 
 void Trader::TrackOrderList::TrackOrderEntry::setCancel(
@@ -248,8 +411,10 @@ void Trader::TrackOrderList::TrackOrderEntry::toStream(std::ostream& out) const
 
 Trader::TrackOrderList::TrackOrderList(
 	EventManager& eventManager,
-	const size_t timeoutOrderRegisteredMs)
+	const size_t timeoutOrderRegisteredMs,
+	std::shared_ptr<const Clock> pClock)
 		: m_eventManager(eventManager)
+		, m_pClock(pClock)
 		, m_timeoutOrderRegisteredMs(timeoutOrderRegisteredMs)
 		, m_isUpdated(false)
 		, m_timestampUnsync{0, 0}
@@ -257,6 +422,83 @@ Trader::TrackOrderList::TrackOrderList(
 	initialize(/*keepOrders*/false);
 }
 
+void Trader::TrackOrderList::setClock(std::shared_ptr<const Clock> pClock) noexcept
+{
+	m_pClock = pClock;
+}
+
+void Trader::TrackOrderList::setJournal(std::shared_ptr<Journal> pJournal) noexcept
+{
+	auto scope = m_lockOrders.writeScope();
+	m_pJournal = pJournal;
+}
+
+std::vector<Trader::TrackOrder> Trader::TrackOrderList::restore(
+		std::shared_ptr<Journal> pJournal,
+		const TransactionResolver& getTransaction)
+{
+	auto scope = m_lockOrders.writeScope();
+
+	// Replay the journal without logging the changes
+	m_pJournal = nullptr;
+	clearEntriesNoLock();
+
+	std::map<size_t, ContextHandle> contextMap;
+	size_t nbDropped = 0;
+	const size_t nbRecords = pJournal->replay([&](const Journal::RecordType type, Journal::Decoder& decoder) {
+		switch (static_cast<JournalRecord>(type))
+		{
+		case JournalRecord::UPSERT:
+			try
+			{
+				auto entry = TrackOrderEntry::decode(decoder, getTransaction, contextMap);
+				auto it = getById(entry.getTrackOrder().getId());
+				if (it != m_list.end())
+				{
+					eraseEntryNoLock(it);
+				}
+				pushEntryNoLock(std::move(entry));
+			}
+			catch (const IrStd::Exception& e)
+			{
+				TRADER_LOG_WARNING(TraderTrackOrder, "Cannot restore an order from the journal: " << e);
+				++nbDropped;
+			}
+			break;
+		case JournalRecord::ERASE:
+			{
+				const Id id(decoder.getString().c_str());
+				auto it = getById(id);
+				if (it != m_list.end())
+				{
+					eraseEntryNoLock(it);
+				}
+			}
+			break;
+		case JournalRecord::CLEAR:
+			clearEntriesNoLock();
+			break;
+		default:
+			TRADER_LOG_WARNING(TraderTrackOrder, "Unknown journal record type " << static_cast<size_t>(type));
+		}
+	});
+
+	// Compact the journal to the current state
+	m_pJournal = pJournal;
+	m_pJournal->checkpoint(snapshotNoLock());
+
+	std::vector<TrackOrder> list;
+	for (const auto& entry : m_list)
+	{
+		list.push_back(entry.getTrackOrder());
+	}
+
+	IRSTD_LOG_INFO(TraderTrackOrder, "Restored " << list.size() << " order(s) from " << nbRecords
+			<< " journal record(s), " << nbDropped << " dropped");
+
+	return list;
+}
+
 void Trader::TrackOrderList::initialize(const bool keepOrders)
 {
 	auto scope = m_lockOrders.writeScope();
@@ -267,11 +509,12 @@ void Trader::TrackOrderList::initialize(const bool keepOrders)
 		for (auto& elt : m_list)
 		{
 			elt.setActivatedPlaceHolder();
+			journalUpsertNoLock(elt);
 		}
 	}
 	else
 	{
-		m_list.clear();
+		clearEntriesNoLock();
 	}
 }
 
@@ -294,6 +537,178 @@ std::vector<Trader::TrackOrderList::TrackOrderEntry>::iterator Trader::TrackOrde
 	return m_list.end();
 }
 
+// ---- Trader::TrackOrderList (ledger) ---------------------------------------
+
+void Trader::TrackOrderList::pushEntryNoLock(TrackOrderEntry&& entry)
+{
+	IRSTD_ASSERT(TraderTrackOrder, m_lockOrders.isWriteScope(), "This operation is only valid under a write scope");
+	updateLedgerNoLock(entry, /*isAdd*/true);
+	journalUpsertNoLock(entry);
+	m_list.push_back(std::move(entry));
+}
+
+void Trader::TrackOrderList::eraseEntryNoLock(const std::vector<TrackOrderEntry>::iterator it) noexcept
+{
+	IRSTD_ASSERT(TraderTrackOrder, m_lockOrders.isWriteScope(), "This operation is only valid under a write scope");
+	updateLedgerNoLock(*it, /*isAdd*/false);
+	journalEraseNoLock(it->getTrackOrder().getId());
+	m_list.erase(it);
+}
+
+void Trader::TrackOrderList::clearEntriesNoLock() noexcept
+{
+	IRSTD_ASSERT(TraderTrackOrder, m_lockOrders.isWriteScope(), "This operation is only valid under a write scope");
+	m_list.clear();
+	journalClearNoLock();
+	for (auto& ledger : m_ledgerList)
+	{
+		ledger = Ledger{0, 0, 0, 0};
+	}
+}
+
+void Trader::TrackOrderList::journalUpsertNoLock(const TrackOrderEntry& entry) noexcept
+{
+	if (m_pJournal)
+	{
+		try
+		{
+			Journal::Encoder encoder;
+			entry.encode(encoder);
+			m_pJournal->append(static_cast<Journal::RecordType>(JournalRecord::UPSERT), encoder);
+		}
+		catch (const IrStd::Exception& e)
+		{
+			TRADER_LOG_ERROR(TraderTrackOrder, "Cannot journal the order " << entry.getTrackOrder().getId() << ": " << e);
+		}
+		catch (const std::exception& e)
+		{
+			TRADER_LOG_ERROR(TraderTrackOrder, "Cannot journal the order " << entry.getTrackOrder().getId() << ": " << e.what());
+		}
+	}
+}
+
+void Trader::TrackOrderList::journalEraseNoLock(const Id id) noexcept
+{
+	if (m_pJournal)
+	{
+		try
+		{
+			Journal::Encoder encoder;
+			encoder.putString(id.c_str());
+			m_pJournal->append(static_cast<Journal::RecordType>(JournalRecord::ERASE), encoder);
+		}
+		catch (const IrStd::Exception& e)
+		{
+			TRADER_LOG_ERROR(TraderTrackOrder, "Cannot journal the removal of the order " << id << ": " << e);
+		}
+		catch (const std::exception& e)
+		{
+			TRADER_LOG_ERROR(TraderTrackOrder, "Cannot journal the removal of the order " << id << ": " << e.what());
+		}
+	}
+}
+
+void Trader::TrackOrderList::journalClearNoLock() noexcept
+{
+	if (m_pJournal)
+	{
+		try
+		{
+			m_pJournal->append(static_cast<Journal::RecordType>(JournalRecord::CLEAR), Journal::Encoder());
+		}
+		catch (const IrStd::Exception& e)
+		{
+			TRADER_LOG_ERROR(TraderTrackOrder, "Cannot journal the removal of all orders: " << e);
+		}
+		catch (const std::exception& e)
+		{
+			TRADER_LOG_ERROR(TraderTrackOrder, "Cannot journal the removal of all orders: " << e.what());
+		}
+	}
+}
+
+Trader::Journal::Batch Trader::TrackOrderList::snapshotNoLock() const
+{
+	Journal::Batch snapshot;
+	for (const auto& entry : m_list)
+	{
+		Journal::Encoder encoder;
+		entry.encode(encoder);
+		snapshot.add(static_cast<Journal::RecordType>(JournalRecord::UPSERT), encoder);
+	}
+	return snapshot;
+}
+
+void Trader::TrackOrderList::updateLedgerNoLock(
+		const TrackOrderEntry& entry,
+		const bool isAdd) noexcept
+{
+	const auto& trackOrder = entry.getTrackOrder();
+	const auto& order = trackOrder.getOrder();
+	const auto amount = trackOrder.getAmount();
+
+	{
+		auto& ledger = m_ledgerList[order.getInitialCurrency()->getOrdinal()];
+		if (isAdd)
+		{
+			++ledger.m_nbOrders;
+			ledger.m_reserve += amount;
+		}
+		else
+		{
+			IRSTD_ASSERT(TraderTrackOrder, ledger.m_nbOrders > 0, "The ledger is out of sync");
+			ledger.m_reserve -= amount;
+			// Reset to avoid accumulating rounding errors
+			if (--ledger.m_nbOrders == 0)
+			{
+				ledger.m_reserve = 0;
+			}
+		}
+	}
+
+	// Only orders with a valid next order expect funds to be kept
+	if (order.getNext())
+	{
+		auto& ledger = m_ledgerList[order.getFirstOrderFinalCurrency()->getOrdinal()];
+		const auto finalAmount = order.getFirstOrderFinalAmount(amount);
+		if (isAdd)
+		{
+			++ledger.m_nbNextOrders;
+			ledger.m_nextReserve += finalAmount;
+		}
+		else
+		{
+			IRSTD_ASSERT(TraderTrackOrder, ledger.m_nbNextOrders > 0, "The ledger is out of sync");
+			ledger.m_nextReserve -= finalAmount;
+			if (--ledger.m_nbNextOrders == 0)
+			{
+				ledger.m_nextReserve = 0;
+			}
+		}
+	}
+}
+
+IrStd::Type::Decimal Trader::TrackOrderList::getReserve(const CurrencyPtr currency) const noexcept
+{
+	auto scope = m_lockOrders.readScope();
+	return m_ledgerList[currency->getOrdinal()].m_reserve;
+}
+
+void Trader::TrackOrderList::eachReserve(
+		const std::function<void(const CurrencyPtr, const IrStd::Type::Decimal)>& callback) const noexcept
+{
+	auto scope = m_lockOrders.readScope();
+	for (size_t ordinal = 0; ordinal < Currency::NB_CURRENCIES; ++ordinal)
+	{
+		if (m_ledgerList[ordinal].m_nbOrders)
+		{
+			callback(Currency::fromOrdinal(ordinal), m_ledgerList[ordinal].m_reserve);
+		}
+	}
+}
+
+// ---- Trader::TrackOrderList (operations) -----------------------------------
+
 void Trader::TrackOrderList::add(
 		TrackOrder&& track,
 		const char* const pMessage)
@@ -303,7 +718,7 @@ void Trader::TrackOrderList::add(
 		auto scope = m_lockOrders.writeScope();
 
 		TrackOrderEntry entry(std::move(track), /*isPlaceHolder*/true);
-		m_list.push_back(std::move(entry));
+		pushEntryNoLock(std::move(entry));
 
 		// Set the updated flag
 		setUpdatedFlag();
@@ -357,6 +772,7 @@ bool Trader::TrackOrderList::remove(
 		default:
 			IRSTD_UNREACHABLE();
 		}
+		journalUpsertNoLock(*it);
 
 		// Set the updated flag
 		setUpdatedFlag();
@@ -387,7 +803,7 @@ bool Trader::TrackOrderList::match(
 
 		// Copy and delete the current entry
 		const TrackOrderEntry entry(*it);
-		m_list.erase(it);
+		eraseEntryNoLock(it);
 
 		// Assign the new id to all orders
 		for (const auto& newId : newIdList)
@@ -403,10 +819,10 @@ bool Trader::TrackOrderList::match(
 			m_eventManager.copyOrder(id, newId, EventManager::Lifetime::ORDER);
 
 			// Add the entry to the list
-			m_list.push_back(std::move(newEntry));
+			pushEntryNoLock(std::move(newEntry));
 			setUpdatedFlag();
 
-			IRSTD_LOG_TRACE(TraderTrackOrder, "Order id#" << id
+			TRADER_LOG_TRACE(TraderTrackOrder, "Order id#" << id
 					<< " matches with order id#" << newId);
 		}
 	}
@@ -430,6 +846,7 @@ bool Trader::TrackOrderList::activate(
 		IRSTD_THROW_ASSERT(TraderTrackOrder, it != m_list.end(),
 				"The order (id=#" << trackOrderId << ") is not registered");
 		it->activatePlaceHolder(getCurrentTimestamp());
+		journalUpsertNoLock(*it);
 
 		// Set the updated flag
 		setUpdatedFlag();
@@ -505,7 +922,7 @@ Trader::TrackOrderList::TrackOrderEntry Trader::TrackOrderList::matchEntry(
 	// Notify the Event Manager if their id is different
 	if (entry.getTrackOrder().getId() != trackNew.getId())
 	{
-		IRSTD_LOG_INFO(TraderTrackOrder, entry.getTrackOrder().getIdForTrace()
+		TRADER_LOG_INFO(TraderTrackOrder, entry.getTrackOrder().getIdForTrace()
 				<< " and " << trackNew.getIdForTrace() << " are refering to the same order");
 		m_eventManager.copyOrder(entry.getTrackOrder().getId(), trackNew.getId(), EventManager::Lifetime::ORDER);
 	}
@@ -555,7 +972,7 @@ void Trader::TrackOrderList::matchWithSameId(
 				// Check if the entry is supposed to be canceled
 				if (entry.isCancel() && entry.isCancelTimeout(getCurrentTimestamp(), m_timeoutOrderRegisteredMs))
 				{
-					IRSTD_LOG_ERROR(TraderTrackOrder, "Order#" << entryId
+					TRADER_LOG_ERROR(TraderTrackOrder, "Order#" << entryId
 							<< " is marked as cancel but is still present, unset cancel flag");
 					entry.unsetCancel();
 				}
@@ -564,7 +981,7 @@ void Trader::TrackOrderList::matchWithSameId(
 
 				// Process the entry
 				auto matchingEntry = matchEntry(entry, *itUpdated);
-				m_list.push_back(std::move(matchingEntry));
+				pushEntryNoLock(std::move(matchingEntry));
 
 				// Process the left over of the entry
 				handleCompletedOrder(entry, initialAmount, actionList, lastTimestampWhenPresent);
@@ -671,20 +1088,20 @@ void Trader::TrackOrderList::matchPlaceHolders(
 			// If the order is marked as canceled, display a warning
 			if (entry.isCancel())
 			{
-				IRSTD_LOG_WARNING(TraderTrackOrder, entry.getTrackOrder().getIdForTrace()
+				TRADER_LOG_WARNING(TraderTrackOrder, entry.getTrackOrder().getIdForTrace()
 						<< " expected to be canceled but matches with " << trackOrder.getIdForTrace()
 						<< " with weight " << weight);
 			}
 			else
 			{
-				IRSTD_LOG_INFO(TraderTrackOrder, entry.getTrackOrder().getIdForTrace()
+				TRADER_LOG_INFO(TraderTrackOrder, entry.getTrackOrder().getIdForTrace()
 						<< " matches with " << trackOrder.getIdForTrace() << " with weight " << weight);
 			}
 
 			// Add the matched order to the list
 			{
 				auto matchingEntry = matchEntry(entry, trackOrder);
-				m_list.push_back(std::move(matchingEntry));
+				pushEntryNoLock(std::move(matchingEntry));
 			}
 
 			// Reset all the weight for all original entries in the matrix to ensure it does not match
@@ -695,7 +1112,7 @@ void Trader::TrackOrderList::matchPlaceHolders(
 				const auto curWeight = matrixMatch[matrixMatchStartIndex + updatedListIndex];
 				if (originalListCurIndex != originalListIndex && curWeight > (weight * 0.5))
 				{
-					IRSTD_LOG_WARNING(TraderTrackOrder, originalList[originalListCurIndex].getTrackOrder().getIdForTrace()
+					TRADER_LOG_WARNING(TraderTrackOrder, originalList[originalListCurIndex].getTrackOrder().getIdForTrace()
 							<< " could also have matched " << trackOrder.getIdForTrace()
 							<< " but matching weight is slightly lower (" << curWeight
 							<< " vs. " << weight << ")");
@@ -779,7 +1196,7 @@ void Trader::TrackOrderList::handleVanishedOrder(
 	}
 
 	// Add message for debug purpose
-	IRSTD_LOG_INFO(TraderTrackOrder, entry.getTrackOrder().getIdForTrace()
+	TRADER_LOG_INFO(TraderTrackOrder, entry.getTrackOrder().getIdForTrace()
 			<< " vanished, probability to be processed: " << (probabilityProcessed * 100)
 			<< "% and marked as " << ((entry.isCancel()) ? "canceled" : "proceed")
 			<< " (last.timestamp=" << lastTimestampWhenPresent << ", distance=" << distance
@@ -788,7 +1205,7 @@ void Trader::TrackOrderList::handleVanishedOrder(
 	// If the order is expected to be canceled but it seems that it went through
 	if (entry.isCancel() && probabilityProcessed > 0.8)
 	{
-		IRSTD_LOG_WARNING(TraderTrackOrder, entry.getTrackOrder().getIdForTrace()
+		TRADER_LOG_WARNING(TraderTrackOrder, entry.getTrackOrder().getIdForTrace()
 				<< " is expected to be canceled but it shows high probability to be processed ("
 				<< (probabilityProcessed * 100) << "%, distance=" << distance << ", movements=["
 				<< movements.first << ", " << movements.second << "]), set as proceed");
@@ -815,7 +1232,7 @@ void Trader::TrackOrderList::handleVanishedOrder(
 			entry.setCancel(timestamp, RemoveCause::CANCEL);
 		}
 
-		IRSTD_LOG_WARNING(TraderTrackOrder, messageStream.str());
+		TRADER_LOG_WARNING(TraderTrackOrder, messageStream.str());
 	}
 
 	// If the order is marked as cancel, do nothing, it is expected to be removed
@@ -866,7 +1283,7 @@ void Trader::TrackOrderList::handleCompletedOrder(
 
 	if (amount < 0)
 	{
-		IRSTD_LOG_ERROR(TraderTrackOrder, "Amount (" << amount << ") for " << trackOrder.getIdForTrace()
+		TRADER_LOG_ERROR(TraderTrackOrder, "Amount (" << amount << ") for " << trackOrder.getIdForTrace()
 				<< " is negative, which means there is an inconsitency in the order list");
 		return;
 	}
@@ -895,7 +1312,7 @@ void Trader::TrackOrderList::handleCompletedOrder(
 			// Boundaries for unrealistic fees
 			if (feePercent >= 0 && feePercent < 0.5)
 			{
-				IRSTD_LOG_INFO(TraderTrackOrder, "Estimated fee for " << entry.getTrackOrder().getIdForTrace()
+				TRADER_LOG_INFO(TraderTrackOrder, "Estimated fee for " << entry.getTrackOrder().getIdForTrace()
 						<< " is " << feePercent << "%");
 			}
 		}
@@ -935,7 +1352,7 @@ void Trader::TrackOrderList::handleCompletedOrder(
 				strStream << ((strStream.str().empty()) ? "" : " and ") << notConsumedFinal
 						<< " " << entry.getTrackOrder().getOrder().getFirstOrderFinalCurrency();
 			}
-			IRSTD_LOG_WARNING(TraderTrackOrder, entry.getTrackOrder().getIdForTrace()
+			TRADER_LOG_WARNING(TraderTrackOrder, entry.getTrackOrder().getIdForTrace()
 					<< " is processed but the full amount movement is not detected, missing " << strStream.str());
 		}
 	}
@@ -978,7 +1395,7 @@ bool Trader::TrackOrderList::update(
 		auto originalList = m_list;
 		auto updatedList = list;
 		const auto trackOrderOriginalList = m_list;
-		m_list.clear();
+		clearEntriesNoLock();
 
 		matchWithSameId(originalList, updatedList, actionList, m_timestampUnsync[1]);
 
@@ -1033,7 +1450,7 @@ bool Trader::TrackOrderList::update(
 					// If cancel and cancel time not reached yet
 					|| (entry.isCancel() && !entry.isCancelTimeout(getCurrentTimestamp(), m_timeoutOrderRegisteredMs)))
 			{
-				m_list.push_back(entry);
+				pushEntryNoLock(TrackOrderEntry(entry));
 			}
 			else
 			{
@@ -1053,9 +1470,9 @@ bool Trader::TrackOrderList::update(
 			for (size_t i = 0; i<updatedList.size(); i++)
 			{
 				orderListStream << ((i) ? ", " : "") << updatedList[i].getIdForTrace();
-				m_list.push_back(TrackOrderEntry(std::move(updatedList[i]), /*isPlaceHolder*/false));
+				pushEntryNoLock(TrackOrderEntry(std::move(updatedList[i]), /*isPlaceHolder*/false));
 			}
-			IRSTD_LOG_WARNING(TraderTrackOrder, "The order(s) [" << orderListStream.str()
+			TRADER_LOG_WARNING(TraderTrackOrder, "The order(s) [" << orderListStream.str()
 					<< "] did not match any known orders");
 		}
 
@@ -1087,7 +1504,7 @@ bool Trader::TrackOrderList::update(
 										<< " " << order.getFirstOrderFinalCurrency();
 						}
 
-						IRSTD_LOG_INFO(TraderTrackOrder, trackOrder.getIdForTrace()
+						TRADER_LOG_INFO(TraderTrackOrder, trackOrder.getIdForTrace()
 								<< " is" << ((amount < amountTotal) ? " partially" : "")
 								<< " completed with amount " << amount);
 
@@ -1098,7 +1515,7 @@ bool Trader::TrackOrderList::update(
 						messageStream << "Ignoring Amount (" << amount << " " << order.getInitialCurrency()
 								<< ") processed for " << trackOrder.getIdForTrace() << " (too small)";
 
-						IRSTD_LOG_WARNING(TraderTrackOrder, messageStream.str().c_str());
+						TRADER_LOG_WARNING(TraderTrackOrder, messageStream.str().c_str());
 					}
 
 					// Add the record before proceeding with the next order for readability in the records
@@ -1130,48 +1547,39 @@ bool Trader::TrackOrderList::update(
 
 void Trader::TrackOrderList::updateBalance(const Balance& balance) noexcept
 {
-	m_balanceMovements.update(balance);
+	m_balanceMovements.update(balance, getCurrentTimestamp());
 }
 
 void Trader::TrackOrderList::reserveBalance(Balance& balance) const
 {
-	Balance reserveMaxFunds;
+	// Only consider the balance variations within the last m_timeoutOrderRegisteredMs * 2 time
+	const auto timestamp = getCurrentTimestamp();
+	const auto oldTimestamp = timestamp - m_timeoutOrderRegisteredMs * 2;
 
-	// Compute the maximum amount of funds that should be considered.
+	IrStd::Type::Decimal nextReserveList[Currency::NB_CURRENCIES];
 	{
 		auto scope = m_lockOrders.readScope();
-		for (const auto& entry : m_list)
+		for (size_t ordinal = 0; ordinal < Currency::NB_CURRENCIES; ++ordinal)
 		{
-			const auto& order = entry.getTrackOrder().getOrder();
-			// Only consider orders with a valid next orders
-			if (!order.getNext())
-			{
-				continue;
-			}
-			// Expected final amount/current
-			const auto finalAmount = order.getFirstOrderFinalAmount(entry.getTrackOrder().getAmount());
-			reserveMaxFunds.add(order.getFirstOrderFinalCurrency(), finalAmount);
+			nextReserveList[ordinal] = m_ledgerList[ordinal].m_nextReserve;
 		}
 	}
 
-	// Check if any of this amount has been in the last X time
+	// Reserve what has been received recently, up to the amount expected by the chained orders
+	for (size_t ordinal = 0; ordinal < Currency::NB_CURRENCIES; ++ordinal)
 	{
-		const auto timestamp = getCurrentTimestamp();
-
-		// Look at all balance variations within the last m_timeoutOrderRegisteredMs * 2 time
-		m_balanceMovements.get(timestamp, timestamp - m_timeoutOrderRegisteredMs * 2, [&](
-				const IrStd::Type::Timestamp /*timestamp*/, const IrStd::Type::Decimal amount, const CurrencyPtr currency) {
-
-			// If the amount is positive, the currency matches and there are funds in the balance
-			const auto maxAmount = reserveMaxFunds.get(currency);
-			const auto availableBalance = balance.get(currency);
-			if (amount > 0 && maxAmount > 0 && availableBalance > 0)
-			{
-				const auto reserve = std::min(amount, std::min(availableBalance, maxAmount));
-				reserveMaxFunds.add(currency, -reserve);
-				balance.reserve(currency, reserve);
-			}
-		});
+		const auto maxAmount = nextReserveList[ordinal];
+		if (maxAmount <= 0)
+		{
+			continue;
+		}
+		const auto currency = Currency::fromOrdinal(ordinal);
+		const auto availableBalance = balance.get(currency);
+		const auto income = m_balanceMovements.getIncome(oldTimestamp, currency);
+		if (income > 0 && availableBalance > 0)
+		{
+			balance.reserve(currency, std::min(income, std::min(availableBalance, maxAmount)));
+		}
 	}
 }
 
@@ -1187,7 +1595,7 @@ bool Trader::TrackOrderList::cancelTimeout(
 		{
 			if (!entry.isCancel() && !entry.isPlaceHolder() && entry.getTrackOrder().isTimeout(timestamp))
 			{
-				IRSTD_LOG_INFO(TraderTrackOrder, "Timeout for order: " << entry.getTrackOrder()
+				TRADER_LOG_INFO(TraderTrackOrder, "Timeout for order: " << entry.getTrackOrder()
 						<< ", current.timestamp=" << timestamp);
 
 				// Make a copy of the tracking order
@@ -1215,7 +1623,7 @@ bool Trader::TrackOrderList::cancelTimeout(
 
 IrStd::Type::Timestamp Trader::TrackOrderList::getCurrentTimestamp() const noexcept
 {
-	return IrStd::Type::Timestamp::now();
+	return m_pClock->now();
 }
 
 void Trader::TrackOrderList::addRecord(
@@ -1238,6 +1646,28 @@ void Trader::TrackOrderList::addRecord(
 		strategyId
 	};
 	m_orderRecordList.push(getCurrentTimestamp(), state);
+	m_nbRecordList[static_cast<size_t>(type)].inc();
+}
+
+const char* Trader::TrackOrderList::getRecordTypeToString(const RecordType type) noexcept
+{
+	switch (type)
+	{
+	case RecordType::PLACE:
+		return "place";
+	case RecordType::PARTIAL:
+		return "partial";
+	case RecordType::PROCEED:
+		return "proceed";
+	case RecordType::CANCEL:
+		return "cancel";
+	case RecordType::FAILED:
+		return "failed";
+	case RecordType::TIMEOUT:
+		return "timeout";
+	default:
+		IRSTD_UNREACHABLE(TraderTrackOrder, "type=" << IrStd::Type::toIntegral(type));
+	}
 }
 
 void Trader::TrackOrderList::getRecords(const std::function<void(
@@ -1254,37 +1684,26 @@ void Trader::TrackOrderList::getRecords(const std::function<void(
 		const Id)>& callback) const noexcept
 {
 	m_orderRecordList.read([&](const IrStd::Type::Timestamp& timestamp, const OrderState& state) {
-		// Identify the type of record
-		const char* pRecordType;
-		switch (state.m_type)
-		{
-		case RecordType::PLACE:
-			pRecordType = "place";
-			break;
-		case RecordType::PARTIAL:
-			pRecordType = "partial";
-			break;
-		case RecordType::PROCEED:
-			pRecordType = "proceed";
-			break;
-		case RecordType::CANCEL:
-			pRecordType = "cancel";
-			break;
-		case RecordType::FAILED:
-			pRecordType = "failed";
-			break;
-		case RecordType::TIMEOUT:
-			pRecordType = "timeout";
-			break;
-		default:
-			IRSTD_UNREACHABLE(TraderTrackOrder);
-		}
-		callback(timestamp, pRecordType, state.m_id, TrackOrder::getTypeToString(state.m_orderType),
+		callback(timestamp, getRecordTypeToString(state.m_type), state.m_id, TrackOrder::getTypeToString(state.m_orderType),
 				state.m_initialCurrency, state.m_finalCurrency, state.m_amount, state.m_rate, state.m_contextId,
 				state.m_message.c_str(), state.m_strategyId);
 	}, 20);
 }
 
+void Trader::TrackOrderList::registerMetrics(
+		const Metrics::Labels& labels,
+		std::vector<Metrics::Registration>& registrationList) const
+{
+	for (size_t i = 0; i < NB_RECORD_TYPES; ++i)
+	{
+		auto recordLabels = labels;
+		recordLabels.push_back(std::make_pair("type", getRecordTypeToString(static_cast<RecordType>(i))));
+		registrationList.push_back(Metrics::getDefault().add("trader_orders_total",
+				"Number of order updates by type (place, partial/proceed fills, cancel, failed, timeout)",
+				recordLabels, m_nbRecordList[i]));
+	}
+}
+
 // ---- Trader::TrackOrderList (print) ----------------------------------------
 
 void Trader::TrackOrderList::toStream(std::ostream& out) const
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <map>
 #include <vector>
 
 #include "Trader/Exchange/Balance/BalanceMovements.hpp"
 #include "Trader/Exchange/Order/TrackOrder.hpp"
 #include "Trader/Exchange/Event/EventManager.hpp"
 #include "Trader/Generic/Id/Id.hpp"
+#include "Trader/Generic/Clock/Clock.hpp"
+#include "Trader/Generic/Journal/Journal.hpp"
+#include "Trader/Generic/Metrics/Metrics.hpp"
 
 namespace Trader
 {
@@ -18,7 +22,34 @@ namespace Trader
 		static constexpr size_t NB_RECORDS = 256;
 
 	public:
-		TrackOrderList(EventManager& eventManager, const size_t timeoutOrderRegisteredMs);
+		TrackOrderList(EventManager& eventManager, const size_t timeoutOrderRegisteredMs,
+				std::shared_ptr<const Clock> pClock = Clock::getDefault());
+
+		/**
+		 * Set the clock used to date and timeout the orders
+		 */
+		void setClock(std::shared_ptr<const Clock> pClock) noexcept;
+
+		/**
+		 * Find the transaction of a pair, used to restore orders from a journal
+		 */
+		typedef std::function<std::shared_ptr<Transaction>(const CurrencyPtr, const CurrencyPtr)> TransactionResolver;
+
+		/**
+		 * Log every change of the list into \p pJournal, nullptr to stop logging.
+		 */
+		void setJournal(std::shared_ptr<Journal> pJournal) noexcept;
+
+		/**
+		 * \brief Replace the list with the orders replayed from \p pJournal,
+		 * then compact the journal and log the next changes into it.
+		 *
+		 * Orders on a pair that cannot be resolved are dropped. Contexts are restored
+		 * without their callbacks, only OperationContext keep their state.
+		 *
+		 * \return The restored orders
+		 */
+		std::vector<TrackOrder> restore(std::shared_ptr<Journal> pJournal, const TransactionResolver& getTransaction);
 
 		/**
 		 * \brief Resets the content of the track order list,
@@ -112,6 +143,20 @@ namespace Trader
 		 */
 		void reserveBalance(Balance& balance) const;
 
+		/**
+		 * \brief Amount of a currency locked by the tracked orders.
+		 *
+		 * This is read from the reserve ledger, which is maintained as orders
+		 * are added, matched or removed, hence it does not depend on the
+		 * number of orders.
+		 */
+		IrStd::Type::Decimal getReserve(const CurrencyPtr currency) const noexcept;
+
+		/**
+		 * \brief Iterate through the currencies locked by at least one order
+		 */
+		void eachReserve(const std::function<void(const CurrencyPtr, const IrStd::Type::Decimal)>& callback) const noexcept;
+
 		/**
 		 * This function will cancel all out of dates order (timeout)
 		 */
@@ -129,6 +174,11 @@ namespace Trader
 				const char* const, const CurrencyPtr, const CurrencyPtr, const IrStd::Type::Decimal,
 				const IrStd::Type::Decimal, const size_t, const char* const, const Id)>& callback) const noexcept;
 
+		/**
+		 * Register the number of orders placed, filled, canceled, failed and timed out
+		 */
+		void registerMetrics(const Metrics::Labels& labels, std::vector<Metrics::Registration>& registrationList) const;
+
 	private:
 		class TrackOrderEntry
 		{
@@ -198,6 +248,14 @@ namespace Trader
 			 * Return true if the amount of the order is neglectable
 			 */
 			bool isAmountNeglectable() const noexcept;
+
+			/**
+			 * Serialize the entry with its order chain and its context.
+			 * Contexts shared between entries are restored once, through \p contextMap.
+			 */
+			void encode(Journal::Encoder& encoder) const;
+			static TrackOrderEntry decode(Journal::Decoder& decoder, const TransactionResolver& getTransaction,
+					std::map<size_t, ContextHandle>& contextMap);
 		private:
 			TrackOrder m_trackOrder;
 
@@ -340,15 +398,61 @@ namespace Trader
 			FAILED,
 			TIMEOUT
 		};
+		static constexpr size_t NB_RECORD_TYPES = static_cast<size_t>(RecordType::TIMEOUT) + 1;
+		static const char* getRecordTypeToString(const RecordType type) noexcept;
 		void addRecord(const RecordType type, const TrackOrder& track, const char* const pMessage = "") noexcept;
 
 		mutable IrStd::RWLock m_lockOrders;
 		EventManager& m_eventManager;
+		std::shared_ptr<const Clock> m_pClock;
 
 		std::vector<TrackOrderEntry> m_list;
 
 		std::vector<TrackOrderEntry>::iterator getById(const Id id) noexcept;
 
+		/**
+		 * Modify m_list while keeping the reserve ledger in sync.
+		 * These must be called under a write scope of m_lockOrders.
+		 */
+		void pushEntryNoLock(TrackOrderEntry&& entry);
+		void eraseEntryNoLock(const std::vector<TrackOrderEntry>::iterator it) noexcept;
+		void clearEntriesNoLock() noexcept;
+		void updateLedgerNoLock(const TrackOrderEntry& entry, const bool isAdd) noexcept;
+
+		/**
+		 * Journal records, an entry is written in full each time it changes
+		 */
+		enum class JournalRecord : Journal::RecordType
+		{
+			UPSERT = 1,
+			ERASE,
+			CLEAR
+		};
+		/**
+		 * The in-memory list stays the reference if a record cannot be
+		 * journaled, the failure is only logged.
+		 */
+		void journalUpsertNoLock(const TrackOrderEntry& entry) noexcept;
+		void journalEraseNoLock(const Id id) noexcept;
+		void journalClearNoLock() noexcept;
+		Journal::Batch snapshotNoLock() const;
+
+		std::shared_ptr<Journal> m_pJournal;
+
+		/**
+		 * Reserve ledger, indexed by currency ordinal
+		 */
+		struct Ledger
+		{
+			// Number of orders and amount locked in their initial currency
+			size_t m_nbOrders;
+			IrStd::Type::Decimal m_reserve;
+			// Number of chained orders and amount expected in their final currency
+			size_t m_nbNextOrders;
+			IrStd::Type::Decimal m_nextReserve;
+		};
+		Ledger m_ledgerList[Currency::NB_CURRENCIES];
+
 		// Maximal time before an order created by Trader gets registered on the server side
 		const size_t m_timeoutOrderRegisteredMs;
 
@@ -372,6 +476,8 @@ namespace Trader
 			Id m_strategyId;
 		};
 		IrStd::Type::RingBufferSorted<IrStd::Type::Timestamp, OrderState, NB_RECORDS> m_orderRecordList;
+		// Number of records per type
+		Metrics::Counter m_nbRecordList[NB_RECORD_TYPES];
 
 		/**
 		 * Track movements of the balance
@@ -1,5 +1,21 @@
 #include "Trader/Exchange/Transaction/Boundaries.hpp"
 
+namespace
+{
+	/**
+	 * Convert a number to check with the highest precision available,
+	 * false if it cannot be represented.
+	 */
+	bool toFixedPoint(const IrStd::Type::Decimal number, Trader::FixedPoint& fixedPoint) noexcept
+	{
+		return Trader::FixedPoint::fromDecimal(number, Trader::FixedPoint::MAX_SCALE, fixedPoint);
+	}
+}
+
+// ---- Trader::Boundaries ----------------------------------------------------
+
+constexpr size_t Trader::Boundaries::SCALE;
+
 Trader::Boundaries::Boundaries()
 		: m_initialAmount(0.0000001)
 		, m_finalAmount(0.0000001)
@@ -28,6 +44,22 @@ void Trader::Boundaries::setRate(
 	m_rate.merge(Interval(minRate, maxRate));
 }
 
+Trader::Boundaries::Boundaries(Journal::Decoder& decoder)
+{
+	for (auto pInterval : {&m_initialAmount, &m_finalAmount, &m_rate})
+	{
+		*pInterval = Interval(decoder);
+	}
+}
+
+void Trader::Boundaries::encode(Journal::Encoder& encoder) const
+{
+	for (auto pInterval : {&m_initialAmount, &m_finalAmount, &m_rate})
+	{
+		pInterval->encode(encoder);
+	}
+}
+
 Trader::Boundaries Trader::Boundaries::getInvert() const noexcept
 {
 	Boundaries invert;
@@ -41,17 +73,35 @@ Trader::Boundaries Trader::Boundaries::getInvert() const noexcept
 
 bool Trader::Boundaries::checkInitialAmount(const IrStd::Type::Decimal amount) const noexcept
 {
-	return amount >= 0 && m_initialAmount.check(amount);
+	FixedPoint number;
+	return toFixedPoint(amount, number) && checkInitialAmount(number);
 }
 
 bool Trader::Boundaries::checkFinalAmount(const IrStd::Type::Decimal amount) const noexcept
 {
-	return amount >= 0 && m_finalAmount.check(amount);
+	FixedPoint number;
+	return toFixedPoint(amount, number) && checkFinalAmount(number);
 }
 
 bool Trader::Boundaries::checkRate(const IrStd::Type::Decimal rate) const noexcept
 {
-	return rate >= 0 && m_rate.check(rate);
+	FixedPoint number;
+	return toFixedPoint(rate, number) && checkRate(number);
+}
+
+bool Trader::Boundaries::checkInitialAmount(const FixedPoint& amount) const noexcept
+{
+	return amount.getMantissa() >= 0 && m_initialAmount.check(amount);
+}
+
+bool Trader::Boundaries::checkFinalAmount(const FixedPoint& amount) const noexcept
+{
+	return amount.getMantissa() >= 0 && m_finalAmount.check(amount);
+}
+
+bool Trader::Boundaries::checkRate(const FixedPoint& rate) const noexcept
+{
+	return rate.getMantissa() >= 0 && m_rate.check(rate);
 }
 
 void Trader::Boundaries::merge(const Boundaries& boundaries) noexcept
@@ -3,12 +3,24 @@
 #include <ostream>
 #include "IrStd/IrStd.hpp"
 
+#include "Trader/Generic/Journal/Journal.hpp"
+#include "Trader/Generic/FixedPoint/FixedPoint.hpp"
+
 namespace Trader
 {
 	class Boundaries
 	{
 	public:
+		/**
+		 * Number of decimal places of the limits
+		 */
+		static constexpr size_t SCALE = 10;
+
 		Boundaries();
+		/**
+		 * Restore boundaries serialized with encode()
+		 */
+		explicit Boundaries(Journal::Decoder& decoder);
 
 		Boundaries getInvert() const noexcept;
 
@@ -16,6 +28,14 @@ namespace Trader
 		bool checkFinalAmount(const IrStd::Type::Decimal amount) const noexcept;
 		bool checkRate(const IrStd::Type::Decimal rate) const noexcept;
 
+		/**
+		 * Same checks with integer comparisons, for the amounts and rates
+		 * already rounded for an order.
+		 */
+		bool checkInitialAmount(const FixedPoint& amount) const noexcept;
+		bool checkFinalAmount(const FixedPoint& amount) const noexcept;
+		bool checkRate(const FixedPoint& rate) const noexcept;
+
 		void setInitialAmount(const IrStd::Type::Decimal minInitialAmount, const IrStd::Type::Decimal maxInitialAmount = 0) noexcept;
 		void setFinalAmount(const IrStd::Type::Decimal minInitialAmount, const IrStd::Type::Decimal maxInitialAmount = 0) noexcept;
 		void setRate(const IrStd::Type::Decimal minRate, const IrStd::Type::Decimal maxRate = 0) noexcept;
@@ -26,71 +46,106 @@ namespace Trader
 		void merge(const Boundaries& boundaries) noexcept;
 
 		void toStream(std::ostream& out) const;
+		void encode(Journal::Encoder& encoder) const;
 
 	private:
 		class Interval
 		{
 		public:
-			Interval(const IrStd::Type::Decimal min = 0, const IrStd::Type::Decimal max = 0)
-					: m_min(min)
-					, m_max(max)
+			/**
+			 * A limit of 0 is not set, it is also the case of a limit
+			 * that cannot be represented.
+			 */
+			Interval(const IrStd::Type::Decimal min = 0, const IrStd::Type::Decimal max = 0) noexcept
+					: m_min()
+					, m_max()
 			{
+				FixedPoint::fromDecimal(min, SCALE, m_min);
+				FixedPoint::fromDecimal(max, SCALE, m_max);
 			}
 
 			IrStd::Type::Decimal getMin() const noexcept
 			{
-				return m_min;
+				return m_min.toDecimal();
 			}
 
 			IrStd::Type::Decimal getMax() const noexcept
 			{
-				return m_max;
+				return m_max.toDecimal();
 			}
 
 			IrStd::Type::Decimal getInvertMin() const noexcept
 			{
-				return (m_min) ? IrStd::Type::Decimal(1.) / m_min : IrStd::Type::Decimal(0);
+				return (m_min.getMantissa()) ? IrStd::Type::Decimal(1.) / m_min.toDecimal() : IrStd::Type::Decimal(0);
 			}
 
 			IrStd::Type::Decimal getInvertMax() const noexcept
 			{
-				return (m_max) ? IrStd::Type::Decimal(1.) / m_max : IrStd::Type::Decimal(0);
+				return (m_max.getMantissa()) ? IrStd::Type::Decimal(1.) / m_max.toDecimal() : IrStd::Type::Decimal(0);
 			}
 
-			bool check(const IrStd::Type::Decimal number) const noexcept
+			bool check(const FixedPoint& number) const noexcept
 			{
-				return (!m_min || number >= m_min) && (!m_max || number <= m_max);
+				return (!m_min.getMantissa() || number >= m_min) && (!m_max.getMantissa() || number <= m_max);
 			}
 
 			void merge(const Interval& interval) noexcept
 			{
-				// Keep the most restrictive
+				// Keep the most restrictive, a maximum that is not set is not one
 				m_min = (interval.m_min > m_min) ? interval.m_min : m_min;
-				m_max = (interval.m_max < m_max) ? interval.m_max : m_max;
+				if (interval.m_max.getMantissa() && (!m_max.getMantissa() || interval.m_max < m_max))
+				{
+					m_max = interval.m_max;
+				}
+			}
+
+			explicit Interval(Journal::Decoder& decoder)
+					: m_min(decode(decoder))
+					, m_max(decode(decoder))
+			{
+			}
+
+			/**
+			 * The limits are stored as mantissa and scale, to be restored exactly
+			 */
+			void encode(Journal::Encoder& encoder) const
+			{
+				for (const auto pNumber : {&m_min, &m_max})
+				{
+					encoder.putU64(static_cast<uint64_t>(pNumber->getMantissa()));
+					encoder.putU64(pNumber->getScale());
+				}
 			}
 
 			void toStream(const char* const name, std::ostream& out, bool& separator) const
 			{
-				if (m_min && m_max)
+				if (m_min.getMantissa() && m_max.getMantissa())
 				{
-					out << ((separator) ? ", " : "") << name << "=[" << m_min << ", " << m_max << "]";
+					out << ((separator) ? ", " : "") << name << "=[" << m_min.normalize() << ", " << m_max.normalize() << "]";
 					separator = true;
 				}
-				else if (m_min)
+				else if (m_min.getMantissa())
 				{
-					out << ((separator) ? ", " : "") << name << "\u2265" << m_min;
+					out << ((separator) ? ", " : "") << name << "\u2265" << m_min.normalize();
 					separator = true;
 				}
-				else if (m_max)
+				else if (m_max.getMantissa())
 				{
-					out << ((separator) ? ", " : "") << name << "\u2264" << m_max;
+					out << ((separator) ? ", " : "") << name << "\u2264" << m_max.normalize();
 					separator = true;
 				}
 			}
 
 		private:
-			IrStd::Type::Decimal m_min;
-			IrStd::Type::Decimal m_max;
+			static FixedPoint decode(Journal::Decoder& decoder)
+			{
+				const int64_t mantissa = static_cast<int64_t>(decoder.getU64());
+				const size_t scale = decoder.getU64();
+				return FixedPoint::fromMantissa(mantissa, scale);
+			}
+
+			FixedPoint m_min;
+			FixedPoint m_max;
 		};
 
 		//! Intial amount
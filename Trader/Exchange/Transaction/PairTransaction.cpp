@@ -67,7 +67,7 @@ void Trader::PairTransaction::setAskPrice(
 	IRSTD_THROW_ASSERT(TraderTransaction, pTransaction->m_pInvertedTransaction,
 			"Inverted transaction for " << *pTransaction << " does not exists");
 
-	const auto formatedPrice = IrStd::Type::doubleFormat(price, pTransaction->getDecimalPlace());
+	const auto formatedPrice = FixedPoint(price, pTransaction->getDecimalPlace()).toDecimal();
 	pTransaction->m_pInvertedTransaction->setRate(1. / formatedPrice, timestamp);
 }
 
@@ -184,6 +184,17 @@ bool Trader::PairTransaction::operator!=(const PairTransaction& transaction) con
 	return !(*this == transaction);
 }
 
+std::pair<IrStd::Type::ShortString, IrStd::Type::ShortString> Trader::PairTransaction::formatForOrder(
+		const FixedPoint& amount,
+		const FixedPoint& rate)
+{
+	char amountFormated[FixedPoint::MAX_STRING_SIZE];
+	char rateFormated[FixedPoint::MAX_STRING_SIZE];
+	amount.normalize().toString(amountFormated);
+	rate.normalize().toString(rateFormated);
+	return std::make_pair(IrStd::Type::ShortString(amountFormated), IrStd::Type::ShortString(rateFormated));
+}
+
 // ---- Trader::PairTransactionImpl -------------------------------------------
 
 Trader::PairTransactionImpl::PairTransactionImpl(
@@ -235,14 +246,10 @@ std::pair<IrStd::Type::ShortString, IrStd::Type::ShortString> Trader::PairTransa
 	const auto minPrecision = IrStd::Type::Decimal::getMinPrecision(decimalPlace);
 
 	// Use the decimal place here
-	const auto processedAmount = amount;
+	const FixedPoint processedAmount(amount, getDecimalPlace(), FixedPoint::Rounding::FLOOR);
 	IRSTD_THROW_ASSERT(getBoundaries().checkInitialAmount(processedAmount), "amount=" << amount
 			<< ", minPrecision=" << minPrecision << ", processedAmount=" << processedAmount);
-	const auto amountFormated = IrStd::Type::ShortString(processedAmount, getDecimalPlace(), IrStd::TypeFormat::FLAG_FLOOR);
-
-	const auto rateFormated = IrStd::Type::ShortString(rate, decimalPlace,
-			IrStd::TypeFormat::FLAG_ROUND);
-	return std::make_pair(amountFormated, rateFormated);
+	return formatForOrder(processedAmount, FixedPoint(rate, decimalPlace));
 }
 
 IrStd::Type::Decimal Trader::PairTransactionImpl::getFinalAmountImpl(
@@ -289,18 +296,16 @@ std::pair<IrStd::Type::ShortString, IrStd::Type::ShortString> Trader::InvertPair
 	const auto minPrecision = IrStd::Type::Decimal::getMinPrecision(decimalPlace);
 
 	// Use the decimal place for the amount
-	const auto processedAmount = getFinalAmountImpl(amount, rate);
+	const FixedPoint processedAmount(getFinalAmountImpl(amount, rate), m_pTransaction->getDecimalPlace(),
+			FixedPoint::Rounding::FLOOR);
 	IRSTD_THROW_ASSERT(getBoundaries().checkFinalAmount(processedAmount), "amount=" << amount
 			<< ", rate=" << rate << ", minPrecision= " << minPrecision
 			<< ", processedAmount=" << processedAmount);
-	const auto amountFormated = IrStd::Type::ShortString(processedAmount, m_pTransaction->getDecimalPlace(), IrStd::TypeFormat::FLAG_FLOOR);
-
-	const auto processedRate = 1. / rate;
+	const FixedPoint processedRate(1. / rate, decimalPlace);
 	IRSTD_THROW_ASSERT(getBoundaries().checkRate(processedRate), "rate=" << rate
 			<< ", processedRate=" << processedRate);
-	const auto rateFormated = IrStd::Type::ShortString(processedRate, decimalPlace, IrStd::TypeFormat::FLAG_ROUND);
 
-	return std::make_pair(amountFormated, rateFormated);
+	return formatForOrder(processedAmount, processedRate);
 }
 
 IrStd::Type::Decimal Trader::InvertPairTransactionImpl::getFinalAmountImpl(
@@ -352,7 +357,7 @@ Trader::PairTransactionNop::PairTransactionNop()
 	for (const auto& currency : {TRADER_CURRENCY_LIST})
 	{
 		m_nopPairTransactionMap[currency] = std::make_shared<PairTransactionImpl>(currency, currency);
-		m_nopPairTransactionMap[currency]->setRate(1, IrStd::Type::Timestamp::now());
+		m_nopPairTransactionMap[currency]->setRate(1, Clock::getDefault()->now());
 	}
 }
 
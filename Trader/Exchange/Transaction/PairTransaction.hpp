@@ -7,6 +7,7 @@
 
 #include "Trader/Exchange/Transaction/Transaction.hpp"
 #include "Trader/Exchange/Transaction/Boundaries.hpp"
+#include "Trader/Generic/FixedPoint/FixedPoint.hpp"
 
 namespace Trader
 {
@@ -113,6 +114,13 @@ namespace Trader
 		 */
 		virtual Boundaries* getBoundariesForWrite() noexcept = 0;
 
+		/**
+		 * Format the amount and the rate already rounded to the decimal places
+		 * of the order, without trailing zeros
+		 */
+		static std::pair<IrStd::Type::ShortString, IrStd::Type::ShortString> formatForOrder(
+				const FixedPoint& amount, const FixedPoint& rate);
+
 	private:
 		const PairTransactionImpl* getPairTransaction() const;
 		const InvertPairTransactionImpl* getInvertPairTransaction() const;
@@ -163,6 +171,7 @@ namespace Trader
 		friend class Exchange;
 		friend class PairTransaction;
 		friend class PairTransactionMap;
+		friend class PropertiesSnapshot;
 		friend class InvertPairTransactionImpl;
 
 		Boundaries* getBoundariesForWrite() noexcept override;
@@ -0,0 +1,129 @@
+#include <unistd.h>
+
+#include "Trader/Exchange/Transaction/PropertiesSnapshot.hpp"
+
+IRSTD_TOPIC_USE_ALIAS(TraderPairTransactionMap, Trader, PairTransactionMap);
+
+// ---- Trader::PropertiesSnapshot --------------------------------------------
+
+constexpr uint64_t Trader::PropertiesSnapshot::FORMAT_VERSION;
+
+void Trader::PropertiesSnapshot::save(
+		const std::string& path,
+		const Id exchangeId,
+		const PairTransactionMap& transactionMap,
+		const std::string& state)
+{
+	Journal::Batch batch;
+	{
+		Journal::Encoder encoder;
+		encoder.putU64(FORMAT_VERSION);
+		encoder.putU64(Currency::NB_CURRENCIES);
+		encoder.putString(exchangeId.c_str());
+		encoder.putString(state);
+		batch.add(RecordType::HEADER, encoder);
+	}
+
+	// Inverted pairs are rebuilt from their mirror
+	transactionMap.getTransactions([&](const CurrencyPtr from, const CurrencyPtr to,
+			const PairTransactionMap::PairTransactionPointer pTransaction) {
+		if (pTransaction->isInvertedTransaction())
+		{
+			return;
+		}
+		const auto pInvertTransaction = transactionMap.getTransaction(to, from);
+		const bool isInverted = pInvertTransaction && pInvertTransaction->isInvertedTransaction();
+
+		Journal::Encoder encoder;
+		encoder.putU64(from->getOrdinal());
+		encoder.putU64(to->getOrdinal());
+		encoder.putU64(pTransaction->getDecimalPlace());
+		encoder.putU64(pTransaction->getOrderDecimalPlace());
+		encoder.putDecimal(pTransaction->getFeePercent());
+		encoder.putDecimal(pTransaction->getFeeFixed());
+		pTransaction->getBoundaries().encode(encoder);
+		encoder.putU8(isInverted);
+		encoder.putU64((isInverted) ? pInvertTransaction->getDecimalPlace() : 0);
+		encoder.putU64((isInverted) ? pInvertTransaction->getOrderDecimalPlace() : 0);
+		batch.add(RecordType::PAIR, encoder);
+	});
+
+	Journal journal(path);
+	journal.checkpoint(batch);
+}
+
+bool Trader::PropertiesSnapshot::load(
+		const std::string& path,
+		const Id exchangeId,
+		PairTransactionMap& transactionMap,
+		std::string& state)
+{
+	if (::access(path.c_str(), R_OK))
+	{
+		return false;
+	}
+
+	PairTransactionMap loadedMap;
+	std::string loadedState;
+	bool isValid = false;
+	try
+	{
+		Journal journal(path);
+		journal.replay([&](const Journal::RecordType type, Journal::Decoder& decoder) {
+			switch (type)
+			{
+			case RecordType::HEADER:
+				isValid = (decoder.getU64() == FORMAT_VERSION);
+				isValid &= (decoder.getU64() == Currency::NB_CURRENCIES);
+				isValid &= (decoder.getString() == exchangeId.c_str());
+				loadedState = decoder.getString();
+				break;
+			case RecordType::PAIR:
+				if (isValid)
+				{
+					const size_t ordinalFrom = decoder.getU64();
+					const size_t ordinalTo = decoder.getU64();
+					IRSTD_THROW_ASSERT(TraderPairTransactionMap, ordinalFrom < Currency::NB_CURRENCIES
+							&& ordinalTo < Currency::NB_CURRENCIES, "Invalid currency ordinal");
+
+					PairTransactionImpl transaction(Currency::fromOrdinal(ordinalFrom), Currency::fromOrdinal(ordinalTo));
+					transaction.setDecimalPlace(decoder.getU64());
+					transaction.setOrderDecimalPlace(decoder.getU64());
+					transaction.setFeePercent(decoder.getDecimal());
+					transaction.setFeeFixed(decoder.getDecimal());
+					transaction.m_boundaries = Boundaries(decoder);
+					loadedMap.registerPair<PairTransactionImpl>(transaction);
+
+					const bool isInverted = decoder.getU8();
+					const size_t invertDecimalPlace = decoder.getU64();
+					const size_t invertOrderDecimalPlace = decoder.getU64();
+					if (isInverted)
+					{
+						auto pInvertTransaction = loadedMap.registerInvertPair<InvertPairTransactionImpl>(transaction);
+						pInvertTransaction->setDecimalPlace(invertDecimalPlace);
+						pInvertTransaction->setOrderDecimalPlace(invertOrderDecimalPlace);
+					}
+				}
+				break;
+			default:
+				IRSTD_THROW(TraderPairTransactionMap, "Unknown record type " << static_cast<size_t>(type));
+			}
+		});
+	}
+	catch (const IrStd::Exception& e)
+	{
+		IRSTD_LOG_WARNING(TraderPairTransactionMap, "Ignoring the properties snapshot " << path << ": " << e);
+		return false;
+	}
+
+	if (!isValid)
+	{
+		IRSTD_LOG_INFO(TraderPairTransactionMap, "Ignoring the properties snapshot " << path
+				<< ", it was written by another version");
+		return false;
+	}
+
+	transactionMap = loadedMap;
+	state.swap(loadedState);
+	return true;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+
+#include "IrStd/IrStd.hpp"
+
+#include "Trader/Generic/Id/Id.hpp"
+#include "Trader/Generic/Journal/Journal.hpp"
+#include "Trader/Exchange/Transaction/PairTransactionMap.hpp"
+
+namespace Trader
+{
+	/**
+	 * Binary snapshot of the properties of an exchange, to start with the
+	 * properties of the previous run while they are downloaded again.
+	 *
+	 * It contains the pairs with their fees, boundaries and decimal places,
+	 * and an opaque state of the exchange implementation. The file is
+	 * replaced atomically. A snapshot written by a different format version,
+	 * currency list or exchange is ignored.
+	 */
+	class PropertiesSnapshot
+	{
+	public:
+		static constexpr uint64_t FORMAT_VERSION = 1;
+
+		static void save(const std::string& path, const Id exchangeId,
+				const PairTransactionMap& transactionMap, const std::string& state);
+
+		/**
+		 * \return false if there is no valid snapshot, \p transactionMap and
+		 * \p state are then left untouched.
+		 */
+		static bool load(const std::string& path, const Id exchangeId,
+				PairTransactionMap& transactionMap, std::string& state);
+
+	private:
+		enum RecordType : Journal::RecordType
+		{
+			HEADER = 1,
+			PAIR
+		};
+	};
+}
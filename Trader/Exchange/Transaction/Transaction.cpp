@@ -1,6 +1,8 @@
 #include "IrStd/IrStd.hpp"
 
 #include "Trader/Exchange/Transaction/Transaction.hpp"
+#include "Trader/Generic/Event/CountDown.hpp"
+#include "Trader/Generic/FixedPoint/FixedPoint.hpp"
 
 IRSTD_TOPIC_REGISTER(Trader, Transaction);
 IRSTD_TOPIC_USE_ALIAS(TraderTransaction, Trader, Transaction);
@@ -14,6 +16,7 @@ Trader::Transaction::Transaction(
 		, m_decimalPlace(14)
 		, m_decimalPlaceOrder(14)
 		, m_isFirst(true)
+		, m_pFirstRateCountDown(nullptr)
 {
 }
 
@@ -23,7 +26,8 @@ Trader::Transaction::Transaction(const Transaction& transaction)
 		, m_finalCurrency(transaction.m_finalCurrency)
 		, m_decimalPlace(transaction.m_decimalPlace)
 		, m_decimalPlaceOrder(transaction.m_decimalPlaceOrder)
-		, m_isFirst(transaction.m_isFirst)
+		, m_isFirst(transaction.m_isFirst.load())
+		, m_pFirstRateCountDown(nullptr)
 {
 }
 
@@ -53,10 +57,9 @@ void Trader::Transaction::setRate(const IrStd::Type::Decimal rate, const IrStd::
 		return;
 	}
 
-	// Get and format the rate
-	const auto currentRate = getRate();
-	const IrStd::Type::Decimal newRate = IrStd::Type::doubleFormat(rate,
-			getDecimalPlace(), IrStd::TypeFormat::FLAG_ROUND);
+	// Get and format the rate, the current one was already formatted
+	const FixedPoint currentRate(getRate(), getDecimalPlace());
+	const FixedPoint newRate(rate, getDecimalPlace());
 
 	if (newRate != currentRate && timestamp == currentTimestamp)
 	{
@@ -65,7 +68,7 @@ void Trader::Transaction::setRate(const IrStd::Type::Decimal rate, const IrStd::
 	//			<< currentRate << " -> " << newRate << ")");
 	}
 
-	IRSTD_THROW_ASSERT(TraderTransaction, newRate > 0., "Rate for " << *this
+	IRSTD_THROW_ASSERT(TraderTransaction, newRate > FixedPoint(), "Rate for " << *this
 			<< " must be greater than zero, rate=" << rate << ", formated.rate=" << newRate);
 
 	// Update only if rates are different
@@ -77,8 +80,14 @@ void Trader::Transaction::setRate(const IrStd::Type::Decimal rate, const IrStd::
 		{
 			m_previousRates.push(data.m_timestamp, data.m_rate);
 		}
-		m_isFirst = false;
-		m_data.store({newRate, timestamp});
+		m_data.store({newRate.toDecimal(), timestamp});
+		if (m_isFirst.exchange(false))
+		{
+			if (const auto pCountDown = m_pFirstRateCountDown.exchange(nullptr))
+			{
+				pCountDown->signal();
+			}
+		}
 	}
 }
 
@@ -106,6 +115,19 @@ size_t Trader::Transaction::getNbRates() const noexcept
 	return (m_isFirst) ? 0 : m_previousRates.size() + 1;
 }
 
+void Trader::Transaction::setFirstRateCountDown(CountDown* const pCountDown) noexcept
+{
+	m_pFirstRateCountDown.store(pCountDown);
+	// The first rate might have been set already
+	if (!m_isFirst)
+	{
+		if (const auto pPrevious = m_pFirstRateCountDown.exchange(nullptr))
+		{
+			pPrevious->signal();
+		}
+	}
+}
+
 bool Trader::Transaction::getRates(
 		const IrStd::Type::Timestamp fromTimestamp,
 		const IrStd::Type::Timestamp toTimestamp,
@@ -165,6 +187,18 @@ IrStd::Type::Timestamp Trader::Transaction::getTimestamp() const noexcept
 	return data.m_timestamp;
 }
 
+IrStd::Type::Timestamp Trader::Transaction::getTimestamp(const int position) const
+{
+	IRSTD_ASSERT(TraderTransaction, position <= 0, "The rate history position cannot be in the future");
+	IRSTD_THROW_ASSERT(TraderTransaction, !m_isFirst, "There is no data yet");
+	IRSTD_THROW_ASSERT(TraderTransaction, -position <= static_cast<int>(m_previousRates.size()),
+			"Only history not older than " << m_previousRates.size()
+			<< " previous data points is supported, requested " << position
+			<< " for " << *this);
+
+	return (position == 0) ? getTimestamp() : m_previousRates.head(-(position + 1)).first;
+}
+
 IrStd::Type::Decimal Trader::Transaction::getFinalAmount(const IrStd::Type::Decimal amount, const bool includeFee) const noexcept
 {
 	return (includeFee) ? getFinalAmountImpl(amount, getRate()) : (amount * getRate());
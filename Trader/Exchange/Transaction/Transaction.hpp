@@ -6,11 +6,14 @@
 #include "IrStd/IrStd.hpp"
 
 #include "Trader/Exchange/Currency/Currency.hpp"
+#include "Trader/Generic/Clock/Clock.hpp"
 
 IRSTD_TOPIC_USE(Trader, Transaction);
 
 namespace Trader
 {
+	class CountDown;
+
 	/**
 	 * A transaction is an instance of buying or selling something.
 	 * Every trasnactions consists of buying/selling an amount of good
@@ -47,7 +50,7 @@ namespace Trader
 		 *
 		 * The rate of the transaction i supdated only if the timestamp are different
 		 */
-		void setRate(const IrStd::Type::Decimal rate, const IrStd::Type::Timestamp timestamp = IrStd::Type::Timestamp::now());
+		void setRate(const IrStd::Type::Decimal rate, const IrStd::Type::Timestamp timestamp = Clock::getDefault()->now());
 
 		/**
 		 * \brief Return the rate of the transaction
@@ -71,6 +74,14 @@ namespace Trader
 		 */
 		size_t getNbRates() const noexcept;
 
+		/**
+		 * \brief Signal \p pCountDown when the first rate is set
+		 *
+		 * It is signaled immediately if the transaction has a rate already,
+		 * nullptr unregisters a count down that was not signaled yet.
+		 */
+		void setFirstRateCountDown(CountDown* const pCountDown) noexcept;
+
 		/**
 		 * \brief Retrieves the rates between 2 timestamps
 		 *
@@ -109,6 +120,11 @@ namespace Trader
 		 */
 		IrStd::Type::Timestamp getTimestamp() const noexcept;
 
+		/**
+		 * Get the timestamp of a previous rate for this transaction
+		 */
+		IrStd::Type::Timestamp getTimestamp(const int position) const;
+
 		/**
 		 * Get the final amount after processing the transaction
 		 */
@@ -150,9 +166,10 @@ namespace Trader
 		IrStd::Type::RingBufferSorted<IrStd::Type::Timestamp, IrStd::Type::Decimal, NB_RECORDS> m_previousRates;
 		CurrencyPtr m_initalCurrency;
 		CurrencyPtr m_finalCurrency;
-		IrStd::Type::Decimal m_decimalPlace;
-		IrStd::Type::Decimal m_decimalPlaceOrder;
-		bool m_isFirst;
+		size_t m_decimalPlace;
+		size_t m_decimalPlaceOrder;
+		std::atomic<bool> m_isFirst;
+		std::atomic<CountDown*> m_pFirstRateCountDown;
 	};
 }
 
@@ -10,7 +10,7 @@ Trader::WithdrawTransaction::WithdrawTransaction(
 	, m_feePercent(100)
 	, m_feeFixed(0)
 {
-	setRate(1., IrStd::Type::Timestamp::now());
+	setRate(1., Clock::getDefault()->now());
 }
 
 const IrStd::Type::Gson& Trader::WithdrawTransaction::getData() const noexcept
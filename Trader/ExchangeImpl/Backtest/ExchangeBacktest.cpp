@@ -0,0 +1,232 @@
+#include <sstream>
+
+#include "Trader/ExchangeImpl/Backtest/ExchangeBacktest.hpp"
+
+IRSTD_TOPIC_USE_ALIAS(TraderBacktest, Trader, Backtest);
+
+// ---- Trader::ExchangeBacktest ----------------------------------------------
+
+constexpr double Trader::ExchangeBacktest::FEE_PERCENT;
+constexpr double Trader::ExchangeBacktest::INITIAL_BALANCE_VALUE;
+
+Trader::ExchangeBacktest::ExchangeBacktest(
+		std::shared_ptr<const RateHistory> pHistory,
+		const IrStd::Type::Decimal feePercent,
+		const IrStd::Type::Decimal initialBalanceValue)
+		: Exchange(Id("Backtest"), ConfigurationExchange({
+			{"ratesPollingPeriodMs", 0},
+			{"orderPollingPeriodMs", 1000},
+			{"ratesRecording", false},
+			// The simulated balance does include the reserve
+			{"balanceIncludeReserve", true}}))
+		, m_pHistory(pHistory)
+		, m_feePercent(feePercent)
+		, m_initialBalanceValue(initialBalanceValue)
+		, m_tickIndex(0)
+		, m_pReplayClock(std::make_shared<VirtualClock>())
+		, m_id(1)
+		, m_engine(ConfigurationMock({
+			{"latencyDistribution", IrStd::Type::toIntegral(ConfigurationMock::LatencyDistribution::CONSTANT)},
+			{"latencyMeanMs", 0},
+			{"latencyJitterMs", 0},
+			{"failurePercent", 0},
+			{"seed", 1}
+		}), [this](const CurrencyPtr currency, const IrStd::Type::Decimal value) {
+			const auto unitValue = getEstimate(currency, 1);
+			return (unitValue > 0) ? IrStd::Type::Decimal(value / unitValue) : IrStd::Type::Decimal(0);
+		})
+{
+	IRSTD_THROW_ASSERT(TraderBacktest, m_pHistory, "A rate history must be provided");
+	setClock(m_pReplayClock);
+}
+
+bool Trader::ExchangeBacktest::isCompleted() const noexcept
+{
+	return (m_tickIndex >= m_pHistory->getTicks().size());
+}
+
+IrStd::Type::Timestamp Trader::ExchangeBacktest::getReplayTimestamp() const noexcept
+{
+	return m_pReplayClock->now();
+}
+
+size_t Trader::ExchangeBacktest::getNbTicksReplayed() const noexcept
+{
+	return m_tickIndex;
+}
+
+void Trader::ExchangeBacktest::setMockConfiguration(ConfigurationMock&& config)
+{
+	m_engine.setConfiguration(std::move(config));
+}
+
+const Trader::MatchingEngine::Statistics& Trader::ExchangeBacktest::getMockStatistics() const noexcept
+{
+	return m_engine.getStatistics();
+}
+
+void Trader::ExchangeBacktest::updatePropertiesImpl(PairTransactionMap& transactionMap)
+{
+	for (const auto& pair : m_pHistory->getPairs())
+	{
+		PairTransactionImpl transaction(pair.m_initialCurrency, pair.m_finalCurrency);
+		transaction.setFeePercent(m_feePercent);
+
+		transactionMap.registerPair<PairTransactionImpl>(transaction);
+		transactionMap.registerInvertPair<InvertPairTransactionImpl>(transaction);
+	}
+}
+
+void Trader::ExchangeBacktest::updateRatesImpl()
+{
+	const auto& tickList = m_pHistory->getTicks();
+	if (isCompleted())
+	{
+		return;
+	}
+
+	{
+		auto scope = m_lockRates.writeScope();
+
+		// The first time, replay until all recorded rates are known
+		if (m_tickIndex == 0)
+		{
+			const auto& pairList = m_pHistory->getPairs();
+			std::vector<bool> isSetList(pairList.size() * 2, false);
+			size_t nbLeft = 0;
+			for (const auto& pair : pairList)
+			{
+				nbLeft += ((pair.m_isRecorded) ? 1 : 0) + ((pair.m_isInvertedRecorded) ? 1 : 0);
+			}
+			for (; !isCompleted() && nbLeft; ++m_tickIndex)
+			{
+				const auto& tick = tickList[m_tickIndex];
+				const size_t index = tick.m_pairIndex * 2 + ((tick.m_isInverted) ? 1 : 0);
+				if (!isSetList[index])
+				{
+					isSetList[index] = true;
+					--nbLeft;
+				}
+				replayTick(tick);
+			}
+		}
+
+		// Replay all the ticks sharing the same timestamp
+		if (!isCompleted())
+		{
+			const auto timestamp = tickList[m_tickIndex].m_timestamp;
+			for (; !isCompleted() && tickList[m_tickIndex].m_timestamp == timestamp; ++m_tickIndex)
+			{
+				replayTick(tickList[m_tickIndex]);
+			}
+		}
+	}
+
+	matchOrders();
+}
+
+void Trader::ExchangeBacktest::replayTick(const RateHistory::Tick& tick)
+{
+	const auto& pair = m_pHistory->getPairs()[tick.m_pairIndex];
+	auto pTransaction = getTransactionMap().getTransactionForWrite(pair.m_initialCurrency, pair.m_finalCurrency);
+
+	// If only one direction is recorded, use it for both (no spread)
+	const bool isBidPrice = !tick.m_isInverted || !pair.m_isRecorded;
+	const bool isAskPrice = tick.m_isInverted || !pair.m_isInvertedRecorded;
+	const IrStd::Type::Decimal price = (tick.m_isInverted) ? IrStd::Type::Decimal(1. / tick.m_rate) : tick.m_rate;
+
+	if (isBidPrice)
+	{
+		pTransaction->setBidPrice(price, tick.m_timestamp);
+	}
+	if (isAskPrice)
+	{
+		pTransaction->setAskPrice(price, tick.m_timestamp);
+	}
+	m_pReplayClock->set(tick.m_timestamp);
+}
+
+void Trader::ExchangeBacktest::matchOrders()
+{
+	m_engine.match(getClock().now(), [this](const TrackOrder& track, const IrStd::Type::Decimal amount,
+			const IrStd::Type::Decimal finalAmount) {
+		const auto& order = track.getOrder();
+		IRSTD_LOG_DEBUG(TraderBacktest, "Filling order #" << track.getId() << " " << order
+				<< " with amount " << amount << " and rate " << order.getTransaction()->getRate());
+
+		const auto balanceAmount = m_mockBalance.get(order.getInitialCurrency());
+		if (balanceAmount < amount)
+		{
+			std::stringstream messageStream;
+			messageStream << "Insufficient funds (" << balanceAmount << " " << order.getInitialCurrency() << ")";
+			IRSTD_LOG_ERROR(TraderBacktest, messageStream.str() << ", cancel order #" << track.getId());
+			// Report it as a failed order, like the live exchanges do when the order is rejected
+			m_orderTrackList.remove(TrackOrderList::RemoveCause::FAILED, track.getId(),
+					messageStream.str().c_str(), /*mustExists*/false);
+			return false;
+		}
+
+		m_mockBalance.add(order.getInitialCurrency(), -amount);
+		m_mockBalance.add(order.getFirstOrderFinalCurrency(), finalAmount);
+		return true;
+	});
+}
+
+void Trader::ExchangeBacktest::setOrderImpl(
+		const Order& order,
+		const IrStd::Type::Decimal amount,
+		std::vector<Id>& idList)
+{
+	IRSTD_THROW_ASSERT(TraderBacktest, order.isFirstValid(amount),
+			"Order is invalid, amount=" << amount << ", order=" << order);
+
+	const auto availableFund = m_mockBalance.get(order.getInitialCurrency());
+	IRSTD_THROW_ASSERT(TraderBacktest, availableFund >= amount,
+			"Insufficient funds, availableFund=" << availableFund << ", amount=" << amount);
+
+	// All orders go through the order book, they will be matched with the next rates
+	const auto orderId = Id(m_id++);
+	const auto timestamp = getClock().now();
+	m_engine.add(TrackOrder(orderId, order, amount, timestamp), timestamp);
+	idList.push_back(orderId);
+}
+
+void Trader::ExchangeBacktest::updateOrdersImpl(std::vector<TrackOrder>& trackOrders)
+{
+	m_engine.each([&](const TrackOrder& track) {
+		trackOrders.push_back(TrackOrder(track.getId(), track.getOrder(), track.getAmount(), track.getCreationTime()));
+	});
+}
+
+void Trader::ExchangeBacktest::cancelOrderImpl(const TrackOrder& order)
+{
+	m_engine.cancel(order.getId());
+}
+
+void Trader::ExchangeBacktest::withdrawImpl(const CurrencyPtr currency, const IrStd::Type::Decimal amount)
+{
+	const auto amountAvailable = m_mockBalance.get(currency);
+	IRSTD_THROW_ASSERT(TraderBacktest, amount <= amountAvailable,
+			"Amount request to withdraw (" << amount << " " << currency
+			<< "), is higher than the amount available (" << amountAvailable
+			<< " " << currency << ")");
+	m_mockBalance.add(currency, -amount);
+}
+
+void Trader::ExchangeBacktest::updateBalanceImpl(Balance& balance)
+{
+	// Initial balance, evenly distributed between currencies
+	if (m_mockBalance.empty())
+	{
+		const auto nbCurrencies = getNbCurrencies();
+		const auto baseCurrency = getEstimateCurrency();
+		const IrStd::Type::Decimal amountPerCurrency = m_initialBalanceValue / nbCurrencies;
+		getCurrencies([&](const CurrencyPtr currency) {
+			const auto pOrder = identifyOrderChain(baseCurrency, currency);
+			const auto amount = (pOrder) ? pOrder->getFinalAmount(amountPerCurrency, /*includeFee*/false)
+					: IrStd::Type::Decimal(0);
+			m_mockBalance.set(currency, amount);
+		});
+	}
+	balance.setFunds(m_mockBalance);
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "Trader/Exchange/Exchange.hpp"
+#include "Trader/Exchange/Order/MatchingEngine.hpp"
+#include "Trader/Backtest/RateHistory.hpp"
+
+namespace Trader
+{
+	/**
+	 * Exchange replaying recorded rates, it must be driven in synchronous mode.
+	 * Orders are matched against the replayed rates by a matching engine, by default
+	 * without latency nor failure, so that a replay always gives the same result. The exchange runs on a virtual
+	 * clock following the replayed timestamps.
+	 */
+	class ExchangeBacktest : public Trader::Exchange
+	{
+	public:
+		static constexpr double FEE_PERCENT = 0.2;
+		static constexpr double INITIAL_BALANCE_VALUE = 2000;
+
+		ExchangeBacktest(std::shared_ptr<const RateHistory> pHistory,
+				const IrStd::Type::Decimal feePercent = FEE_PERCENT,
+				const IrStd::Type::Decimal initialBalanceValue = INITIAL_BALANCE_VALUE);
+
+		/**
+		 * Tells if all the recorded rates have been replayed
+		 */
+		bool isCompleted() const noexcept;
+
+		/**
+		 * Timestamp of the latest rates replayed
+		 */
+		IrStd::Type::Timestamp getReplayTimestamp() const noexcept;
+
+		/**
+		 * Number of ticks replayed so far
+		 */
+		size_t getNbTicksReplayed() const noexcept;
+
+		/**
+		 * Configure the emulated server, the replay stays deterministic as long as a seed is set
+		 */
+		void setMockConfiguration(ConfigurationMock&& config);
+
+		/**
+		 * Fill and latency statistics of the emulated server
+		 */
+		const MatchingEngine::Statistics& getMockStatistics() const noexcept;
+
+	protected:
+		void updatePropertiesImpl(PairTransactionMap& transactionMap) override;
+		void updateRatesImpl() override;
+		void updateBalanceImpl(Balance& balance) override;
+		void updateOrdersImpl(std::vector<TrackOrder>& trackOrders) override;
+		void setOrderImpl(const Order& order, const IrStd::Type::Decimal amount, std::vector<Id>& idList) override;
+		void cancelOrderImpl(const TrackOrder& order) override;
+		void withdrawImpl(const CurrencyPtr currency, const IrStd::Type::Decimal amount) override;
+
+	private:
+		void replayTick(const RateHistory::Tick& tick);
+		void matchOrders();
+
+		std::shared_ptr<const RateHistory> m_pHistory;
+		const IrStd::Type::Decimal m_feePercent;
+		const IrStd::Type::Decimal m_initialBalanceValue;
+		size_t m_tickIndex;
+		std::shared_ptr<VirtualClock> m_pReplayClock;
+
+		/**
+		 * Simulated server state
+		 */
+		Balance m_mockBalance;
+		size_t m_id;
+		MatchingEngine m_engine;
+	};
+}
@@ -80,7 +80,23 @@ void Trader::ExchangeBitfinex::updatePropertiesImpl(PairTransactionMap& transact
 	}
 
 	// Build the ticker URL
-	m_tickerUrl = "https://api.bitfinex.com/v2/tickers?symbols=" + pairs;
+	{
+		auto scope = m_lockProperties.writeScope();
+		m_tickerUrl = "https://api.bitfinex.com/v2/tickers?symbols=" + pairs;
+	}
+}
+
+bool Trader::ExchangeBitfinex::getPropertiesStateImpl(std::string& state) const
+{
+	auto scope = m_lockProperties.readScope();
+	state = m_tickerUrl;
+	return true;
+}
+
+void Trader::ExchangeBitfinex::setPropertiesStateImpl(const std::string& state, PairTransactionMap& /*transactionMap*/)
+{
+	auto scope = m_lockProperties.writeScope();
+	m_tickerUrl = state;
 }
 
 /**
@@ -104,9 +120,15 @@ void Trader::ExchangeBitfinex::updatePropertiesImpl(PairTransactionMap& transact
 void Trader::ExchangeBitfinex::updateRatesImpl()
 {
 	std::string data;
-	const IrStd::Type::Timestamp timestamp = IrStd::Type::Timestamp::now();
+	const IrStd::Type::Timestamp timestamp = getClock().now();
+
+	std::string tickerUrl;
+	{
+		auto scope = m_lockProperties.readScope();
+		tickerUrl = m_tickerUrl;
+	}
 
-	IrStd::FetchUrl fetch(m_tickerUrl.c_str(), data);
+	IrStd::FetchUrl fetch(tickerUrl.c_str(), data);
 	fetch.processSync();
 
 	try
@@ -14,8 +14,12 @@ namespace Trader
 
 		void updateRatesImpl() override;
 		void updatePropertiesImpl(PairTransactionMap& transactionMap) override;
+		bool getPropertiesStateImpl(std::string& state) const override;
+		void setPropertiesStateImpl(const std::string& state, PairTransactionMap& transactionMap) override;
 
 	private:
+		// The rates thread might run while the properties are updated
+		mutable IrStd::RWLock m_lockProperties;
 		std::string m_tickerUrl;
 	};
 }
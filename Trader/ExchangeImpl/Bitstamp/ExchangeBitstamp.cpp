@@ -71,11 +71,11 @@ void Trader::ExchangeBitstamp::websocketReceive(
 		const auto type = json.getNumber("type").val();
 		if (type == 1)
 		{
-			getTransactionMap().getTransactionForWrite(initialCurrency, finalCurrency)->setRate(rate, IrStd::Type::Timestamp::now());
+			getTransactionMap().getTransactionForWrite(initialCurrency, finalCurrency)->setRate(rate, getClock().now());
 		}
 		else
 		{
-			getTransactionMap().getTransactionForWrite(finalCurrency, initialCurrency)->setRate(1. / rate, IrStd::Type::Timestamp::now());
+			getTransactionMap().getTransactionForWrite(finalCurrency, initialCurrency)->setRate(1. / rate, getClock().now());
 		}
 
 		m_eventRates.trigger();
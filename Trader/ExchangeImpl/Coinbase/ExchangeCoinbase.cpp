@@ -1,4 +1,5 @@
 #include "Trader/ExchangeImpl/Coinbase/ExchangeCoinbase.hpp"
+#include "Trader/Generic/Journal/Journal.hpp"
 
 IRSTD_TOPIC_REGISTER(Trader, Coinbase);
 IRSTD_TOPIC_USE_ALIAS(TraderCoinbase, Trader, Coinbase);
@@ -15,12 +16,10 @@ Trader::ExchangeCoinbase::ExchangeCoinbase()
 
 void Trader::ExchangeCoinbase::updatePropertiesImpl(PairTransactionMap& transactionMap)
 {
-	auto scope = m_lockProperties.writeScope();
-
-	// Clear the currency list
-	m_stringToCurrency.clear();
-	m_currencyToString.clear();
-	std::map<CurrencyPtr, IrStd::Type::Decimal> currencyProperties;
+	// Built aside and swapped at the end, the rates thread might be running
+	std::map<std::string, CurrencyPtr> stringToCurrency;
+	std::map<CurrencyPtr, std::string> currencyToString;
+	std::map<CurrencyPtr, std::string> minSizeMap;
 
 	try
 	{
@@ -40,17 +39,16 @@ void Trader::ExchangeCoinbase::updatePropertiesImpl(PairTransactionMap& transact
 
 			if (currency)
 			{
-				IRSTD_ASSERT(TraderCoinbase, m_stringToCurrency.find(currencyStr) == m_stringToCurrency.end(),
+				IRSTD_ASSERT(TraderCoinbase, stringToCurrency.find(currencyStr) == stringToCurrency.end(),
 						"Currency '" << currencyStr << "' as already been registered");
-				IRSTD_ASSERT(TraderCoinbase, m_currencyToString.find(currency) == m_currencyToString.end(),
+				IRSTD_ASSERT(TraderCoinbase, currencyToString.find(currency) == currencyToString.end(),
 						"Currency '" << currency << "' as already been registered");
 				{
-					m_stringToCurrency[currencyStr] = currency;
-					m_currencyToString[currency] = currencyStr;
+					stringToCurrency[currencyStr] = currency;
+					currencyToString[currency] = currencyStr;
 				}
 				// Save the minimum size of the transaction
-				const auto minSize = obj.getString("min_size").val();
-				currencyProperties[currency] = IrStd::Type::Decimal::fromString(minSize);
+				minSizeMap[currency] = obj.getString("min_size").val();
 			}
 			else
 			{
@@ -65,7 +63,7 @@ void Trader::ExchangeCoinbase::updatePropertiesImpl(PairTransactionMap& transact
 	}
 
 	// Define the pair associated with the currencies
-	for (const auto& currencyFrom : m_stringToCurrency)
+	for (const auto& currencyFrom : stringToCurrency)
 	{
 		std::string data;
 
@@ -85,9 +83,9 @@ void Trader::ExchangeCoinbase::updatePropertiesImpl(PairTransactionMap& transact
 			IrStd::Json json(data.c_str());
 			for (const auto& pair : json.getObject("data", "rates"))
 			{
-				const auto it = m_stringToCurrency.find(pair.first);
+				const auto it = stringToCurrency.find(pair.first);
 
-				if (it != m_stringToCurrency.end() && currencyFrom.second != it->second)
+				if (it != stringToCurrency.end() && currencyFrom.second != it->second)
 				{
 					const auto currency1 = currencyFrom.second;
 					const auto currency2 = it->second;
@@ -95,8 +93,8 @@ void Trader::ExchangeCoinbase::updatePropertiesImpl(PairTransactionMap& transact
 					PairTransactionImpl transaction(currency1, currency2);
 					{
 						Boundaries boundaries;
-						boundaries.setInitialAmount(currencyProperties[currency1]);
-						boundaries.setFinalAmount(currencyProperties[currency2]);
+						boundaries.setInitialAmount(FixedPoint::parseDecimal(minSizeMap[currency1].c_str()));
+						boundaries.setFinalAmount(FixedPoint::parseDecimal(minSizeMap[currency2].c_str()));
 						transaction.setBoundaries(boundaries);
 					}
 
@@ -109,6 +107,56 @@ void Trader::ExchangeCoinbase::updatePropertiesImpl(PairTransactionMap& transact
 			IrStd::Exception::rethrowRetry();
 		}
 	}
+
+	{
+		auto scope = m_lockProperties.writeScope();
+		m_stringToCurrency.swap(stringToCurrency);
+		m_currencyToString.swap(currencyToString);
+		m_minSizeMap.swap(minSizeMap);
+	}
+}
+
+bool Trader::ExchangeCoinbase::getPropertiesStateImpl(std::string& state) const
+{
+	auto scope = m_lockProperties.readScope();
+	Journal::Encoder encoder;
+	encoder.putU64(m_stringToCurrency.size());
+	for (const auto& it : m_stringToCurrency)
+	{
+		const auto itMinSize = m_minSizeMap.find(it.second);
+		encoder.putString(it.first);
+		encoder.putU64(it.second->getOrdinal());
+		encoder.putString((itMinSize == m_minSizeMap.end()) ? std::string() : itMinSize->second);
+	}
+	state = encoder.get();
+	return true;
+}
+
+void Trader::ExchangeCoinbase::setPropertiesStateImpl(const std::string& state, PairTransactionMap& /*transactionMap*/)
+{
+	Journal::Decoder decoder(state);
+	std::map<std::string, CurrencyPtr> stringToCurrency;
+	std::map<CurrencyPtr, std::string> currencyToString;
+	std::map<CurrencyPtr, std::string> minSizeMap;
+
+	const size_t nbCurrencies = decoder.getU64();
+	for (size_t i = 0; i < nbCurrencies; ++i)
+	{
+		const auto currencyStr = decoder.getString();
+		const size_t ordinal = decoder.getU64();
+		IRSTD_THROW_ASSERT(TraderCoinbase, ordinal < Currency::NB_CURRENCIES, "Invalid currency ordinal: " << ordinal);
+		const auto currency = Currency::fromOrdinal(ordinal);
+		stringToCurrency[currencyStr] = currency;
+		currencyToString[currency] = currencyStr;
+		minSizeMap[currency] = decoder.getString();
+	}
+
+	{
+		auto scope = m_lockProperties.writeScope();
+		m_stringToCurrency.swap(stringToCurrency);
+		m_currencyToString.swap(currencyToString);
+		m_minSizeMap.swap(minSizeMap);
+	}
 }
 
 void Trader::ExchangeCoinbase::updateRatesSpecificCurrencyImpl(const CurrencyPtr currency)
@@ -126,7 +174,7 @@ void Trader::ExchangeCoinbase::updateRatesSpecificCurrencyImpl(const CurrencyPtr
 		urlStream << it->second;
 	}
 
-	const auto timestamp = IrStd::Type::Timestamp::now();
+	const auto timestamp = getClock().now();
 	std::string data;
 	// Once the data is available, parse it
 	try
@@ -144,7 +192,7 @@ void Trader::ExchangeCoinbase::updateRatesSpecificCurrencyImpl(const CurrencyPtr
 				const auto currency1 = currency;
 				const auto currency2 = it->second;
 				const auto pRateStr = pair.second.getString().val();
-				const auto rate = IrStd::Type::Decimal::fromString(pRateStr);
+				const auto rate = FixedPoint::parseDecimal(pRateStr);
 
 				// Look for the transaction
 				{
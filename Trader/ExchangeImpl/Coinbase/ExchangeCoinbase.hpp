@@ -13,11 +13,15 @@ namespace Trader
 		ExchangeCoinbase();
 
 		void updatePropertiesImpl(PairTransactionMap& transactionMap) override;
+		bool getPropertiesStateImpl(std::string& state) const override;
+		void setPropertiesStateImpl(const std::string& state, PairTransactionMap& transactionMap) override;
 		void updateRatesSpecificCurrencyImpl(const CurrencyPtr currency) override;
 
 	private:
-		IrStd::RWLock m_lockProperties;
+		mutable IrStd::RWLock m_lockProperties;
 		std::map<std::string, CurrencyPtr> m_stringToCurrency;
 		std::map<CurrencyPtr, std::string> m_currencyToString;
+		//! Minimum size of the transactions per currency, as received
+		std::map<CurrencyPtr, std::string> m_minSizeMap;
 	};
 }
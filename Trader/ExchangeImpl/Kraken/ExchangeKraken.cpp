@@ -1,10 +1,21 @@
 #include "Trader/ExchangeImpl/Kraken/ExchangeKraken.hpp"
+#include "Trader/Generic/Journal/Journal.hpp"
 
 IRSTD_TOPIC_REGISTER(Trader, Kraken);
 IRSTD_TOPIC_USE_ALIAS(TraderKraken, Trader, Kraken);
 
 #define KRAKEN_API_URL "https://api.kraken.com"
 
+namespace
+{
+	Trader::CurrencyPtr decodeCurrency(Trader::Journal::Decoder& decoder)
+	{
+		const size_t ordinal = decoder.getU64();
+		IRSTD_THROW_ASSERT(TraderKraken, ordinal < Trader::Currency::NB_CURRENCIES, "Invalid currency ordinal: " << ordinal);
+		return Trader::Currency::fromOrdinal(ordinal);
+	}
+}
+
 // ---- Trader::ExchangeCoinbase --------------------------------------------------
 
 Trader::ExchangeKraken::ExchangeKraken(
@@ -109,10 +120,10 @@ std::shared_ptr<Trader::PairTransaction> Trader::ExchangeKraken::getTransactionF
  */
 void Trader::ExchangeKraken::updatePropertiesImpl(PairTransactionMap& transactionMap)
 {
-	auto scope = m_lockProperties.writeScope();
-	m_tickerUrl.clear();
-	m_currencyMap.clear();
-	m_pairMap.clear();
+	// Built aside and swapped at the end, the rates thread might be running
+	std::map<std::string, CurrencyInfo> currencyMap;
+	std::map<std::string, std::shared_ptr<PairTransaction>> pairMap;
+	std::string tickerUrl;
 
 	// Set server time
 	{
@@ -158,7 +169,7 @@ void Trader::ExchangeKraken::updatePropertiesImpl(PairTransactionMap& transactio
 						IRSTD_LOG_WARNING(TraderKraken, "Unknown currency " << currencyName << ", ignoring");
 						continue;
 					}
-					m_currencyMap[currencyId] = CurrencyInfo{currency, currencyName, decimal};
+					currencyMap[currencyId] = CurrencyInfo{currency, currencyName, decimal};
 				}
 			}
 		}
@@ -189,12 +200,12 @@ void Trader::ExchangeKraken::updatePropertiesImpl(PairTransactionMap& transactio
 					const size_t decimalPlace = item.getNumber("pair_decimals");
 
 					// Try to identify the pair
-					for (const auto it1 : m_currencyMap)
+					for (const auto it1 : currencyMap)
 					{
 						const auto pos = pairName.find(it1.second.m_name);
 						if (pos == 0)
 						{
-							for (const auto it2 : m_currencyMap)
+							for (const auto it2 : currencyMap)
 							{
 								const auto pos2 = pairName.find(it2.second.m_name, pos + it1.second.m_name.size());
 								if (pos2 == pos + it1.second.m_name.size() && pos2 + it2.second.m_name.size() == pairName.size())
@@ -213,10 +224,10 @@ void Trader::ExchangeKraken::updatePropertiesImpl(PairTransactionMap& transactio
 									pInvertTransaction->setDecimalPlace(it1.second.m_decimal);
 
 									// Save the properties
-									m_tickerUrl.append((m_tickerUrl.empty()) ? KRAKEN_API_URL "/0/public/Ticker?pair=" : ",");
-									m_tickerUrl.append(pairId);
-									m_pairMap[pairId] = pTransaction;
-									m_pairMap[pairName] = pTransaction;
+									tickerUrl.append((tickerUrl.empty()) ? KRAKEN_API_URL "/0/public/Ticker?pair=" : ",");
+									tickerUrl.append(pairId);
+									pairMap[pairId] = pTransaction;
+									pairMap[pairName] = pTransaction;
 
 									break;
 								}
@@ -232,6 +243,105 @@ void Trader::ExchangeKraken::updatePropertiesImpl(PairTransactionMap& transactio
 			IrStd::Exception::rethrowRetry();
 		}
 	}
+
+	{
+		auto scope = m_lockProperties.writeScope();
+		m_currencyMap.swap(currencyMap);
+		m_pairMap.swap(pairMap);
+		m_tickerUrl.swap(tickerUrl);
+	}
+}
+
+bool Trader::ExchangeKraken::getPropertiesStateImpl(std::string& state) const
+{
+	auto scope = m_lockProperties.readScope();
+	Journal::Encoder encoder;
+
+	encoder.putU64(m_currencyMap.size());
+	for (const auto& it : m_currencyMap)
+	{
+		encoder.putString(it.first);
+		encoder.putU64(it.second.m_currency->getOrdinal());
+		encoder.putString(it.second.m_name);
+		encoder.putU64(it.second.m_decimal);
+	}
+
+	// Pairs are registered under their identifier and their name
+	encoder.putU64(m_pairMap.size());
+	for (const auto& it : m_pairMap)
+	{
+		encoder.putString(it.first);
+		encoder.putU64(it.second->getInitialCurrency()->getOrdinal());
+		encoder.putU64(it.second->getFinalCurrency()->getOrdinal());
+		encoder.putString(it.second->getData().getString());
+	}
+
+	encoder.putString(m_tickerUrl);
+	state = encoder.get();
+	return true;
+}
+
+void Trader::ExchangeKraken::setPropertiesStateImpl(const std::string& state, PairTransactionMap& transactionMap)
+{
+	Journal::Decoder decoder(state);
+	std::map<std::string, CurrencyInfo> currencyMap;
+	std::map<std::string, std::shared_ptr<PairTransaction>> pairMap;
+	std::string tickerUrl;
+
+	const size_t nbCurrencies = decoder.getU64();
+	for (size_t i = 0; i < nbCurrencies; ++i)
+	{
+		const auto currencyId = decoder.getString();
+		const auto currency = decodeCurrency(decoder);
+		const auto currencyName = decoder.getString();
+		const size_t decimal = decoder.getU64();
+		currencyMap[currencyId] = CurrencyInfo{currency, currencyName, decimal};
+	}
+
+	// The snapshot does not keep the pair identifiers, the pairs are registered again with them
+	PairTransactionMap restoredMap;
+	const size_t nbPairs = decoder.getU64();
+	for (size_t i = 0; i < nbPairs; ++i)
+	{
+		const auto key = decoder.getString();
+		const auto currency1 = decodeCurrency(decoder);
+		const auto currency2 = decodeCurrency(decoder);
+		const auto pairId = decoder.getString();
+
+		auto pTransaction = restoredMap.getTransactionForWrite(currency1, currency2);
+		if (!pTransaction)
+		{
+			const auto pSnapshot = transactionMap.getTransaction(currency1, currency2);
+			IRSTD_THROW_ASSERT(TraderKraken, pSnapshot && !pSnapshot->isInvertedTransaction(),
+					"The pair " << currency1 << "/" << currency2 << " is not part of the snapshot");
+
+			PairTransactionImpl transaction(currency1, currency2, pairId);
+			transaction.setOrderDecimalPlace(pSnapshot->getOrderDecimalPlace());
+			transaction.setDecimalPlace(pSnapshot->getDecimalPlace());
+			transaction.setFeePercent(pSnapshot->getFeePercent());
+			transaction.setFeeFixed(pSnapshot->getFeeFixed());
+			transaction.setBoundaries(pSnapshot->getBoundaries());
+			pTransaction = restoredMap.registerPair<PairTransactionImpl>(transaction);
+
+			if (const auto pSnapshotInvert = transactionMap.getTransaction(currency2, currency1))
+			{
+				auto pInvertTransaction = restoredMap.registerInvertPair<InvertPairTransactionImpl>(transaction);
+				pInvertTransaction->setDecimalPlace(pSnapshotInvert->getDecimalPlace());
+				pInvertTransaction->setOrderDecimalPlace(pSnapshotInvert->getOrderDecimalPlace());
+			}
+		}
+		pairMap[key] = pTransaction;
+	}
+
+	tickerUrl = decoder.getString();
+	transactionMap = restoredMap;
+
+	{
+		auto scope = m_lockProperties.writeScope();
+		m_currencyMap.swap(currencyMap);
+		m_pairMap.swap(pairMap);
+		m_tickerUrl.swap(tickerUrl);
+	}
 }
 
 /**
@@ -254,11 +364,17 @@ void Trader::ExchangeKraken::updatePropertiesImpl(PairTransactionMap& transactio
  */
 void Trader::ExchangeKraken::updateRatesImpl()
 {
+	std::string tickerUrl;
+	{
+		auto scope = m_lockProperties.readScope();
+		tickerUrl = m_tickerUrl;
+	}
+
 	std::string data;
-	IrStd::FetchUrl fetch(m_tickerUrl.c_str(), data);
+	IrStd::FetchUrl fetch(tickerUrl.c_str(), data);
 	fetch.processSync();
 
-	const auto timestamp = IrStd::Type::Timestamp::now();
+	const auto timestamp = getClock().now();
 	try
 	{
 		// Parse a data json
@@ -273,8 +389,8 @@ void Trader::ExchangeKraken::updateRatesImpl()
 				IRSTD_THROW_ASSERT(TraderKraken, result.isObject(pairId.c_str()),
 						"The pair '" << pairId << "' is not registered");
 				{
-					const auto ask = IrStd::Type::Decimal::fromString(result.getArray(pairId.c_str(), "a").getString(0));
-					const auto bid = IrStd::Type::Decimal::fromString(result.getArray(pairId.c_str(), "b").getString(0));
+					const auto ask = FixedPoint::parseDecimal(result.getArray(pairId.c_str(), "a").getString(0).val());
+					const auto bid = FixedPoint::parseDecimal(result.getArray(pairId.c_str(), "b").getString(0).val());
 					auto pTransactionForWrite = getTransactionMap().getTransactionForWrite(currency1, currency2);
 					if (ask && bid)
 					{
@@ -361,7 +477,7 @@ void Trader::ExchangeKraken::updateBalanceImpl(Balance& balance)
 			for (const auto& pair : json.getObject("result"))
 			{
 				const auto currency = getCurrencyFromId(pair.first);
-				const auto funds = IrStd::Type::Decimal::fromString(pair.second.getString());
+				const auto funds = FixedPoint::parseDecimal(pair.second.getString().val());
 
 				balance.set(currency, funds);
 			}
@@ -485,9 +601,9 @@ void Trader::ExchangeKraken::updateOrdersImpl(std::vector<TrackOrder>& trackOrde
 
 			if (::strcmp(orderType, "limit") == 0)
 			{
-				amount = IrStd::Type::Decimal::fromString(orderInfo.getString("vol"))
-						- IrStd::Type::Decimal::fromString(orderInfo.getString("vol_exec"));
-				rate = IrStd::Type::Decimal::fromString(orderDesc.getString("price"));
+				amount = FixedPoint::parseDecimal(orderInfo.getString("vol").val())
+						- FixedPoint::parseDecimal(orderInfo.getString("vol_exec").val());
+				rate = FixedPoint::parseDecimal(orderDesc.getString("price").val());
 			}
 			else
 			{
@@ -14,6 +14,8 @@ namespace Trader
 				const std::initializer_list<std::pair<CurrencyPtr, const std::string>> withdraw = {});
 
 		void updatePropertiesImpl(PairTransactionMap& transactionMap) override;
+		bool getPropertiesStateImpl(std::string& state) const override;
+		void setPropertiesStateImpl(const std::string& state, PairTransactionMap& transactionMap) override;
 		void updateRatesImpl() override;
 		void updateBalanceImpl(Balance& balance) override;
 		void updateOrdersImpl(std::vector<TrackOrder>& trackOrders) override;
@@ -38,7 +38,7 @@ void Trader::ExchangeTest::updatePropertiesImpl(PairTransactionMap& transactionM
 
 void Trader::ExchangeTest::updateRatesImpl()
 {
-	const auto timestamp = IrStd::Type::Timestamp::now();
+	const auto timestamp = getClock().now();
 	auto rand = IrStd::Rand();
 
 	{
@@ -0,0 +1,194 @@
+#include <chrono>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+	#define TRADER_CLOCK_TSC 1
+#endif
+
+#include "Trader/Generic/Clock/Clock.hpp"
+
+IRSTD_TOPIC_REGISTER(Trader, Clock);
+IRSTD_TOPIC_USE_ALIAS(TraderClock, Trader, Clock);
+
+// ---- Trader::Clock ---------------------------------------------------------
+
+std::shared_ptr<Trader::Clock>& Trader::Clock::getDefaultInstance()
+{
+	static std::shared_ptr<Clock> pClock = std::make_shared<WallClock>();
+	return pClock;
+}
+
+const std::shared_ptr<Trader::Clock>& Trader::Clock::getDefault()
+{
+	return getDefaultInstance();
+}
+
+void Trader::Clock::setDefault(std::shared_ptr<Clock> pClock)
+{
+	IRSTD_THROW_ASSERT(TraderClock, pClock, "The default clock cannot be empty");
+	getDefaultInstance() = std::move(pClock);
+}
+
+// ---- Trader::WallClock -----------------------------------------------------
+
+IrStd::Type::Timestamp Trader::WallClock::now() const noexcept
+{
+	return IrStd::Type::Timestamp::now();
+}
+
+bool Trader::WallClock::sleep(const uint64_t durationMs)
+{
+	return IrStd::Threads::sleep(durationMs);
+}
+
+void Trader::WallClock::wait(const uint64_t durationMs)
+{
+	std::this_thread::sleep_for(std::chrono::milliseconds(durationMs));
+}
+
+// ---- Trader::FastClock -----------------------------------------------------
+
+constexpr uint64_t Trader::FastClock::CALIBRATION_MS;
+
+Trader::FastClock::FastClock()
+{
+	const auto start = std::chrono::steady_clock::now();
+	const auto startTicks = readTicks();
+	std::this_thread::sleep_for(std::chrono::milliseconds(CALIBRATION_MS));
+	const auto end = std::chrono::steady_clock::now();
+	m_ticksOrigin = readTicks();
+	m_timestampOrigin = static_cast<uint64_t>(IrStd::Type::Timestamp::now());
+	m_steadyOriginUs = std::chrono::duration_cast<std::chrono::microseconds>(end.time_since_epoch()).count();
+
+	const std::chrono::duration<double, std::milli> elapsed = end - start;
+	IRSTD_THROW_ASSERT(TraderClock, m_ticksOrigin > startTicks, "The tick counter is not monotonic");
+	m_msPerTick = elapsed.count() / (m_ticksOrigin - startTicks);
+
+	IRSTD_LOG_INFO(TraderClock, "Fast clock calibrated at " << (1. / m_msPerTick / 1000.) << "MHz");
+}
+
+const Trader::FastClock& Trader::FastClock::getInstance()
+{
+	static const FastClock clock;
+	return clock;
+}
+
+IrStd::Type::Timestamp Trader::FastClock::now() const noexcept
+{
+	return IrStd::Type::Timestamp(m_timestampOrigin + static_cast<uint64_t>((readTicks() - m_ticksOrigin) * m_msPerTick));
+}
+
+uint64_t Trader::FastClock::nowUs() const noexcept
+{
+	return m_steadyOriginUs + static_cast<uint64_t>((readTicks() - m_ticksOrigin) * m_msPerTick * 1000.);
+}
+
+uint64_t Trader::FastClock::readTicks() noexcept
+{
+#if defined(TRADER_CLOCK_TSC)
+	return __rdtsc();
+#else
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+// ---- Trader::VirtualClock --------------------------------------------------
+
+constexpr uint64_t Trader::VirtualClock::POLLING_PERIOD_MS;
+
+Trader::VirtualClock::VirtualClock(const IrStd::Type::Timestamp origin)
+		: m_timestamp(static_cast<uint64_t>(origin))
+		, m_isInterrupted(false)
+{
+}
+
+IrStd::Type::Timestamp Trader::VirtualClock::now() const noexcept
+{
+	return IrStd::Type::Timestamp(m_timestamp.load());
+}
+
+bool Trader::VirtualClock::sleep(const uint64_t durationMs)
+{
+	return waitUntil(m_timestamp.load() + durationMs, /*isInterruptible*/true);
+}
+
+void Trader::VirtualClock::wait(const uint64_t durationMs)
+{
+	waitUntil(m_timestamp.load() + durationMs, /*isInterruptible*/false);
+}
+
+bool Trader::VirtualClock::waitUntil(const uint64_t deadline, const bool isInterruptible)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	bool isTerminated = false;
+
+	if (m_timestamp.load() < deadline)
+	{
+		const auto it = m_deadlineList.insert(deadline);
+		while (m_timestamp.load() < deadline && !m_isInterrupted)
+		{
+			m_condition.wait_for(lock, std::chrono::milliseconds(POLLING_PERIOD_MS));
+			if (isInterruptible && !IrStd::Threads::isActive())
+			{
+				isTerminated = true;
+				break;
+			}
+		}
+		m_deadlineList.erase(it);
+	}
+
+	return !isTerminated && !m_isInterrupted;
+}
+
+void Trader::VirtualClock::set(const IrStd::Type::Timestamp timestamp)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		IRSTD_THROW_ASSERT(TraderClock, static_cast<uint64_t>(timestamp) >= m_timestamp.load(),
+				"The time cannot go backward (" << timestamp << " < " << now() << ")");
+		m_timestamp = static_cast<uint64_t>(timestamp);
+	}
+	m_condition.notify_all();
+}
+
+void Trader::VirtualClock::advance(const uint64_t durationMs)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_timestamp += durationMs;
+	}
+	m_condition.notify_all();
+}
+
+bool Trader::VirtualClock::advanceToNextEvent()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		// Deadlines already reached belong to threads that are waking up
+		const auto it = m_deadlineList.upper_bound(m_timestamp.load());
+		if (it == m_deadlineList.end())
+		{
+			return false;
+		}
+		m_timestamp = *it;
+	}
+	m_condition.notify_all();
+	return true;
+}
+
+size_t Trader::VirtualClock::getNbSleeping() const noexcept
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_deadlineList.size();
+}
+
+void Trader::VirtualClock::interrupt()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_isInterrupted = true;
+	}
+	m_condition.notify_all();
+}
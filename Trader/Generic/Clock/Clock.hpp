@@ -0,0 +1,163 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <set>
+
+#include "IrStd/IrStd.hpp"
+
+IRSTD_TOPIC_USE(Trader, Clock);
+
+namespace Trader
+{
+	/**
+	 * Source of time for all timing paths (timestamps, polling periods, timeouts).
+	 * It is injected so that simulations can run faster than the wall time.
+	 */
+	class Clock
+	{
+	public:
+		virtual ~Clock() = default;
+
+		/**
+		 * Current timestamp in milliseconds
+		 */
+		virtual IrStd::Type::Timestamp now() const noexcept = 0;
+
+		/**
+		 * Suspend the current thread for \p durationMs.
+		 * Like IrStd::Threads::sleep, it returns false if the thread has been
+		 * terminated meanwhile, hence it must be called from such a thread.
+		 */
+		virtual bool sleep(const uint64_t durationMs) = 0;
+
+		/**
+		 * Suspend the current thread for \p durationMs, this cannot be interrupted.
+		 */
+		virtual void wait(const uint64_t durationMs) = 0;
+
+		/**
+		 * Clock shared by default by all components, the wall clock unless
+		 * another one has been set.
+		 */
+		static const std::shared_ptr<Clock>& getDefault();
+
+		/**
+		 * Replace the default clock, this must be done before any component
+		 * is created (at the beginning of the main for example).
+		 */
+		static void setDefault(std::shared_ptr<Clock> pClock);
+
+	private:
+		static std::shared_ptr<Clock>& getDefaultInstance();
+	};
+
+	/**
+	 * System time
+	 */
+	class WallClock : public Clock
+	{
+	public:
+		IrStd::Type::Timestamp now() const noexcept override;
+		bool sleep(const uint64_t durationMs) override;
+		void wait(const uint64_t durationMs) override;
+	};
+
+	/**
+	 * System time anchored at construction and then advanced using the CPU
+	 * time stamp counter, which is much cheaper to read than the system time.
+	 * It is monotonic but can slightly drift from the system time, it is meant
+	 * for hot paths (timeouts, durations) rather than for dating events, hence
+	 * it must not be the default clock.
+	 * It falls back to the steady clock on non-x86 architectures.
+	 */
+	class FastClock : public WallClock
+	{
+	public:
+		/**
+		 * Time spent measuring the frequency of the counter
+		 */
+		static constexpr uint64_t CALIBRATION_MS = 10;
+
+		FastClock();
+
+		/**
+		 * Instance shared to measure latencies and timeouts, it is calibrated
+		 * on first use.
+		 */
+		static const FastClock& getInstance();
+
+		IrStd::Type::Timestamp now() const noexcept override;
+
+		/**
+		 * Time of the steady clock in microseconds, to measure durations
+		 */
+		uint64_t nowUs() const noexcept;
+
+	private:
+		static uint64_t readTicks() noexcept;
+
+		uint64_t m_timestampOrigin;
+		uint64_t m_steadyOriginUs;
+		uint64_t m_ticksOrigin;
+		double m_msPerTick;
+	};
+
+	/**
+	 * Discrete-event clock, the time only moves when it is told to.
+	 * Threads sleeping on this clock are woken up once the time reaches their
+	 * deadline, the driver can jump directly to the next deadline with
+	 * advanceToNextEvent(), so that idle periods cost nothing.
+	 */
+	class VirtualClock : public Clock
+	{
+	public:
+		/**
+		 * Real time between 2 checks of the thread status while sleeping
+		 */
+		static constexpr uint64_t POLLING_PERIOD_MS = 100;
+
+		explicit VirtualClock(const IrStd::Type::Timestamp origin = IrStd::Type::Timestamp(0));
+
+		IrStd::Type::Timestamp now() const noexcept override;
+		bool sleep(const uint64_t durationMs) override;
+		void wait(const uint64_t durationMs) override;
+
+		/**
+		 * Set the current time, it cannot go backward
+		 */
+		void set(const IrStd::Type::Timestamp timestamp);
+
+		/**
+		 * Move the time forward by \p durationMs
+		 */
+		void advance(const uint64_t durationMs);
+
+		/**
+		 * Move the time to the earliest deadline of the sleeping threads.
+		 * \return false if no thread is sleeping.
+		 */
+		bool advanceToNextEvent();
+
+		/**
+		 * Number of threads currently sleeping on this clock
+		 */
+		size_t getNbSleeping() const noexcept;
+
+		/**
+		 * Wake up all sleeping threads, sleep() will return false from now on.
+		 */
+		void interrupt();
+
+	private:
+		bool waitUntil(const uint64_t deadline, const bool isInterruptible);
+
+		std::atomic<uint64_t> m_timestamp;
+		mutable std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::multiset<uint64_t> m_deadlineList;
+		bool m_isInterrupted;
+	};
+}
@@ -0,0 +1,40 @@
+#include <cstring>
+#include <zlib.h>
+
+#include "Trader/Generic/Compression/Gzip.hpp"
+
+IRSTD_TOPIC_REGISTER(Trader, Gzip);
+IRSTD_TOPIC_USE_ALIAS(TraderGzip, Trader, Gzip);
+
+// ---- Trader::Gzip ----------------------------------------------------------
+
+std::string Trader::Gzip::compress(
+		const char* const pData,
+		const size_t size,
+		const int level)
+{
+	z_stream stream;
+	std::memset(&stream, 0, sizeof(stream));
+	// 15 + 16 to produce a gzip header rather than a zlib one
+	IRSTD_THROW_ASSERT(TraderGzip, deflateInit2(&stream, level, Z_DEFLATED, 15 + 16, 9, Z_DEFAULT_STRATEGY) == Z_OK,
+			"Cannot initialize zlib");
+
+	std::string output(deflateBound(&stream, size), '\0');
+	stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(pData));
+	stream.avail_in = static_cast<uInt>(size);
+	stream.next_out = reinterpret_cast<Bytef*>(&output[0]);
+	stream.avail_out = static_cast<uInt>(output.size());
+	const int result = deflate(&stream, Z_FINISH);
+	output.resize(stream.total_out);
+	deflateEnd(&stream);
+
+	IRSTD_THROW_ASSERT(TraderGzip, result == Z_STREAM_END, "Cannot compress, zlib error: " << result);
+	return output;
+}
+
+std::string Trader::Gzip::compress(
+		const std::string& data,
+		const int level)
+{
+	return compress(data.data(), data.size(), level);
+}
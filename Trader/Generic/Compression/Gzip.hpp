@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+
+#include "IrStd/IrStd.hpp"
+
+IRSTD_TOPIC_USE(Trader, Gzip);
+
+namespace Trader
+{
+	class Gzip
+	{
+	public:
+		/**
+		 * Compress data in the gzip format, the level goes from 1 (fastest) to 9 (smallest)
+		 */
+		static std::string compress(const char* const pData, const size_t size, const int level = 9);
+		static std::string compress(const std::string& data, const int level = 9);
+	};
+}
@@ -19,6 +19,11 @@ namespace Trader
 				: m_json(std::move(configuration.m_json))
 		{
 		}
+		Configuration& operator=(Configuration<T>&& configuration)
+		{
+			m_json = std::move(configuration.m_json);
+			return *this;
+		}
 
 		/**
 		 * \param mustExists keys from map must be present in m_json
@@ -2,15 +2,22 @@
 
 IRSTD_TOPIC_REGISTER(Trader, Context);
 
+constexpr size_t Trader::ContextPool::MAX_FREE_BLOCKS;
+
 // ---- Trader::Context -------------------------------------------------------
 
 namespace
 {
-	static size_t ContextIdCounter = 0;
+	static std::atomic<size_t> ContextIdCounter(0);
 }
 
 Trader::Context::Context()
 		: m_id(++::ContextIdCounter)
+		, m_pType(&getContextType())
+		, m_refCount(0)
+		, m_pBlock(nullptr)
+		, m_blockSize(0)
+		, m_pPool(nullptr)
 {
 }
 
@@ -24,6 +31,96 @@ size_t Trader::Context::getId() const noexcept
 	return m_id;
 }
 
+const Trader::ContextType& Trader::Context::getType() const noexcept
+{
+	return *m_pType;
+}
+
+void Trader::Context::retain() const noexcept
+{
+	m_refCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Trader::Context::release() const noexcept
+{
+	if (m_refCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+	{
+		return;
+	}
+
+	// Last reference, destroy the context and give back its memory
+	auto pContext = const_cast<Context*>(this);
+	auto pPool = std::move(pContext->m_pPool);
+	void* const pBlock = m_pBlock;
+	const size_t size = m_blockSize;
+
+	pContext->~Context();
+
+	if (pPool)
+	{
+		pPool->release(pBlock, size);
+	}
+	else
+	{
+		::operator delete(pBlock);
+	}
+}
+
+// ---- Trader::ContextPool ---------------------------------------------------
+
+Trader::ContextPool::~ContextPool()
+{
+	for (auto& it : m_freeBlockList)
+	{
+		for (auto pBlock : it.second)
+		{
+			::operator delete(pBlock);
+		}
+	}
+}
+
+size_t Trader::ContextPool::getNbFreeBlocks(const size_t size) const noexcept
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	const auto it = m_freeBlockList.find(size);
+	return (it == m_freeBlockList.end()) ? 0 : it->second.size();
+}
+
+void* Trader::ContextPool::allocate(const size_t size)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto it = m_freeBlockList.find(size);
+		if (it == m_freeBlockList.end())
+		{
+			// Reserve the list once, so that release never allocates
+			it = m_freeBlockList.insert(std::make_pair(size, std::vector<void*>())).first;
+			it->second.reserve(MAX_FREE_BLOCKS);
+		}
+		else if (!it->second.empty())
+		{
+			void* const pBlock = it->second.back();
+			it->second.pop_back();
+			return pBlock;
+		}
+	}
+	return ::operator new(size);
+}
+
+void Trader::ContextPool::release(void* const pBlock, const size_t size) noexcept
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto it = m_freeBlockList.find(size);
+		if (it != m_freeBlockList.end() && it->second.size() < MAX_FREE_BLOCKS)
+		{
+			it->second.push_back(pBlock);
+			return;
+		}
+	}
+	::operator delete(pBlock);
+}
+
 std::ostream& operator<<(std::ostream& os, const Trader::ContextHandle& context)
 {
 	if (context)
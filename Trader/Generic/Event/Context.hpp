@@ -1,68 +1,323 @@
 #pragma once
 
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
 
 #include "IrStd/IrStd.hpp"
 
 IRSTD_TOPIC_USE(Trader, Context);
 
+/**
+ * Declare the type of a context, this must be set at the top of every
+ * class deriving from Context. It is used to cast handles without RTTI.
+ */
+#define TRADER_CONTEXT_TYPE(Class, Parent) \
+	public: \
+		typedef Class ContextSelfType; \
+		static const Trader::ContextType& getContextType() noexcept \
+		{ \
+			static const Trader::ContextType type(&Parent::getContextType()); \
+			return type; \
+		} \
+	private:
+
 namespace Trader
 {
-	class Context;
+	/**
+	 * Static type tag of a context, linked to the type tag of its parent.
+	 */
+	class ContextType
+	{
+	public:
+		explicit ContextType(const ContextType* const pParent) noexcept
+				: m_pParent(pParent)
+		{
+		}
+
+		/**
+		 * Tells if this type is \p type or derives from it
+		 */
+		bool isA(const ContextType& type) const noexcept
+		{
+			for (const ContextType* pType = this; pType; pType = pType->m_pParent)
+			{
+				if (pType == &type)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+	private:
+		const ContextType* const m_pParent;
+	};
+
+	template<class T>
+	class ContextHandleImpl;
+	class ContextPool;
+
+	class Context
+	{
+	public:
+		typedef Context ContextSelfType;
+		static const ContextType& getContextType() noexcept
+		{
+			static const ContextType type(nullptr);
+			return type;
+		}
+
+		/**
+		 * Create a context that can be attached to event handlers
+		 */
+		template<class T, class ... Args>
+		static ContextHandleImpl<Context> create(Args&& ... args);
+
+		Context();
+
+		size_t getId() const noexcept;
+
+		/**
+		 * Type of the most derived context
+		 */
+		const ContextType& getType() const noexcept;
+
+		virtual ~Context() = default;
+		virtual void toStream(std::ostream& os) const;
+
+	private:
+		template<class T>
+		friend class ContextHandleImpl;
+		friend class ContextPool;
+
+		/**
+		 * Allocate and construct a context, from \p pPool if set
+		 * or from the heap otherwise.
+		 */
+		template<class T, class ... Args>
+		static T* construct(std::shared_ptr<ContextPool> pPool, Args&& ... args);
+
+		void retain() const noexcept;
+		void release() const noexcept;
+
+		// Unique Id for the context
+		const size_t m_id;
+		const ContextType* m_pType;
+		mutable std::atomic<size_t> m_refCount;
+
+		// Allocation information, to give back the memory on release
+		void* m_pBlock;
+		size_t m_blockSize;
+		std::shared_ptr<ContextPool> m_pPool;
+	};
 
+	/**
+	 * Handle on a context, the reference counter is held by the context itself.
+	 */
 	template<class T>
-	class ContextHandleImpl : public std::shared_ptr<T>
+	class ContextHandleImpl
 	{
 	public:
-		// Forward constructor to shared_ptr and make sure the class is derived from Context
-		template<class ... Args>
-		ContextHandleImpl(Args&& ... args)
-				: std::shared_ptr<T>(std::forward<Args>(args)...)
+		ContextHandleImpl() noexcept
+				: m_pContext(nullptr)
+		{
+		}
+
+		ContextHandleImpl(std::nullptr_t) noexcept
+				: m_pContext(nullptr)
+		{
+		}
+
+		explicit ContextHandleImpl(T* const pContext) noexcept
+				: m_pContext(pContext)
 		{
 			IRSTD_ASSERT_CHILDOF(T, Context);
+			if (m_pContext)
+			{
+				m_pContext->retain();
+			}
+		}
+
+		ContextHandleImpl(const ContextHandleImpl& handle) noexcept
+				: ContextHandleImpl(handle.m_pContext)
+		{
 		}
 
-		// Implicit conversion to ContextHandle
-		ContextHandleImpl(const ContextHandleImpl<Context>& handle)
-				: std::shared_ptr<T>(handle.cast<Context>())
+		ContextHandleImpl(ContextHandleImpl&& handle) noexcept
+				: m_pContext(handle.m_pContext)
 		{
+			handle.m_pContext = nullptr;
 		}
 
+		// Implicit conversion from/to other context handles
+		template<class U>
+		ContextHandleImpl(const ContextHandleImpl<U>& handle) noexcept
+				: ContextHandleImpl(handle.template cast<T>())
+		{
+		}
+
+		~ContextHandleImpl()
+		{
+			reset();
+		}
+
+		ContextHandleImpl& operator=(ContextHandleImpl handle) noexcept
+		{
+			std::swap(m_pContext, handle.m_pContext);
+			return *this;
+		}
+
+		void reset() noexcept
+		{
+			if (m_pContext)
+			{
+				m_pContext->release();
+				m_pContext = nullptr;
+			}
+		}
+
+		T* get() const noexcept
+		{
+			return m_pContext;
+		}
+
+		T* operator->() const noexcept
+		{
+			return m_pContext;
+		}
+
+		T& operator*() const noexcept
+		{
+			return *m_pContext;
+		}
+
+		explicit operator bool() const noexcept
+		{
+			return (m_pContext != nullptr);
+		}
+
+		template<class U>
+		bool operator==(const ContextHandleImpl<U>& handle) const noexcept
+		{
+			return static_cast<const Context*>(m_pContext) == static_cast<const Context*>(handle.get());
+		}
+
+		template<class U>
+		bool operator!=(const ContextHandleImpl<U>& handle) const noexcept
+		{
+			return !(*this == handle);
+		}
+
+		/**
+		 * Cast the handle into a handle of another context type, this is
+		 * a comparison of type tags followed by a static cast.
+		 */
 		template<class U>
 		ContextHandleImpl<U> cast() const noexcept
 		{
-			auto casted = std::dynamic_pointer_cast<U>(*this);
-			IRSTD_ASSERT(IRSTD_TOPIC(Trader, Context), !(*this) || casted, "The dynamic cast to ContextHandle did not work.");
-			return casted;
+			if (!m_pContext)
+			{
+				return ContextHandleImpl<U>();
+			}
+			Context* const pContext = m_pContext;
+			const bool isCastable = pContext->getType().isA(U::getContextType());
+			IRSTD_ASSERT(IRSTD_TOPIC(Trader, Context), isCastable, "The cast to ContextHandle did not work.");
+			return (isCastable) ? ContextHandleImpl<U>(static_cast<U*>(pContext)) : ContextHandleImpl<U>();
 		}
+
+	private:
+		T* m_pContext;
 	};
 
 	typedef ContextHandleImpl<Context> ContextHandle;
 
-	class Context
+	/**
+	 * Pool of memory blocks to allocate contexts from. Blocks are recycled
+	 * per size, to avoid going to the allocator for each context created.
+	 */
+	class ContextPool : public std::enable_shared_from_this<ContextPool>
 	{
 	public:
 		/**
-		 * Create a context that can be attached to event handlers
+		 * Maximum number of free blocks kept per block size
+		 */
+		static constexpr size_t MAX_FREE_BLOCKS = 128;
+
+		ContextPool() = default;
+		ContextPool(const ContextPool&) = delete;
+		ContextPool& operator=(const ContextPool&) = delete;
+		~ContextPool();
+
+		/**
+		 * Create a context from this pool
 		 */
 		template<class T, class ... Args>
-		static ContextHandle create(Args&& ... args)
+		ContextHandle create(Args&& ... args)
 		{
-			auto pContext = std::make_shared<T>(std::forward<Args>(args)...);
-			return ContextHandle(pContext);
+			return ContextHandle(Context::construct<T>(shared_from_this(), std::forward<Args>(args)...));
 		}
 
-		Context();
+		/**
+		 * Number of free blocks of \p size bytes ready to be reused
+		 */
+		size_t getNbFreeBlocks(const size_t size) const noexcept;
 
-		size_t getId() const noexcept;
+	private:
+		friend class Context;
 
-		virtual ~Context() = default;
-		virtual void toStream(std::ostream& os) const;
+		void* allocate(const size_t size);
+		void release(void* const pBlock, const size_t size) noexcept;
 
-	private:
-		// Unique Id for the context
-		const size_t m_id;
+		mutable std::mutex m_mutex;
+		std::map<size_t, std::vector<void*>> m_freeBlockList;
 	};
 }
 
-std::ostream& operator<<(std::ostream& os, const Trader::ContextHandle& context);
\ No newline at end of file
+// ---- Trader::Context (templates) -------------------------------------------
+
+template<class T, class ... Args>
+Trader::ContextHandle Trader::Context::create(Args&& ... args)
+{
+	return ContextHandle(construct<T>(nullptr, std::forward<Args>(args)...));
+}
+
+template<class T, class ... Args>
+T* Trader::Context::construct(std::shared_ptr<ContextPool> pPool, Args&& ... args)
+{
+	IRSTD_ASSERT_CHILDOF(T, Context);
+	static_assert(std::is_same<typename T::ContextSelfType, T>::value,
+			"TRADER_CONTEXT_TYPE must be declared by this context");
+
+	void* const pBlock = (pPool) ? pPool->allocate(sizeof(T)) : ::operator new(sizeof(T));
+	T* pContext;
+	try
+	{
+		pContext = new (pBlock) T(std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		if (pPool)
+		{
+			pPool->release(pBlock, sizeof(T));
+		}
+		else
+		{
+			::operator delete(pBlock);
+		}
+		throw;
+	}
+
+	Context* const pBase = pContext;
+	pBase->m_pType = &T::getContextType();
+	pBase->m_pBlock = pBlock;
+	pBase->m_blockSize = sizeof(T);
+	pBase->m_pPool = std::move(pPool);
+
+	return pContext;
+}
+
+std::ostream& operator<<(std::ostream& os, const Trader::ContextHandle& context);
@@ -0,0 +1,46 @@
+#include <chrono>
+
+#include "Trader/Generic/Event/CountDown.hpp"
+
+// ---- Trader::CountDown -----------------------------------------------------
+
+Trader::CountDown::CountDown()
+		: m_count(0)
+{
+}
+
+void Trader::CountDown::reset(const size_t count)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		m_count = count;
+	}
+	if (!count)
+	{
+		m_cv.notify_all();
+	}
+}
+
+void Trader::CountDown::signal()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		if (!m_count || --m_count)
+		{
+			return;
+		}
+	}
+	m_cv.notify_all();
+}
+
+bool Trader::CountDown::wait(const uint64_t timeoutMs) const
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+	return m_cv.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this]() { return m_count == 0; });
+}
+
+size_t Trader::CountDown::getCount() const
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+	return m_count;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace Trader
+{
+	/**
+	 * Event set once a number of signals have been received, used to wait
+	 * for a set of independent sources to be ready.
+	 */
+	class CountDown
+	{
+	public:
+		CountDown();
+
+		/**
+		 * Set the number of signals to be received
+		 */
+		void reset(const size_t count);
+
+		/**
+		 * Receive a signal, waiters are woken up on the last one. Signals
+		 * received once the count reached zero are ignored.
+		 */
+		void signal();
+
+		/**
+		 * Wait for all the signals
+		 *
+		 * \return true if they have been received before the timeout.
+		 */
+		bool wait(const uint64_t timeoutMs) const;
+
+		/**
+		 * Number of signals still expected
+		 */
+		size_t getCount() const;
+
+	private:
+		mutable std::mutex m_lock;
+		mutable std::condition_variable m_cv;
+		size_t m_count;
+	};
+}
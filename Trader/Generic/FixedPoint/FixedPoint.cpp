@@ -0,0 +1,442 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "Trader/Generic/FixedPoint/FixedPoint.hpp"
+
+IRSTD_TOPIC_REGISTER(Trader, FixedPoint);
+IRSTD_TOPIC_USE_ALIAS(TraderFixedPoint, Trader, FixedPoint);
+
+namespace
+{
+	constexpr int64_t POW10[Trader::FixedPoint::MAX_SCALE + 1] = {
+		1LL,
+		10LL,
+		100LL,
+		1000LL,
+		10000LL,
+		100000LL,
+		1000000LL,
+		10000000LL,
+		100000000LL,
+		1000000000LL,
+		10000000000LL,
+		100000000000LL,
+		1000000000000LL,
+		10000000000000LL,
+		100000000000000LL,
+		1000000000000000LL,
+		10000000000000000LL,
+		100000000000000000LL,
+		1000000000000000000LL
+	};
+
+	// Largest absolute mantissa converted from a double, below the int64 limit
+	constexpr double MAX_MANTISSA = 9e18;
+
+	// Number of ulps under which a scaled number is considered to be an integer,
+	// to absorb the representation error of the double and of the scaling. A
+	// larger margin would round amounts up when flooring at high scales.
+	constexpr double NB_ULPS = 4;
+
+	// "00" to "99", to write the digits 2 at a time
+	constexpr char DIGIT_PAIRS[] =
+			"0001020304050607080910111213141516171819"
+			"2021222324252627282930313233343536373839"
+			"4041424344454647484950515253545556575859"
+			"6061626364656667686970717273747576777879"
+			"8081828384858687888990919293949596979899";
+
+	/**
+	 * Whether the 8 characters loaded in \p chunk are all digits
+	 */
+	inline bool isEightDigits(const uint64_t chunk) noexcept
+	{
+		// Each byte must be within 0x30 and 0x39, adding 6 must not carry out of the low nibble
+		return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) == 0x3030303030303030ULL)
+				&& (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) == 0x3030303030303030ULL);
+	}
+
+	/**
+	 * Value of the 8 digits loaded in \p chunk, the first character in the lowest byte
+	 */
+	inline uint64_t parseEightDigits(uint64_t chunk) noexcept
+	{
+		chunk -= 0x3030303030303030ULL;
+		// Combine adjacent digits into pairs, then pairs into 4 digits, then into 8 digits
+		chunk = (chunk * 10) + (chunk >> 8);
+		chunk = (((chunk & 0x000000FF000000FFULL) * 0x000F424000000064ULL)
+				+ (((chunk >> 16) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >> 32;
+		return chunk;
+	}
+
+	/**
+	 * Read consecutive digits from \p pStr, 8 at a time while possible
+	 */
+	inline void parseDigits(const char*& pStr, const char* const pEnd, uint64_t& value, size_t& nbDigits) noexcept
+	{
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+		while (pEnd - pStr >= 8)
+		{
+			uint64_t chunk;
+			std::memcpy(&chunk, pStr, sizeof(chunk));
+			if (!isEightDigits(chunk))
+			{
+				break;
+			}
+			value = value * 100000000ULL + parseEightDigits(chunk);
+			nbDigits += 8;
+			pStr += 8;
+		}
+#endif
+		while (pStr < pEnd && static_cast<unsigned char>(*pStr - '0') < 10)
+		{
+			value = value * 10 + static_cast<uint64_t>(*pStr - '0');
+			++nbDigits;
+			++pStr;
+		}
+	}
+}
+
+// ---- Trader::FixedPoint ----------------------------------------------------
+
+constexpr size_t Trader::FixedPoint::MAX_SCALE;
+constexpr size_t Trader::FixedPoint::MAX_DIGITS;
+constexpr size_t Trader::FixedPoint::MAX_STRING_SIZE;
+
+Trader::FixedPoint::FixedPoint() noexcept
+		: m_mantissa(0)
+		, m_scale(0)
+{
+}
+
+Trader::FixedPoint::FixedPoint(
+		const IrStd::Type::Decimal value,
+		const size_t scale,
+		const Rounding rounding)
+		: m_mantissa(0)
+		, m_scale(0)
+{
+	IRSTD_THROW_ASSERT(TraderFixedPoint, scale <= MAX_SCALE, "Scale " << scale
+			<< " is greater than the maximum supported (" << MAX_SCALE << ")");
+	IRSTD_THROW_ASSERT(TraderFixedPoint, fromDecimal(value, scale, *this, rounding),
+			"Cannot convert " << value << " with " << scale << " decimal places");
+}
+
+bool Trader::FixedPoint::fromDecimal(
+		const IrStd::Type::Decimal value,
+		const size_t scale,
+		FixedPoint& number,
+		const Rounding rounding) noexcept
+{
+	const double decimal = static_cast<double>(value);
+	if (scale > MAX_SCALE || !std::isfinite(decimal))
+	{
+		return false;
+	}
+
+	size_t actualScale = scale;
+	double scaled = decimal * static_cast<double>(POW10[actualScale]);
+	while (std::fabs(scaled) >= MAX_MANTISSA && actualScale)
+	{
+		scaled = decimal * static_cast<double>(POW10[--actualScale]);
+	}
+	if (std::fabs(scaled) >= MAX_MANTISSA)
+	{
+		return false;
+	}
+
+	number.m_mantissa = roundToInteger(scaled, rounding);
+	number.m_scale = actualScale;
+	return true;
+}
+
+Trader::FixedPoint Trader::FixedPoint::fromMantissa(const int64_t mantissa, const size_t scale)
+{
+	IRSTD_THROW_ASSERT(TraderFixedPoint, scale <= MAX_SCALE, "Scale " << scale
+			<< " is greater than the maximum supported (" << MAX_SCALE << ")");
+	FixedPoint number;
+	number.m_mantissa = mantissa;
+	number.m_scale = scale;
+	return number;
+}
+
+bool Trader::FixedPoint::fromString(const char* const pStr, const size_t length, FixedPoint& number) noexcept
+{
+	const char* pCur = pStr;
+	const char* const pEnd = pStr + length;
+	const bool isNegative = (pCur < pEnd && *pCur == '-');
+	pCur += (isNegative) ? 1 : 0;
+
+	uint64_t value = 0;
+	size_t nbDigits = 0;
+	parseDigits(pCur, pEnd, value, nbDigits);
+	const size_t nbIntegerDigits = nbDigits;
+	if (pCur < pEnd && *pCur == '.')
+	{
+		++pCur;
+		parseDigits(pCur, pEnd, value, nbDigits);
+	}
+
+	// The value cannot overflow with at most 18 digits
+	if (pCur != pEnd || !nbDigits || nbDigits > MAX_DIGITS)
+	{
+		return false;
+	}
+
+	number.m_mantissa = (isNegative) ? -static_cast<int64_t>(value) : static_cast<int64_t>(value);
+	number.m_scale = nbDigits - nbIntegerDigits;
+	return true;
+}
+
+IrStd::Type::Decimal Trader::FixedPoint::parseDecimal(const char* const pStr)
+{
+	FixedPoint number;
+	if (fromString(pStr, std::strlen(pStr), number))
+	{
+		return number.toDecimal();
+	}
+	return IrStd::Type::Decimal::fromString(pStr);
+}
+
+int64_t Trader::FixedPoint::getMantissa() const noexcept
+{
+	return m_mantissa;
+}
+
+size_t Trader::FixedPoint::getScale() const noexcept
+{
+	return m_scale;
+}
+
+IrStd::Type::Decimal Trader::FixedPoint::toDecimal() const noexcept
+{
+	// The division is correctly rounded but the mantissa is rounded first
+	// when it exceeds 2^53, the result can then be off by one ulp
+	return IrStd::Type::Decimal(static_cast<double>(m_mantissa) / static_cast<double>(POW10[m_scale]));
+}
+
+Trader::FixedPoint Trader::FixedPoint::rescale(const size_t scale, const Rounding rounding) const
+{
+	IRSTD_THROW_ASSERT(TraderFixedPoint, scale <= MAX_SCALE, "Scale " << scale
+			<< " is greater than the maximum supported (" << MAX_SCALE << ")");
+
+	if (scale >= m_scale)
+	{
+		int64_t mantissa = m_mantissa;
+		IRSTD_THROW_ASSERT(TraderFixedPoint, upscale(mantissa, scale - m_scale),
+				"Cannot represent " << *this << " with " << scale << " decimal places");
+		return fromMantissa(mantissa, scale);
+	}
+
+	// Integer division truncates toward zero
+	const int64_t divisor = POW10[m_scale - scale];
+	int64_t quotient = m_mantissa / divisor;
+	const int64_t remainder = m_mantissa % divisor;
+	switch (rounding)
+	{
+	case Rounding::ROUND:
+		// Half away from zero, the remainder is lower than 10^18 and cannot overflow
+		if (((remainder < 0) ? -remainder : remainder) * 2 >= divisor)
+		{
+			quotient += (remainder < 0) ? -1 : 1;
+		}
+		break;
+	case Rounding::FLOOR:
+		quotient -= (remainder < 0) ? 1 : 0;
+		break;
+	case Rounding::CEIL:
+		quotient += (remainder > 0) ? 1 : 0;
+		break;
+	default:
+		IRSTD_UNREACHABLE(TraderFixedPoint);
+	}
+	return fromMantissa(quotient, scale);
+}
+
+Trader::FixedPoint Trader::FixedPoint::normalize() const noexcept
+{
+	FixedPoint number(*this);
+	while (number.m_scale && number.m_mantissa % 10 == 0)
+	{
+		number.m_mantissa /= 10;
+		--number.m_scale;
+	}
+	return number;
+}
+
+Trader::FixedPoint Trader::FixedPoint::operator+(const FixedPoint& number) const
+{
+	const size_t scale = std::max(m_scale, number.m_scale);
+	int64_t mantissa1 = m_mantissa;
+	int64_t mantissa2 = number.m_mantissa;
+	int64_t result = 0;
+	IRSTD_THROW_ASSERT(TraderFixedPoint, upscale(mantissa1, scale - m_scale)
+			&& upscale(mantissa2, scale - number.m_scale)
+			&& !__builtin_add_overflow(mantissa1, mantissa2, &result),
+			"Overflow while adding " << *this << " and " << number);
+	return fromMantissa(result, scale);
+}
+
+Trader::FixedPoint Trader::FixedPoint::operator-(const FixedPoint& number) const
+{
+	return *this + (-number);
+}
+
+Trader::FixedPoint Trader::FixedPoint::operator-() const
+{
+	IRSTD_THROW_ASSERT(TraderFixedPoint, m_mantissa != std::numeric_limits<int64_t>::min(),
+			"Cannot negate " << *this);
+	return fromMantissa(-m_mantissa, m_scale);
+}
+
+bool Trader::FixedPoint::operator==(const FixedPoint& number) const noexcept
+{
+	return compare(number) == 0;
+}
+
+bool Trader::FixedPoint::operator!=(const FixedPoint& number) const noexcept
+{
+	return compare(number) != 0;
+}
+
+bool Trader::FixedPoint::operator<(const FixedPoint& number) const noexcept
+{
+	return compare(number) < 0;
+}
+
+bool Trader::FixedPoint::operator<=(const FixedPoint& number) const noexcept
+{
+	return compare(number) <= 0;
+}
+
+bool Trader::FixedPoint::operator>(const FixedPoint& number) const noexcept
+{
+	return compare(number) > 0;
+}
+
+bool Trader::FixedPoint::operator>=(const FixedPoint& number) const noexcept
+{
+	return compare(number) >= 0;
+}
+
+size_t Trader::FixedPoint::toString(char* const pBuffer) const noexcept
+{
+	// Digits are written backward 2 at a time, from the least significant
+	// ones, with at least one digit before the decimal point.
+	char digits[MAX_STRING_SIZE];
+	char* const pDigitsEnd = digits + sizeof(digits);
+	char* pDigit = pDigitsEnd;
+	uint64_t value = (m_mantissa < 0) ? (~static_cast<uint64_t>(m_mantissa) + 1) : static_cast<uint64_t>(m_mantissa);
+	while (value >= 100)
+	{
+		const size_t index = static_cast<size_t>(value % 100) * 2;
+		value /= 100;
+		pDigit -= 2;
+		std::memcpy(pDigit, &DIGIT_PAIRS[index], 2);
+	}
+	if (value >= 10)
+	{
+		pDigit -= 2;
+		std::memcpy(pDigit, &DIGIT_PAIRS[value * 2], 2);
+	}
+	else
+	{
+		*--pDigit = static_cast<char>('0' + value);
+	}
+	while (static_cast<size_t>(pDigitsEnd - pDigit) <= m_scale)
+	{
+		*--pDigit = '0';
+	}
+
+	char* pOut = pBuffer;
+	*pOut = '-';
+	pOut += (m_mantissa < 0) ? 1 : 0;
+	const size_t nbIntegerDigits = static_cast<size_t>(pDigitsEnd - pDigit) - m_scale;
+	std::memcpy(pOut, pDigit, nbIntegerDigits);
+	pOut += nbIntegerDigits;
+	if (m_scale)
+	{
+		*pOut++ = '.';
+		std::memcpy(pOut, pDigit + nbIntegerDigits, m_scale);
+		pOut += m_scale;
+	}
+	*pOut = '\0';
+	return static_cast<size_t>(pOut - pBuffer);
+}
+
+std::string Trader::FixedPoint::toString() const
+{
+	char buffer[MAX_STRING_SIZE];
+	const size_t length = toString(buffer);
+	return std::string(buffer, length);
+}
+
+void Trader::FixedPoint::toStream(std::ostream& os) const
+{
+	char buffer[MAX_STRING_SIZE];
+	toString(buffer);
+	os << buffer;
+}
+
+int Trader::FixedPoint::compare(const FixedPoint& number) const noexcept
+{
+	int64_t mantissa1 = m_mantissa;
+	int64_t mantissa2 = number.m_mantissa;
+	// If the number with the fewest decimal places overflows once aligned,
+	// it is the largest in absolute value.
+	if (m_scale > number.m_scale)
+	{
+		if (!upscale(mantissa2, m_scale - number.m_scale))
+		{
+			return (mantissa2 < 0) ? 1 : -1;
+		}
+	}
+	else if (!upscale(mantissa1, number.m_scale - m_scale))
+	{
+		return (mantissa1 < 0) ? -1 : 1;
+	}
+	return (mantissa1 < mantissa2) ? -1 : ((mantissa1 > mantissa2) ? 1 : 0);
+}
+
+bool Trader::FixedPoint::upscale(int64_t& mantissa, const size_t nbDecimals) noexcept
+{
+	// The mantissa is left untouched if it overflows, to keep its sign
+	int64_t result = 0;
+	if (__builtin_mul_overflow(mantissa, POW10[nbDecimals], &result))
+	{
+		return false;
+	}
+	mantissa = result;
+	return true;
+}
+
+int64_t Trader::FixedPoint::roundToInteger(const double number, const Rounding rounding)
+{
+	const double nearest = std::round(number);
+	// 0.29 * 100 gives 28.999999999999996, it must not be floored to 28
+	if (std::fabs(number - nearest) <= std::max(std::fabs(number), 1.) * NB_ULPS * std::numeric_limits<double>::epsilon())
+	{
+		return static_cast<int64_t>(nearest);
+	}
+
+	switch (rounding)
+	{
+	case Rounding::ROUND:
+		return static_cast<int64_t>(nearest);
+	case Rounding::FLOOR:
+		return static_cast<int64_t>(std::floor(number));
+	case Rounding::CEIL:
+		return static_cast<int64_t>(std::ceil(number));
+	default:
+		IRSTD_UNREACHABLE(TraderFixedPoint);
+	}
+	return 0;
+}
+
+std::ostream& operator<<(std::ostream& os, const Trader::FixedPoint& number)
+{
+	number.toStream(os);
+	return os;
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+
+#include "IrStd/IrStd.hpp"
+
+IRSTD_TOPIC_USE(Trader, FixedPoint);
+
+namespace Trader
+{
+	/**
+	 * Decimal number stored as an integer mantissa and a number of decimal
+	 * places (the scale), value = mantissa / 10^scale.
+	 *
+	 * It is used to round prices and amounts to the decimal places of a pair
+	 * and to format them, with integer operations only. Numbers too large for
+	 * the mantissa at the requested scale get a lower scale, as the precision
+	 * of a double is anyway lower than the one of the mantissa.
+	 */
+	class FixedPoint
+	{
+	public:
+		enum class Rounding
+		{
+			ROUND,
+			FLOOR,
+			CEIL
+		};
+
+		static constexpr size_t MAX_SCALE = 18;
+		/**
+		 * Maximum number of digits of a string parsed by fromString()
+		 */
+		static constexpr size_t MAX_DIGITS = 18;
+		/**
+		 * Size of the buffer needed by toString(), including the null character
+		 */
+		static constexpr size_t MAX_STRING_SIZE = 24;
+
+		FixedPoint() noexcept;
+		/**
+		 * Convert \p value rounded to \p scale decimal places.
+		 * Representation errors of the double are ignored, 0.29 floored to 2
+		 * decimal places gives 0.29 even if 0.29 * 100 < 29.
+		 */
+		FixedPoint(const IrStd::Type::Decimal value, const size_t scale, const Rounding rounding = Rounding::ROUND);
+
+		/**
+		 * Same conversion as the constructor without throwing.
+		 * \return false if the value is not finite, too large or the scale is
+		 * not supported, \p number is then left untouched.
+		 */
+		static bool fromDecimal(const IrStd::Type::Decimal value, const size_t scale,
+				FixedPoint& number, const Rounding rounding = Rounding::ROUND) noexcept;
+
+		/**
+		 * Number equal to \p mantissa / 10^\p scale
+		 */
+		static FixedPoint fromMantissa(const int64_t mantissa, const size_t scale);
+
+		/**
+		 * Parse a number written as [-]digits[.digits] with at most MAX_DIGITS
+		 * digits, its scale is the number of decimal places written.
+		 * Digits are converted 8 at a time.
+		 * \return false if the string has another format.
+		 */
+		static bool fromString(const char* const pStr, const size_t length, FixedPoint& number) noexcept;
+
+		/**
+		 * Parse a decimal number as received from an exchange, the formats not
+		 * supported by fromString() go through the generic parser.
+		 */
+		static IrStd::Type::Decimal parseDecimal(const char* const pStr);
+
+		int64_t getMantissa() const noexcept;
+		size_t getScale() const noexcept;
+
+		/**
+		 * Closest double to the number if the mantissa fits in 53 bits,
+		 * otherwise it can be off by one ulp.
+		 */
+		IrStd::Type::Decimal toDecimal() const noexcept;
+
+		/**
+		 * Convert to another scale, rounding if decimal places are removed
+		 */
+		FixedPoint rescale(const size_t scale, const Rounding rounding = Rounding::ROUND) const;
+		/**
+		 * Same number without the trailing zero decimal places
+		 */
+		FixedPoint normalize() const noexcept;
+
+		FixedPoint operator+(const FixedPoint& number) const;
+		FixedPoint operator-(const FixedPoint& number) const;
+		FixedPoint operator-() const;
+
+		bool operator==(const FixedPoint& number) const noexcept;
+		bool operator!=(const FixedPoint& number) const noexcept;
+		bool operator<(const FixedPoint& number) const noexcept;
+		bool operator<=(const FixedPoint& number) const noexcept;
+		bool operator>(const FixedPoint& number) const noexcept;
+		bool operator>=(const FixedPoint& number) const noexcept;
+
+		/**
+		 * Write the number with exactly getScale() decimal places into
+		 * \p pBuffer of at least MAX_STRING_SIZE characters.
+		 * \return The length of the string.
+		 */
+		size_t toString(char* const pBuffer) const noexcept;
+		std::string toString() const;
+
+		void toStream(std::ostream& os) const;
+
+	private:
+		/**
+		 * -1, 0 or 1 whether the number is lower, equal or greater than \p number
+		 */
+		int compare(const FixedPoint& number) const noexcept;
+		/**
+		 * Add \p nbDecimals decimal places to \p mantissa, false if it overflows
+		 */
+		static bool upscale(int64_t& mantissa, const size_t nbDecimals) noexcept;
+
+		static int64_t roundToInteger(const double number, const Rounding rounding);
+
+		int64_t m_mantissa;
+		size_t m_scale;
+	};
+}
+
+std::ostream& operator<<(std::ostream& os, const Trader::FixedPoint& number);
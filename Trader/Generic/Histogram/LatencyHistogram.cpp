@@ -0,0 +1,111 @@
+#include <algorithm>
+
+#include "Trader/Generic/Histogram/LatencyHistogram.hpp"
+#include "Trader/Generic/Clock/Clock.hpp"
+
+// ---- Trader::LatencyHistogram ----------------------------------------------
+
+constexpr size_t Trader::LatencyHistogram::LINEAR_LIMIT;
+constexpr size_t Trader::LatencyHistogram::SUB_BUCKETS_BITS;
+constexpr size_t Trader::LatencyHistogram::SUB_BUCKETS;
+constexpr size_t Trader::LatencyHistogram::NB_BUCKETS;
+
+Trader::LatencyHistogram::LatencyHistogram()
+{
+	reset();
+}
+
+uint64_t Trader::LatencyHistogram::nowUs() noexcept
+{
+	return FastClock::getInstance().nowUs();
+}
+
+size_t Trader::LatencyHistogram::getBucket(const uint64_t value) noexcept
+{
+	if (value < LINEAR_LIMIT)
+	{
+		return static_cast<size_t>(value);
+	}
+
+	size_t exponent = 4;
+	while (exponent < 63 && (value >> (exponent + 1)))
+	{
+		++exponent;
+	}
+	const size_t subBucket = static_cast<size_t>(value >> (exponent - SUB_BUCKETS_BITS)) & (SUB_BUCKETS - 1);
+	return LINEAR_LIMIT + (exponent - 4) * SUB_BUCKETS + subBucket;
+}
+
+uint64_t Trader::LatencyHistogram::getBucketUpperBound(const size_t index) noexcept
+{
+	if (index < LINEAR_LIMIT)
+	{
+		return index;
+	}
+
+	const size_t exponent = (index - LINEAR_LIMIT) / SUB_BUCKETS + 4;
+	const uint64_t subBucket = (index - LINEAR_LIMIT) % SUB_BUCKETS;
+	const uint64_t width = static_cast<uint64_t>(1) << (exponent - SUB_BUCKETS_BITS);
+	return (SUB_BUCKETS + subBucket) * width + width - 1;
+}
+
+void Trader::LatencyHistogram::record(const uint64_t valueUs) noexcept
+{
+	m_bucketList[getBucket(valueUs)].fetch_add(1, std::memory_order_relaxed);
+	m_count.fetch_add(1, std::memory_order_relaxed);
+	m_sum.fetch_add(valueUs, std::memory_order_relaxed);
+
+	uint64_t max = m_max.load(std::memory_order_relaxed);
+	while (valueUs > max && !m_max.compare_exchange_weak(max, valueUs, std::memory_order_relaxed))
+	{
+	}
+}
+
+void Trader::LatencyHistogram::reset() noexcept
+{
+	for (auto& bucket : m_bucketList)
+	{
+		bucket.store(0, std::memory_order_relaxed);
+	}
+	m_count.store(0, std::memory_order_relaxed);
+	m_sum.store(0, std::memory_order_relaxed);
+	m_max.store(0, std::memory_order_relaxed);
+}
+
+uint64_t Trader::LatencyHistogram::getPercentile(const double percent) const noexcept
+{
+	const uint64_t count = getCount();
+	if (!count)
+	{
+		return 0;
+	}
+
+	// Rank of the value looked for, starting from 1
+	const uint64_t rank = std::max<uint64_t>(static_cast<uint64_t>(percent / 100. * count + 0.5), 1);
+	uint64_t nbValues = 0;
+	for (size_t index = 0; index < NB_BUCKETS; ++index)
+	{
+		nbValues += m_bucketList[index].load(std::memory_order_relaxed);
+		if (nbValues >= rank)
+		{
+			return std::min(getBucketUpperBound(index), getMax());
+		}
+	}
+	return getMax();
+}
+
+uint64_t Trader::LatencyHistogram::getMax() const noexcept
+{
+	return m_max.load(std::memory_order_relaxed);
+}
+
+uint64_t Trader::LatencyHistogram::getMean() const noexcept
+{
+	const uint64_t count = getCount();
+	return (count) ? m_sum.load(std::memory_order_relaxed) / count : 0;
+}
+
+uint64_t Trader::LatencyHistogram::getCount() const noexcept
+{
+	return m_count.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+
+#include "IrStd/IrStd.hpp"
+
+namespace Trader
+{
+	/**
+	 * Histogram of durations in microseconds, with a relative precision of 12.5%.
+	 * Values can be recorded and read concurrently from any thread.
+	 */
+	class LatencyHistogram
+	{
+	public:
+		LatencyHistogram();
+
+		/**
+		 * Current time of a monotonic clock in microseconds, to measure durations
+		 */
+		static uint64_t nowUs() noexcept;
+
+		void record(const uint64_t valueUs) noexcept;
+		void reset() noexcept;
+
+		/**
+		 * Value under which \p percent of the recorded values are.
+		 * It is the upper bound of the bucket, capped by the maximum value.
+		 */
+		uint64_t getPercentile(const double percent) const noexcept;
+
+		uint64_t getMax() const noexcept;
+		uint64_t getMean() const noexcept;
+		uint64_t getCount() const noexcept;
+
+	private:
+		// Values below are stored exactly, then each power of 2 is split in SUB_BUCKETS
+		static constexpr size_t LINEAR_LIMIT = 16;
+		static constexpr size_t SUB_BUCKETS_BITS = 3;
+		static constexpr size_t SUB_BUCKETS = 1 << SUB_BUCKETS_BITS;
+		static constexpr size_t NB_BUCKETS = LINEAR_LIMIT + (64 - 4) * SUB_BUCKETS;
+
+		static size_t getBucket(const uint64_t value) noexcept;
+		static uint64_t getBucketUpperBound(const size_t index) noexcept;
+
+		std::array<std::atomic<uint64_t>, NB_BUCKETS> m_bucketList;
+		std::atomic<uint64_t> m_count;
+		std::atomic<uint64_t> m_sum;
+		std::atomic<uint64_t> m_max;
+	};
+}
@@ -0,0 +1,437 @@
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <type_traits>
+#include <unistd.h>
+
+#include "Trader/Generic/Journal/Journal.hpp"
+
+IRSTD_TOPIC_REGISTER(Trader, Journal);
+IRSTD_TOPIC_USE_ALIAS(TraderJournal, Trader, Journal);
+
+namespace
+{
+	// Size of the record header: payload size, checksum and type
+	constexpr size_t HEADER_SIZE = 4 + 4 + 1;
+	// Delay before writing again records that could not be written
+	constexpr uint64_t RETRY_PERIOD_MS = 1000;
+
+	static_assert(std::is_trivially_copyable<IrStd::Type::Decimal>::value,
+			"Decimals are journaled as represented in memory");
+
+	/**
+	 * FNV-1a hash, to detect torn or corrupted records
+	 */
+	uint32_t checksum(const char* const pData, const size_t size) noexcept
+	{
+		uint32_t hash = 2166136261u;
+		for (size_t i = 0; i < size; ++i)
+		{
+			hash ^= static_cast<uint8_t>(pData[i]);
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+}
+
+// ---- Trader::Journal::Encoder ----------------------------------------------
+
+void Trader::Journal::Encoder::putU8(const uint8_t value)
+{
+	m_data.push_back(static_cast<char>(value));
+}
+
+void Trader::Journal::Encoder::putU64(const uint64_t value)
+{
+	m_data.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void Trader::Journal::Encoder::putDouble(const double value)
+{
+	m_data.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void Trader::Journal::Encoder::putDecimal(const IrStd::Type::Decimal value)
+{
+	m_data.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void Trader::Journal::Encoder::putString(const std::string& value)
+{
+	putU64(value.size());
+	m_data.append(value);
+}
+
+const std::string& Trader::Journal::Encoder::get() const noexcept
+{
+	return m_data;
+}
+
+// ---- Trader::Journal::Decoder ----------------------------------------------
+
+Trader::Journal::Decoder::Decoder(const std::string& data)
+		: m_data(data)
+		, m_position(0)
+{
+}
+
+const char* Trader::Journal::Decoder::read(const size_t size)
+{
+	IRSTD_THROW_ASSERT(TraderJournal, m_position + size <= m_data.size(), "Journal record is too short, expected "
+			<< size << " more byte(s) at position " << m_position << " of " << m_data.size());
+	const char* const pData = m_data.data() + m_position;
+	m_position += size;
+	return pData;
+}
+
+uint8_t Trader::Journal::Decoder::getU8()
+{
+	return static_cast<uint8_t>(*read(1));
+}
+
+uint64_t Trader::Journal::Decoder::getU64()
+{
+	uint64_t value;
+	std::memcpy(&value, read(sizeof(value)), sizeof(value));
+	return value;
+}
+
+double Trader::Journal::Decoder::getDouble()
+{
+	double value;
+	std::memcpy(&value, read(sizeof(value)), sizeof(value));
+	return value;
+}
+
+IrStd::Type::Decimal Trader::Journal::Decoder::getDecimal()
+{
+	IrStd::Type::Decimal value(0);
+	std::memcpy(&value, read(sizeof(value)), sizeof(value));
+	return value;
+}
+
+std::string Trader::Journal::Decoder::getString()
+{
+	const size_t size = getU64();
+	return std::string(read(size), size);
+}
+
+// ---- Trader::Journal::Batch ------------------------------------------------
+
+void Trader::Journal::Batch::add(const RecordType type, const Encoder& payload)
+{
+	encodeRecord(m_data, type, payload);
+}
+
+const std::string& Trader::Journal::Batch::get() const noexcept
+{
+	return m_data;
+}
+
+// ---- Trader::Journal -------------------------------------------------------
+
+Trader::Journal::Journal(
+		const std::string& path,
+		const uint64_t commitPeriodMs)
+		: m_path(path)
+		, m_commitPeriodMs(commitPeriodMs)
+		, m_fd(-1)
+		, m_appendSequence(0)
+		, m_commitSequence(0)
+		, m_nbCommitErrors(0)
+		, m_isSyncRequested(false)
+		, m_isRunning(true)
+{
+	open();
+	m_threadId = IrStd::Threads::create("Journal", &Journal::commitThread, this);
+}
+
+Trader::Journal::~Journal()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		m_isRunning = false;
+	}
+	m_condition.notify_all();
+	IrStd::Threads::terminate(m_threadId);
+	close();
+}
+
+void Trader::Journal::open()
+{
+	m_fd = ::open(m_path.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+	IRSTD_THROW_ASSERT(TraderJournal, m_fd >= 0, "Cannot open the journal '" << m_path
+			<< "': " << std::strerror(errno));
+}
+
+void Trader::Journal::close() noexcept
+{
+	if (m_fd >= 0)
+	{
+		::close(m_fd);
+		m_fd = -1;
+	}
+}
+
+const std::string& Trader::Journal::getPath() const noexcept
+{
+	return m_path;
+}
+
+void Trader::Journal::encodeRecord(
+		std::string& data,
+		const RecordType type,
+		const Encoder& payload)
+{
+	const std::string& content = payload.get();
+	const uint32_t size = static_cast<uint32_t>(content.size());
+	// The checksum covers the type and the payload
+	std::string typeAndPayload(1, static_cast<char>(type));
+	typeAndPayload.append(content);
+	const uint32_t hash = checksum(typeAndPayload.data(), typeAndPayload.size());
+
+	data.append(reinterpret_cast<const char*>(&size), sizeof(size));
+	data.append(reinterpret_cast<const char*>(&hash), sizeof(hash));
+	data.append(typeAndPayload);
+}
+
+void Trader::Journal::writeAll(
+		const int fd,
+		const std::string& data,
+		const std::string& path)
+{
+	size_t offset = 0;
+	while (offset < data.size())
+	{
+		const ssize_t written = ::write(fd, data.data() + offset, data.size() - offset);
+		if (written < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		IRSTD_THROW_ASSERT(TraderJournal, written > 0, "Cannot write to the journal '" << path
+				<< "': " << std::strerror(errno));
+		offset += static_cast<size_t>(written);
+	}
+	IRSTD_THROW_ASSERT(TraderJournal, ::fdatasync(fd) == 0, "Cannot sync the journal '" << path
+			<< "': " << std::strerror(errno));
+}
+
+void Trader::Journal::syncDirectory(const std::string& path)
+{
+	const size_t position = path.find_last_of('/');
+	const std::string directory = (position == std::string::npos) ? "." : path.substr(0, std::max<size_t>(position, 1));
+
+	const int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	IRSTD_THROW_ASSERT(TraderJournal, fd >= 0, "Cannot open the directory '" << directory
+			<< "': " << std::strerror(errno));
+	const int result = ::fsync(fd);
+	const int error = errno;
+	::close(fd);
+	IRSTD_THROW_ASSERT(TraderJournal, result == 0, "Cannot sync the directory '" << directory
+			<< "': " << std::strerror(error));
+}
+
+void Trader::Journal::append(
+		const RecordType type,
+		const Encoder& payload)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		encodeRecord(m_buffer, type, payload);
+		++m_appendSequence;
+	}
+	m_condition.notify_all();
+}
+
+void Trader::Journal::sync()
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+	const uint64_t sequence = m_appendSequence;
+	const uint64_t nbCommitErrors = m_nbCommitErrors;
+	m_isSyncRequested = true;
+	m_condition.notify_all();
+	m_condition.wait(lock, [&]() {
+		return m_commitSequence >= sequence || m_nbCommitErrors != nbCommitErrors || !m_isRunning;
+	});
+	IRSTD_THROW_ASSERT(TraderJournal, m_commitSequence >= sequence || m_nbCommitErrors == nbCommitErrors,
+			"Cannot write the journal '" << m_path << "': " << m_commitError);
+}
+
+void Trader::Journal::commitThread()
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+	while (m_isRunning || !m_buffer.empty())
+	{
+		m_condition.wait(lock, [&]() {
+			return !m_buffer.empty() || !m_isRunning;
+		});
+		if (m_buffer.empty())
+		{
+			continue;
+		}
+
+		// Give some time for other records to join this commit
+		m_condition.wait_for(lock, std::chrono::milliseconds(m_commitPeriodMs), [&]() {
+			return m_isSyncRequested || !m_isRunning;
+		});
+		lock.unlock();
+
+		bool isCommitted = true;
+		{
+			// The file lock is taken first, to not race with a checkpoint
+			std::lock_guard<std::mutex> fileLock(m_fileLock);
+			std::string data;
+			uint64_t sequence;
+			{
+				std::lock_guard<std::mutex> bufferLock(m_lock);
+				data.swap(m_buffer);
+				sequence = m_appendSequence;
+				m_isSyncRequested = false;
+			}
+
+			// Keep the end of the file, a partial write is removed so that the records can be written again
+			const off_t size = ::lseek(m_fd, 0, SEEK_END);
+			std::string error;
+			try
+			{
+				IRSTD_THROW_ASSERT(TraderJournal, size >= 0, "Cannot seek the journal '" << m_path
+						<< "': " << std::strerror(errno));
+				writeAll(m_fd, data, m_path);
+			}
+			catch (const IrStd::Exception& e)
+			{
+				error = e.what();
+				if (size >= 0 && ::ftruncate(m_fd, size) != 0)
+				{
+					IRSTD_LOG_ERROR(TraderJournal, "Cannot truncate the journal '" << m_path
+							<< "': " << std::strerror(errno));
+				}
+			}
+
+			std::lock_guard<std::mutex> bufferLock(m_lock);
+			if (error.empty())
+			{
+				m_commitSequence = std::max(m_commitSequence, sequence);
+			}
+			else
+			{
+				// The records are kept before the ones appended meanwhile, nothing is marked as written
+				data.append(m_buffer);
+				m_buffer.swap(data);
+				m_commitError = error;
+				++m_nbCommitErrors;
+				isCommitted = false;
+			}
+		}
+
+		m_condition.notify_all();
+		lock.lock();
+
+		if (!isCommitted)
+		{
+			IRSTD_LOG_ERROR(TraderJournal, "Cannot commit " << m_buffer.size() << " byte(s) of journal, retry in "
+					<< RETRY_PERIOD_MS << "ms: " << m_commitError);
+			m_condition.wait_for(lock, std::chrono::milliseconds(RETRY_PERIOD_MS), [&]() {
+				return !m_isRunning;
+			});
+			if (!m_isRunning)
+			{
+				IRSTD_LOG_ERROR(TraderJournal, "Lost " << m_buffer.size() << " byte(s) of journal");
+				m_buffer.clear();
+			}
+		}
+	}
+}
+
+size_t Trader::Journal::replay(const std::function<void(const RecordType, Decoder&)>& callback)
+{
+	std::lock_guard<std::mutex> fileLock(m_fileLock);
+
+	std::string data;
+	{
+		char buffer[64 * 1024];
+		off_t offset = 0;
+		ssize_t size;
+		while ((size = ::pread(m_fd, buffer, sizeof(buffer), offset)) > 0)
+		{
+			data.append(buffer, static_cast<size_t>(size));
+			offset += size;
+		}
+		IRSTD_THROW_ASSERT(TraderJournal, size == 0, "Cannot read the journal '" << m_path
+				<< "': " << std::strerror(errno));
+	}
+
+	size_t nbRecords = 0;
+	size_t position = 0;
+	while (position + HEADER_SIZE <= data.size())
+	{
+		uint32_t size;
+		uint32_t hash;
+		std::memcpy(&size, data.data() + position, sizeof(size));
+		std::memcpy(&hash, data.data() + position + 4, sizeof(hash));
+		if (position + HEADER_SIZE + size > data.size()
+				|| checksum(data.data() + position + 8, size + 1) != hash)
+		{
+			break;
+		}
+
+		const RecordType type = static_cast<RecordType>(data[position + 8]);
+		const std::string payload(data, position + HEADER_SIZE, size);
+		Decoder decoder(payload);
+		callback(type, decoder);
+
+		position += HEADER_SIZE + size;
+		++nbRecords;
+	}
+
+	// Drop the end of the journal, it was not written completely
+	if (position != data.size())
+	{
+		IRSTD_LOG_WARNING(TraderJournal, "Truncating " << (data.size() - position)
+				<< " byte(s) of torn record(s) from the journal '" << m_path << "'");
+		IRSTD_THROW_ASSERT(TraderJournal, ::ftruncate(m_fd, static_cast<off_t>(position)) == 0,
+				"Cannot truncate the journal '" << m_path << "': " << std::strerror(errno));
+	}
+
+	return nbRecords;
+}
+
+void Trader::Journal::checkpoint(const Batch& snapshot)
+{
+	std::lock_guard<std::mutex> fileLock(m_fileLock);
+
+	// Write the snapshot aside and swap the files
+	const std::string tempPath = m_path + ".tmp";
+	{
+		const int fd = ::open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+		IRSTD_THROW_ASSERT(TraderJournal, fd >= 0, "Cannot create '" << tempPath
+				<< "': " << std::strerror(errno));
+		try
+		{
+			writeAll(fd, snapshot.get(), tempPath);
+		}
+		catch (...)
+		{
+			::close(fd);
+			throw;
+		}
+		::close(fd);
+	}
+	IRSTD_THROW_ASSERT(TraderJournal, ::rename(tempPath.c_str(), m_path.c_str()) == 0,
+			"Cannot replace the journal '" << m_path << "': " << std::strerror(errno));
+
+	close();
+	open();
+
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		m_buffer.clear();
+		m_commitSequence = m_appendSequence;
+	}
+	m_condition.notify_all();
+
+	// The rename is only durable once the directory entry is synced
+	syncDirectory(m_path);
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "IrStd/IrStd.hpp"
+
+IRSTD_TOPIC_USE(Trader, Journal);
+
+namespace Trader
+{
+	/**
+	 * Append-only binary journal, used to restore a state after a restart.
+	 *
+	 * Records are buffered in memory and written by a background thread
+	 * which groups all the records appended during a commit period into a
+	 * single write followed by a single sync of the file.
+	 * Each record is checksummed, a torn record at the end of the file
+	 * (crash during a write) is ignored and truncated at replay.
+	 * Records that cannot be written are kept in memory and retried.
+	 */
+	class Journal
+	{
+	public:
+		typedef uint8_t RecordType;
+
+		/**
+		 * Serialize the payload of a record
+		 */
+		class Encoder
+		{
+		public:
+			void putU8(const uint8_t value);
+			void putU64(const uint64_t value);
+			void putDouble(const double value);
+			/**
+			 * The decimal is stored as represented in memory, to be restored without any loss
+			 */
+			void putDecimal(const IrStd::Type::Decimal value);
+			void putString(const std::string& value);
+
+			const std::string& get() const noexcept;
+
+		private:
+			std::string m_data;
+		};
+
+		/**
+		 * Deserialize the payload of a record, it throws if the payload is too short
+		 */
+		class Decoder
+		{
+		public:
+			explicit Decoder(const std::string& data);
+
+			uint8_t getU8();
+			uint64_t getU64();
+			double getDouble();
+			IrStd::Type::Decimal getDecimal();
+			std::string getString();
+
+		private:
+			const char* read(const size_t size);
+
+			const std::string& m_data;
+			size_t m_position;
+		};
+
+		/**
+		 * Set of records written at once
+		 */
+		class Batch
+		{
+		public:
+			void add(const RecordType type, const Encoder& payload);
+			const std::string& get() const noexcept;
+
+		private:
+			std::string m_data;
+		};
+
+		/**
+		 * \param path Path of the journal file, it is created if it does not exists
+		 * \param commitPeriodMs Maximal time a record stays in memory before being written
+		 */
+		explicit Journal(const std::string& path, const uint64_t commitPeriodMs = 5);
+		~Journal();
+
+		/**
+		 * Append a record, this does not touch the file
+		 */
+		void append(const RecordType type, const Encoder& payload);
+
+		/**
+		 * Wait until all the records appended so far are written to the disk.
+		 * It throws if the write fails meanwhile, the records are then kept and retried.
+		 */
+		void sync();
+
+		/**
+		 * Read all the records of the journal, in order.
+		 *
+		 * \return The number of records read
+		 */
+		size_t replay(const std::function<void(const RecordType, Decoder&)>& callback);
+
+		/**
+		 * Replace the content of the journal with \p snapshot, a set of records
+		 * describing the current state. The records appended before and not yet
+		 * written are dropped, the snapshot must cover them.
+		 * The file is swapped atomically, it is never left half written.
+		 */
+		void checkpoint(const Batch& snapshot);
+
+		const std::string& getPath() const noexcept;
+
+	private:
+		static void encodeRecord(std::string& data, const RecordType type, const Encoder& payload);
+		static void writeAll(const int fd, const std::string& data, const std::string& path);
+		static void syncDirectory(const std::string& path);
+
+		void commitThread();
+		void open();
+		void close() noexcept;
+
+		const std::string m_path;
+		const uint64_t m_commitPeriodMs;
+		int m_fd;
+
+		std::mutex m_lock;
+		std::condition_variable m_condition;
+		// Records appended but not yet written
+		std::string m_buffer;
+		// Sequence of the last record appended and of the last one written
+		uint64_t m_appendSequence;
+		uint64_t m_commitSequence;
+		// Number of failed commits and the error of the last one
+		uint64_t m_nbCommitErrors;
+		std::string m_commitError;
+		bool m_isSyncRequested;
+		bool m_isRunning;
+
+		// Serializes the writes to the file
+		std::mutex m_fileLock;
+		std::thread::id m_threadId;
+	};
+}
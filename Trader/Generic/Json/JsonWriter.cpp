@@ -0,0 +1,224 @@
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include "Trader/Generic/Json/JsonWriter.hpp"
+
+// ---- Trader::JsonWriter ----------------------------------------------------
+
+Trader::JsonWriter::JsonWriter(std::string& buffer)
+		: m_buffer(buffer)
+		, m_isAfterKey(false)
+{
+	m_buffer.clear();
+}
+
+std::string& Trader::JsonWriter::getThreadBuffer()
+{
+	thread_local std::string buffer;
+	return buffer;
+}
+
+const std::string& Trader::JsonWriter::get() const noexcept
+{
+	return m_buffer;
+}
+
+void Trader::JsonWriter::separator()
+{
+	if (m_isAfterKey)
+	{
+		m_isAfterKey = false;
+	}
+	else if (!m_isFirstList.empty())
+	{
+		if (!m_isFirstList.back())
+		{
+			m_buffer.push_back(',');
+		}
+		m_isFirstList.back() = false;
+	}
+}
+
+Trader::JsonWriter& Trader::JsonWriter::beginObject()
+{
+	separator();
+	m_buffer.push_back('{');
+	m_isFirstList.push_back(true);
+	return *this;
+}
+
+Trader::JsonWriter& Trader::JsonWriter::endObject()
+{
+	m_buffer.push_back('}');
+	m_isFirstList.pop_back();
+	return *this;
+}
+
+Trader::JsonWriter& Trader::JsonWriter::beginArray()
+{
+	separator();
+	m_buffer.push_back('[');
+	m_isFirstList.push_back(true);
+	return *this;
+}
+
+Trader::JsonWriter& Trader::JsonWriter::endArray()
+{
+	m_buffer.push_back(']');
+	m_isFirstList.pop_back();
+	return *this;
+}
+
+Trader::JsonWriter& Trader::JsonWriter::key(const char* const pKey)
+{
+	separator();
+	appendString(m_buffer, pKey, std::strlen(pKey));
+	m_buffer.push_back(':');
+	m_isAfterKey = true;
+	return *this;
+}
+
+// ---- Trader::JsonWriter (values) -------------------------------------------
+
+Trader::JsonWriter& Trader::JsonWriter::value(const char* const pStr)
+{
+	separator();
+	appendString(m_buffer, pStr, std::strlen(pStr));
+	return *this;
+}
+
+Trader::JsonWriter& Trader::JsonWriter::value(const std::string& str)
+{
+	separator();
+	appendString(m_buffer, str.data(), str.size());
+	return *this;
+}
+
+Trader::JsonWriter& Trader::JsonWriter::value(const double number)
+{
+	separator();
+	appendNumber(m_buffer, number);
+	return *this;
+}
+
+Trader::JsonWriter& Trader::JsonWriter::value(const uint64_t number)
+{
+	separator();
+	appendNumber(m_buffer, number);
+	return *this;
+}
+
+Trader::JsonWriter& Trader::JsonWriter::value(const int64_t number)
+{
+	separator();
+	if (number < 0)
+	{
+		m_buffer.push_back('-');
+		// Negate in unsigned to not overflow on the minimal value
+		appendNumber(m_buffer, ~static_cast<uint64_t>(number) + 1);
+	}
+	else
+	{
+		appendNumber(m_buffer, static_cast<uint64_t>(number));
+	}
+	return *this;
+}
+
+Trader::JsonWriter& Trader::JsonWriter::value(const bool boolean)
+{
+	separator();
+	m_buffer.append((boolean) ? "true" : "false");
+	return *this;
+}
+
+Trader::JsonWriter& Trader::JsonWriter::value(const IrStd::Type::Timestamp timestamp)
+{
+	return value(static_cast<uint64_t>(timestamp));
+}
+
+Trader::JsonWriter& Trader::JsonWriter::value(const IrStd::Type::Decimal decimal)
+{
+	return value(static_cast<double>(decimal));
+}
+
+Trader::JsonWriter& Trader::JsonWriter::null()
+{
+	separator();
+	m_buffer.append("null");
+	return *this;
+}
+
+// ---- Trader::JsonWriter (helpers) ------------------------------------------
+
+void Trader::JsonWriter::appendString(
+		std::string& buffer,
+		const char* const pStr,
+		const size_t size)
+{
+	buffer.push_back('"');
+	for (size_t i = 0; i < size; ++i)
+	{
+		const char c = pStr[i];
+		switch (c)
+		{
+		case '"':
+			buffer.append("\\\"");
+			break;
+		case '\\':
+			buffer.append("\\\\");
+			break;
+		case '\n':
+			buffer.append("\\n");
+			break;
+		case '\r':
+			buffer.append("\\r");
+			break;
+		case '\t':
+			buffer.append("\\t");
+			break;
+		default:
+			if (static_cast<unsigned char>(c) < 0x20)
+			{
+				char escaped[8];
+				std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+				buffer.append(escaped);
+			}
+			else
+			{
+				buffer.push_back(c);
+			}
+		}
+	}
+	buffer.push_back('"');
+}
+
+void Trader::JsonWriter::appendNumber(
+		std::string& buffer,
+		const double number)
+{
+	// JSON has no representation for infinity or NaN
+	if (!std::isfinite(number))
+	{
+		buffer.append("null");
+		return;
+	}
+	char str[32];
+	const int size = std::snprintf(str, sizeof(str), "%.12g", number);
+	buffer.append(str, static_cast<size_t>(size));
+}
+
+void Trader::JsonWriter::appendNumber(
+		std::string& buffer,
+		uint64_t number)
+{
+	char str[20];
+	char* pEnd = str + sizeof(str);
+	char* pStr = pEnd;
+	do
+	{
+		*--pStr = static_cast<char>('0' + (number % 10));
+		number /= 10;
+	} while (number);
+	buffer.append(pStr, static_cast<size_t>(pEnd - pStr));
+}
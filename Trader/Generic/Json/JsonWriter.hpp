@@ -0,0 +1,72 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "IrStd/IrStd.hpp"
+
+namespace Trader
+{
+	/**
+	 * Serialize JSON directly into a string buffer, without building a
+	 * document first. The caller is responsible for the order of the calls,
+	 * a key must precede each value of an object.
+	 */
+	class JsonWriter
+	{
+	public:
+		/**
+		 * The content of the buffer is replaced, its capacity is kept
+		 */
+		explicit JsonWriter(std::string& buffer);
+
+		/**
+		 * Buffer owned by the current thread, to be reused between responses
+		 */
+		static std::string& getThreadBuffer();
+
+		JsonWriter& beginObject();
+		JsonWriter& endObject();
+		JsonWriter& beginArray();
+		JsonWriter& endArray();
+
+		JsonWriter& key(const char* const pKey);
+
+		JsonWriter& value(const char* const pStr);
+		JsonWriter& value(const std::string& str);
+		JsonWriter& value(const double number);
+		JsonWriter& value(const uint64_t number);
+		JsonWriter& value(const int64_t number);
+		JsonWriter& value(const bool boolean);
+		JsonWriter& value(const IrStd::Type::Timestamp timestamp);
+		JsonWriter& value(const IrStd::Type::Decimal decimal);
+		JsonWriter& null();
+
+		/**
+		 * Key followed by its value
+		 */
+		template<class T>
+		JsonWriter& member(const char* const pKey, const T& v)
+		{
+			key(pKey);
+			return value(v);
+		}
+
+		const std::string& get() const noexcept;
+
+		/**
+		 * Append a JSON string, with its quotes
+		 */
+		static void appendString(std::string& buffer, const char* const pStr, const size_t size);
+		static void appendNumber(std::string& buffer, const double number);
+		static void appendNumber(std::string& buffer, uint64_t number);
+
+	private:
+		void separator();
+
+		std::string& m_buffer;
+		// One entry per opened container, true until its first element
+		std::vector<bool> m_isFirstList;
+		bool m_isAfterKey;
+	};
+}
@@ -0,0 +1,225 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+#include "Trader/Generic/Log/AsyncLog.hpp"
+
+namespace
+{
+	/**
+	 * Ring of the current thread, flagged as orphan when the thread exits
+	 */
+	template<class Ring>
+	struct ThreadRing
+	{
+		~ThreadRing()
+		{
+			if (m_pRing)
+			{
+				m_pRing->m_isOrphan.store(true, std::memory_order_release);
+			}
+		}
+
+		std::shared_ptr<Ring> m_pRing;
+	};
+}
+
+// ---- Trader::AsyncLog ------------------------------------------------------
+
+constexpr size_t Trader::AsyncLog::RING_SIZE;
+constexpr size_t Trader::AsyncLog::SLOT_SIZE;
+
+Trader::AsyncLog::Ring::Ring()
+		: m_slotList(RING_SIZE)
+		, m_head(0)
+		, m_tail(0)
+		, m_isOrphan(false)
+{
+	static_assert((RING_SIZE & (RING_SIZE - 1)) == 0, "The ring size must be a power of 2");
+}
+
+Trader::AsyncLog::AsyncLog()
+		: m_wallClockOffsetUs(std::chrono::duration_cast<std::chrono::microseconds>(
+				std::chrono::system_clock::now().time_since_epoch()).count() - static_cast<int64_t>(steadyNowUs()))
+		, m_nbPasses(0)
+		, m_isRunning(true)
+		, m_nbStalls(0)
+{
+	m_threadId = IrStd::Threads::create("AsyncLog", &AsyncLog::logThread, this);
+}
+
+Trader::AsyncLog::~AsyncLog()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		m_isRunning = false;
+	}
+	m_condition.notify_all();
+	IrStd::Threads::terminate(m_threadId);
+}
+
+Trader::AsyncLog& Trader::AsyncLog::getDefault()
+{
+	static AsyncLog log;
+	return log;
+}
+
+uint64_t Trader::AsyncLog::steadyNowUs() noexcept
+{
+	// Monotonic, the records are ordered with it
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint64_t Trader::AsyncLog::getNbStalls() const noexcept
+{
+	return m_nbStalls.load(std::memory_order_relaxed);
+}
+
+// ---- Trader::AsyncLog (producer) -------------------------------------------
+
+Trader::AsyncLog::Ring& Trader::AsyncLog::getRing()
+{
+	static thread_local ThreadRing<Ring> threadRing;
+	if (!threadRing.m_pRing)
+	{
+		threadRing.m_pRing = std::make_shared<Ring>();
+		std::lock_guard<std::mutex> lock(m_lock);
+		m_ringList.push_back(threadRing.m_pRing);
+	}
+	return *threadRing.m_pRing;
+}
+
+void Trader::AsyncLog::waitForRoom(
+		Ring& ring,
+		const size_t head)
+{
+	m_nbStalls.fetch_add(1, std::memory_order_relaxed);
+	m_condition.notify_all();
+	while (head - ring.m_tail.load(std::memory_order_acquire) >= RING_SIZE)
+	{
+		std::this_thread::sleep_for(std::chrono::microseconds(100));
+	}
+}
+
+// ---- Trader::AsyncLog (consumer) -------------------------------------------
+
+void Trader::AsyncLog::flush()
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+	// The next pass might have started already, wait for the one after
+	const uint64_t target = m_nbPasses + 2;
+	m_condition.notify_all();
+	m_condition.wait(lock, [&]() {
+		return m_nbPasses >= target || !m_isRunning;
+	});
+}
+
+void Trader::AsyncLog::drain()
+{
+	struct Cursor
+	{
+		Ring* m_pRing;
+		size_t m_position;
+		size_t m_head;
+	};
+	std::vector<std::shared_ptr<Ring>> ringList;
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		ringList = m_ringList;
+	}
+
+	// Records available in each ring
+	std::vector<Cursor> cursorList;
+	for (const auto& pRing : ringList)
+	{
+		const size_t head = pRing->m_head.load(std::memory_order_acquire);
+		const size_t tail = pRing->m_tail.load(std::memory_order_relaxed);
+		if (tail != head)
+		{
+			cursorList.push_back(Cursor{pRing.get(), tail, head});
+		}
+	}
+
+	// Merge the rings by time, only the oldest record of each ring is a candidate
+	// so that the records of a ring are consumed in order
+	while (!cursorList.empty())
+	{
+		auto itCursor = cursorList.begin();
+		for (auto it = cursorList.begin() + 1; it != cursorList.end(); ++it)
+		{
+			if (it->m_pRing->m_slotList[it->m_position & (RING_SIZE - 1)].m_pRecord->m_origin.m_timestampUs
+					< itCursor->m_pRing->m_slotList[itCursor->m_position & (RING_SIZE - 1)].m_pRecord->m_origin.m_timestampUs)
+			{
+				itCursor = it;
+			}
+		}
+
+		Slot& slot = itCursor->m_pRing->m_slotList[itCursor->m_position & (RING_SIZE - 1)];
+		Record* const pRecord = slot.m_pRecord;
+		// A new stream each time, to not inherit the flags set by the previous record
+		std::ostringstream stream;
+		pRecord->format(stream);
+		const Origin origin{static_cast<uint64_t>(static_cast<int64_t>(pRecord->m_origin.m_timestampUs) + m_wallClockOffsetUs),
+				pRecord->m_origin.m_threadId};
+		pRecord->m_emit(stream.str(), origin);
+
+		if (static_cast<void*>(pRecord) == static_cast<void*>(&slot.m_data))
+		{
+			pRecord->~Record();
+		}
+		else
+		{
+			delete pRecord;
+		}
+		itCursor->m_pRing->m_tail.store(++itCursor->m_position, std::memory_order_release);
+		if (itCursor->m_position == itCursor->m_head)
+		{
+			cursorList.erase(itCursor);
+		}
+	}
+
+	// Release the rings of the threads that exited
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		m_ringList.erase(std::remove_if(m_ringList.begin(), m_ringList.end(), [](const std::shared_ptr<Ring>& pRing) {
+			return pRing->m_isOrphan.load(std::memory_order_acquire)
+					&& pRing->m_tail.load(std::memory_order_relaxed) == pRing->m_head.load(std::memory_order_acquire);
+		}), m_ringList.end());
+	}
+}
+
+void Trader::AsyncLog::logThread()
+{
+	constexpr uint64_t PERIOD_MS = 10;
+	bool isRunning = true;
+	while (isRunning)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+			m_condition.wait_for(lock, std::chrono::milliseconds(PERIOD_MS));
+			isRunning = m_isRunning;
+		}
+
+		drain();
+
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			++m_nbPasses;
+		}
+		m_condition.notify_all();
+	}
+}
+
+// ---- Trader::AsyncLog::Origin ----------------------------------------------
+
+std::ostream& Trader::operator<<(std::ostream& os, const AsyncLog::Origin& origin)
+{
+	// Milliseconds since epoch, followed by the microseconds
+	const auto fill = os.fill('0');
+	os << "[" << IrStd::Type::Timestamp(origin.m_timestampUs / 1000) << "." << std::setw(3)
+			<< (origin.m_timestampUs % 1000) << ", thread " << origin.m_threadId << "]";
+	os.fill(fill);
+	return os;
+}
@@ -0,0 +1,331 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "IrStd/IrStd.hpp"
+
+/**
+ * Log a message with deferred formatting, the syntax is the same as IRSTD_LOG_*.
+ * The values streamed are copied at the call site and formatted by the log thread,
+ * C strings are copied into strings and the values which are not trivially copyable
+ * are formatted at the call site, so that a log statement never extends the lifetime
+ * of an object. Nothing is evaluated if the IrStd logger filters out this level for
+ * this topic.
+ * Warnings and errors are formatted at the call site, they are rare and often stream
+ * objects that do not outlive the statement; only their output is deferred.
+ */
+#define TRADER_LOG_IMPL(level, irstdLevel, topic, message, CaptureType) \
+	do \
+	{ \
+		if (Trader::AsyncLog::isEnabled(topic, IrStd::Logger::Level::level)) \
+		{ \
+			struct TraderLogEmit \
+			{ \
+				static void emit(const std::string& str, const Trader::AsyncLog::Origin& origin) \
+				{ \
+					IRSTD_LOG_##irstdLevel(topic, origin << " " << str); \
+				} \
+			}; \
+			Trader::AsyncLog::getDefault().push(&TraderLogEmit::emit, CaptureType() << message); \
+		} \
+	} while (false)
+
+#define TRADER_LOG_TRACE(topic, message) TRADER_LOG_IMPL(Trace, TRACE, topic, message, Trader::AsyncLog::Capture<>)
+#define TRADER_LOG_DEBUG(topic, message) TRADER_LOG_IMPL(Debug, DEBUG, topic, message, Trader::AsyncLog::Capture<>)
+#define TRADER_LOG_INFO(topic, message) TRADER_LOG_IMPL(Info, INFO, topic, message, Trader::AsyncLog::Capture<>)
+#define TRADER_LOG_WARNING(topic, message) TRADER_LOG_IMPL(Warning, WARNING, topic, message, Trader::AsyncLog::Formatted)
+#define TRADER_LOG_ERROR(topic, message) TRADER_LOG_IMPL(Error, ERROR, topic, message, Trader::AsyncLog::Formatted)
+
+namespace Trader
+{
+	/**
+	 * Asynchronous log pipeline.
+	 *
+	 * Each thread owns a lock-free ring where the log statements store the
+	 * values they stream, without formatting them. A background thread drains
+	 * all the rings, merges them by time without reordering the records of a
+	 * ring, formats them and forwards them to the IrStd logger, which also
+	 * decides which records are taken.
+	 */
+	class AsyncLog
+	{
+	private:
+		/**
+		 * C strings are copied, they might not outlive the log statement.
+		 * Values which are not trivially copyable are formatted, they might own
+		 * resources which must not be released by the log thread.
+		 */
+		template<class T>
+		struct Stored
+		{
+			typedef typename std::decay<T>::type DecayType;
+			typedef std::integral_constant<bool, !std::is_trivially_copyable<DecayType>::value
+					&& !std::is_same<DecayType, std::string>::value> IsFormatted;
+			typedef typename std::conditional<IsFormatted::value || std::is_same<DecayType, const char*>::value
+					|| std::is_same<DecayType, char*>::value, std::string, DecayType>::type type;
+
+			static type get(T&& value)
+			{
+				return get(std::forward<T>(value), IsFormatted());
+			}
+
+		private:
+			static type get(T&& value, std::false_type /*isFormatted*/)
+			{
+				return type(std::forward<T>(value));
+			}
+			static type get(T&& value, std::true_type /*isFormatted*/)
+			{
+				std::ostringstream stream;
+				stream << value;
+				return stream.str();
+			}
+		};
+
+		template<size_t I, size_t N>
+		struct Printer
+		{
+			template<class Tuple>
+			static void print(std::ostream& out, const Tuple& args)
+			{
+				out << std::get<I>(args);
+				Printer<I + 1, N>::print(out, args);
+			}
+		};
+
+		template<size_t N>
+		struct Printer<N, N>
+		{
+			template<class Tuple>
+			static void print(std::ostream& /*out*/, const Tuple& /*args*/)
+			{
+			}
+		};
+
+	public:
+		/**
+		 * Number of records per thread, must be a power of 2
+		 */
+		static constexpr size_t RING_SIZE = 1024;
+		/**
+		 * Records up to this size are stored inside the ring, larger ones are allocated
+		 */
+		static constexpr size_t SLOT_SIZE = 256;
+
+		/**
+		 * Where and when a log statement was issued, written in front of the message
+		 * as the IrStd logger only knows about the log thread
+		 */
+		struct Origin
+		{
+			//! Wall clock time in microseconds
+			uint64_t m_timestampUs;
+			std::thread::id m_threadId;
+		};
+
+		typedef void (*EmitFunction)(const std::string& str, const Origin& origin);
+
+		/**
+		 * Values streamed by a log statement
+		 */
+		template<class ... Args>
+		class Capture
+		{
+		public:
+			Capture() = default;
+
+			explicit Capture(std::tuple<Args...>&& args)
+					: m_args(std::move(args))
+			{
+			}
+
+			template<class T>
+			Capture<Args..., typename Stored<T>::type> operator<<(T&& value)
+			{
+				return Capture<Args..., typename Stored<T>::type>(std::tuple_cat(std::move(m_args),
+						std::tuple<typename Stored<T>::type>(Stored<T>::get(std::forward<T>(value)))));
+			}
+
+			void toStream(std::ostream& out) const
+			{
+				Printer<0, sizeof...(Args)>::print(out, m_args);
+			}
+
+		private:
+			std::tuple<Args...> m_args;
+		};
+
+		/**
+		 * Values streamed by a log statement, formatted immediately
+		 */
+		class Formatted
+		{
+		public:
+			template<class T>
+			Formatted& operator<<(T&& value)
+			{
+				m_stream << std::forward<T>(value);
+				return *this;
+			}
+
+			std::string str() const
+			{
+				return m_stream.str();
+			}
+
+		private:
+			std::ostringstream m_stream;
+		};
+
+		static AsyncLog& getDefault();
+		~AsyncLog();
+
+		/**
+		 * Tell if a log statement of this level on this topic must be recorded,
+		 * according to the topics configured on the IrStd logger
+		 */
+		static bool isEnabled(const IrStd::TopicImpl& topic, const IrStd::Logger::Level level) noexcept
+		{
+			return IrStd::Logger::getDefault().isEnabled(topic, level);
+		}
+
+		/**
+		 * Record a log statement, \p emit is called from the log thread with the formatted message
+		 */
+		template<class ... Args>
+		void push(const EmitFunction emit, Capture<Args...>&& capture)
+		{
+			typedef RecordImpl<Capture<Args...>> RecordType;
+			Ring& ring = getRing();
+			const size_t head = ring.m_head.load(std::memory_order_relaxed);
+			if (head - ring.m_tail.load(std::memory_order_acquire) >= RING_SIZE)
+			{
+				waitForRoom(ring, head);
+			}
+
+			Slot& slot = ring.m_slotList[head & (RING_SIZE - 1)];
+			// Steady clock while in the ring, converted to wall clock when emitted
+			const Origin origin{steadyNowUs(), std::this_thread::get_id()};
+			slot.m_pRecord = create<RecordType>(slot, origin, emit, std::move(capture),
+					std::integral_constant<bool, (sizeof(RecordType) <= SLOT_SIZE)>());
+			ring.m_head.store(head + 1, std::memory_order_release);
+		}
+
+		void push(const EmitFunction emit, Formatted& formatted)
+		{
+			push(emit, Capture<>() << formatted.str());
+		}
+
+		/**
+		 * Wait until all the records pushed so far are emitted
+		 */
+		void flush();
+
+		/**
+		 * Number of times a thread had to wait because its ring was full
+		 */
+		uint64_t getNbStalls() const noexcept;
+
+	private:
+		class Record
+		{
+		public:
+			Record(const Origin& origin, const EmitFunction emit) noexcept
+					: m_origin(origin)
+					, m_emit(emit)
+			{
+			}
+			virtual ~Record() = default;
+			virtual void format(std::ostream& out) const = 0;
+
+			const Origin m_origin;
+			const EmitFunction m_emit;
+		};
+
+		template<class C>
+		class RecordImpl : public Record
+		{
+		public:
+			RecordImpl(const Origin& origin, const EmitFunction emit, C&& capture)
+					: Record(origin, emit)
+					, m_capture(std::move(capture))
+			{
+			}
+
+			void format(std::ostream& out) const override
+			{
+				m_capture.toStream(out);
+			}
+
+		private:
+			const C m_capture;
+		};
+
+		struct Slot
+		{
+			typename std::aligned_storage<SLOT_SIZE>::type m_data;
+			Record* m_pRecord;
+		};
+
+		struct Ring
+		{
+			Ring();
+
+			std::vector<Slot> m_slotList;
+			// Written by the producer thread only
+			std::atomic<size_t> m_head;
+			// Written by the log thread only
+			std::atomic<size_t> m_tail;
+			// Set when the producer thread exits, the ring is freed once empty
+			std::atomic<bool> m_isOrphan;
+		};
+
+		AsyncLog();
+
+		/**
+		 * Construct a record inside the slot if it fits, on the heap otherwise
+		 */
+		template<class R, class C>
+		static Record* create(Slot& slot, const Origin& origin, const EmitFunction emit,
+				C&& capture, std::true_type /*isInline*/)
+		{
+			return new (&slot.m_data) R(origin, emit, std::move(capture));
+		}
+		template<class R, class C>
+		static Record* create(Slot& /*slot*/, const Origin& origin, const EmitFunction emit,
+				C&& capture, std::false_type /*isInline*/)
+		{
+			return new R(origin, emit, std::move(capture));
+		}
+
+		static uint64_t steadyNowUs() noexcept;
+
+		Ring& getRing();
+		void waitForRoom(Ring& ring, const size_t head);
+		void logThread();
+		void drain();
+
+		//! Wall clock minus steady clock, in microseconds
+		const int64_t m_wallClockOffsetUs;
+		std::mutex m_lock;
+		std::condition_variable m_condition;
+		std::vector<std::shared_ptr<Ring>> m_ringList;
+		uint64_t m_nbPasses;
+		bool m_isRunning;
+		std::atomic<uint64_t> m_nbStalls;
+		std::thread::id m_threadId;
+	};
+
+	std::ostream& operator<<(std::ostream& os, const AsyncLog::Origin& origin);
+}
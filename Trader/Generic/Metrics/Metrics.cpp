@@ -0,0 +1,296 @@
+#include <cmath>
+#include <cstdio>
+#include <exception>
+
+#include "Trader/Generic/Metrics/Metrics.hpp"
+
+IRSTD_TOPIC_REGISTER(Trader, Metrics);
+IRSTD_TOPIC_USE_ALIAS(TraderMetrics, Trader, Metrics);
+
+// ---- Trader::Metrics::Counter ----------------------------------------------
+
+Trader::Metrics::Counter::Counter()
+		: m_value(0)
+{
+}
+
+void Trader::Metrics::Counter::inc(const uint64_t value) noexcept
+{
+	m_value.fetch_add(value, std::memory_order_relaxed);
+}
+
+uint64_t Trader::Metrics::Counter::get() const noexcept
+{
+	return m_value.load(std::memory_order_relaxed);
+}
+
+// ---- Trader::Metrics::Gauge ------------------------------------------------
+
+Trader::Metrics::Gauge::Gauge()
+		: m_value(0)
+{
+}
+
+void Trader::Metrics::Gauge::set(const int64_t value) noexcept
+{
+	m_value.store(value, std::memory_order_relaxed);
+}
+
+void Trader::Metrics::Gauge::add(const int64_t value) noexcept
+{
+	m_value.fetch_add(value, std::memory_order_relaxed);
+}
+
+int64_t Trader::Metrics::Gauge::get() const noexcept
+{
+	return m_value.load(std::memory_order_relaxed);
+}
+
+// ---- Trader::Metrics::Timer ------------------------------------------------
+
+Trader::Metrics::Timer::Timer(LatencyHistogram& latency, Counter& nbErrors) noexcept
+		: m_latency(latency)
+		, m_nbErrors(nbErrors)
+		, m_startUs(LatencyHistogram::nowUs())
+{
+}
+
+Trader::Metrics::Timer::~Timer()
+{
+	m_latency.record(LatencyHistogram::nowUs() - m_startUs);
+	if (std::uncaught_exception())
+	{
+		m_nbErrors.inc();
+	}
+}
+
+// ---- Trader::Metrics::Registration -----------------------------------------
+
+Trader::Metrics::Registration::Registration() noexcept
+		: m_pMetrics(nullptr)
+		, m_id(0)
+{
+}
+
+Trader::Metrics::Registration::Registration(Metrics& metrics, const uint64_t id) noexcept
+		: m_pMetrics(&metrics)
+		, m_id(id)
+{
+}
+
+Trader::Metrics::Registration::Registration(Registration&& rhs) noexcept
+		: m_pMetrics(rhs.m_pMetrics)
+		, m_id(rhs.m_id)
+{
+	rhs.m_pMetrics = nullptr;
+}
+
+Trader::Metrics::Registration& Trader::Metrics::Registration::operator=(Registration&& rhs) noexcept
+{
+	if (this != &rhs)
+	{
+		if (m_pMetrics)
+		{
+			m_pMetrics->remove(m_id);
+		}
+		m_pMetrics = rhs.m_pMetrics;
+		m_id = rhs.m_id;
+		rhs.m_pMetrics = nullptr;
+	}
+	return *this;
+}
+
+Trader::Metrics::Registration::~Registration()
+{
+	if (m_pMetrics)
+	{
+		m_pMetrics->remove(m_id);
+	}
+}
+
+// ---- Trader::Metrics -------------------------------------------------------
+
+Trader::Metrics::Metrics()
+		: m_nextId(0)
+{
+}
+
+Trader::Metrics& Trader::Metrics::getDefault()
+{
+	static Metrics metrics;
+	return metrics;
+}
+
+Trader::Metrics::Registration Trader::Metrics::add(
+		const char* const pName,
+		const char* const pHelp,
+		const Labels& labels,
+		const Counter& counter)
+{
+	return addEntry(pName, pHelp, labels, Type::COUNTER, [&counter](std::string& out, const std::string& name,
+			const std::string& formattedLabels) {
+		appendSample(out, name, formattedLabels, static_cast<double>(counter.get()));
+	});
+}
+
+Trader::Metrics::Registration Trader::Metrics::add(
+		const char* const pName,
+		const char* const pHelp,
+		const Labels& labels,
+		const Gauge& gauge)
+{
+	return addEntry(pName, pHelp, labels, Type::GAUGE, [&gauge](std::string& out, const std::string& name,
+			const std::string& formattedLabels) {
+		appendSample(out, name, formattedLabels, static_cast<double>(gauge.get()));
+	});
+}
+
+Trader::Metrics::Registration Trader::Metrics::add(
+		const char* const pName,
+		const char* const pHelp,
+		const Labels& labels,
+		const LatencyHistogram& histogram)
+{
+	return addEntry(pName, pHelp, labels, Type::SUMMARY, [&histogram](std::string& out, const std::string& name,
+			const std::string& formattedLabels) {
+		const std::string separator = (formattedLabels.empty()) ? "" : ",";
+		const std::pair<const char*, double> quantileList[] = {{"0.5", 50.}, {"0.9", 90.}, {"0.99", 99.}};
+		for (const auto& quantile : quantileList)
+		{
+			appendSample(out, name, formattedLabels + separator + "quantile=\"" + quantile.first + "\"",
+					static_cast<double>(histogram.getPercentile(quantile.second)) / 1000000.);
+		}
+		const auto count = histogram.getCount();
+		appendSample(out, name + "_sum", formattedLabels, static_cast<double>(histogram.getMean() * count) / 1000000.);
+		appendSample(out, name + "_count", formattedLabels, static_cast<double>(count));
+	});
+}
+
+Trader::Metrics::Registration Trader::Metrics::add(
+		const char* const pName,
+		const char* const pHelp,
+		const Labels& labels,
+		std::function<double()> read,
+		const Type type)
+{
+	IRSTD_ASSERT(TraderMetrics, type != Type::SUMMARY, "A summary cannot be computed from a single value");
+	return addEntry(pName, pHelp, labels, type, [read](std::string& out, const std::string& name,
+			const std::string& formattedLabels) {
+		appendSample(out, name, formattedLabels, read());
+	});
+}
+
+Trader::Metrics::Registration Trader::Metrics::addEntry(
+		const char* const pName,
+		const char* const pHelp,
+		const Labels& labels,
+		const Type type,
+		Writer&& write)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+	const uint64_t id = m_nextId++;
+	m_entryList.insert(std::make_pair(std::make_pair(std::string(pName), id),
+			Entry{pName, pHelp, type, formatLabels(labels), std::move(write)}));
+	m_idList.insert(std::make_pair(id, std::string(pName)));
+	return Registration(*this, id);
+}
+
+void Trader::Metrics::remove(const uint64_t id) noexcept
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+	const auto it = m_idList.find(id);
+	if (it != m_idList.end())
+	{
+		m_entryList.erase(std::make_pair(it->second, id));
+		m_idList.erase(it);
+	}
+}
+
+void Trader::Metrics::toText(std::string& out) const
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+	const std::string* pPreviousName = nullptr;
+	for (const auto& it : m_entryList)
+	{
+		const auto& entry = it.second;
+		// Metadata are written once per metric name
+		if (!pPreviousName || *pPreviousName != entry.m_name)
+		{
+			out.append("# HELP ").append(entry.m_name).append(" ").append(entry.m_help).append("\n");
+			out.append("# TYPE ").append(entry.m_name);
+			switch (entry.m_type)
+			{
+			case Type::COUNTER:
+				out.append(" counter\n");
+				break;
+			case Type::GAUGE:
+				out.append(" gauge\n");
+				break;
+			case Type::SUMMARY:
+				out.append(" summary\n");
+				break;
+			default:
+				IRSTD_UNREACHABLE(TraderMetrics);
+			}
+			pPreviousName = &entry.m_name;
+		}
+		entry.m_write(out, entry.m_name, entry.m_labels);
+	}
+}
+
+// ---- Trader::Metrics (helpers) ---------------------------------------------
+
+void Trader::Metrics::appendSample(
+		std::string& out,
+		const std::string& name,
+		const std::string& labels,
+		const double value)
+{
+	out.append(name);
+	if (!labels.empty())
+	{
+		out.append("{").append(labels).append("}");
+	}
+	if (std::isnan(value))
+	{
+		out.append(" NaN\n");
+	}
+	else if (std::isinf(value))
+	{
+		out.append((value > 0) ? " +Inf\n" : " -Inf\n");
+	}
+	else
+	{
+		char str[32];
+		std::snprintf(str, sizeof(str), " %.12g\n", value);
+		out.append(str);
+	}
+}
+
+std::string Trader::Metrics::formatLabels(const Labels& labels)
+{
+	std::string formatted;
+	for (const auto& label : labels)
+	{
+		formatted.append((formatted.empty()) ? "" : ",").append(label.first).append("=\"");
+		for (const auto c : label.second)
+		{
+			switch (c)
+			{
+			case '\\':
+				formatted.append("\\\\");
+				break;
+			case '"':
+				formatted.append("\\\"");
+				break;
+			case '\n':
+				formatted.append("\\n");
+				break;
+			default:
+				formatted.push_back(c);
+			}
+		}
+		formatted.push_back('"');
+	}
+	return formatted;
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IrStd/IrStd.hpp"
+#include "Trader/Generic/Histogram/LatencyHistogram.hpp"
+
+IRSTD_TOPIC_USE(Trader, Metrics);
+
+namespace Trader
+{
+	/**
+	 * Registry of the metrics exposed in the Prometheus text format.
+	 *
+	 * Metrics are owned and updated lock-free by the components, which
+	 * register them here with a name and labels. A registration is removed
+	 * when its handle is destroyed, it must not outlive the metric.
+	 */
+	class Metrics
+	{
+	public:
+		typedef std::vector<std::pair<std::string, std::string>> Labels;
+
+		enum class Type
+		{
+			COUNTER,
+			GAUGE,
+			SUMMARY
+		};
+
+		class Counter
+		{
+		public:
+			Counter();
+			void inc(const uint64_t value = 1) noexcept;
+			uint64_t get() const noexcept;
+
+		private:
+			std::atomic<uint64_t> m_value;
+		};
+
+		class Gauge
+		{
+		public:
+			Gauge();
+			void set(const int64_t value) noexcept;
+			void add(const int64_t value) noexcept;
+			int64_t get() const noexcept;
+
+		private:
+			std::atomic<int64_t> m_value;
+		};
+
+		/**
+		 * Record the duration of a scope, and count an error if it is left
+		 * with an exception.
+		 */
+		class Timer
+		{
+		public:
+			Timer(LatencyHistogram& latency, Counter& nbErrors) noexcept;
+			~Timer();
+
+		private:
+			LatencyHistogram& m_latency;
+			Counter& m_nbErrors;
+			const uint64_t m_startUs;
+		};
+
+		class Registration
+		{
+		public:
+			Registration() noexcept;
+			Registration(Registration&& rhs) noexcept;
+			Registration& operator=(Registration&& rhs) noexcept;
+			~Registration();
+
+			Registration(const Registration&) = delete;
+			Registration& operator=(const Registration&) = delete;
+
+		private:
+			friend class Metrics;
+			Registration(Metrics& metrics, const uint64_t id) noexcept;
+
+			Metrics* m_pMetrics;
+			uint64_t m_id;
+		};
+
+		Metrics();
+
+		/**
+		 * Registry shared by the whole application
+		 */
+		static Metrics& getDefault();
+
+		Registration add(const char* const pName, const char* const pHelp, const Labels& labels,
+				const Counter& counter);
+		Registration add(const char* const pName, const char* const pHelp, const Labels& labels,
+				const Gauge& gauge);
+		/**
+		 * Durations in microseconds, exposed as a summary in seconds
+		 */
+		Registration add(const char* const pName, const char* const pHelp, const Labels& labels,
+				const LatencyHistogram& histogram);
+		/**
+		 * Value computed each time the metrics are read, a counter or a gauge
+		 */
+		Registration add(const char* const pName, const char* const pHelp, const Labels& labels,
+				std::function<double()> read, const Type type = Type::GAUGE);
+
+		/**
+		 * Write all the metrics in the Prometheus text exposition format
+		 */
+		void toText(std::string& out) const;
+
+	private:
+		/**
+		 * Write the samples of an entry, \p labels is already formatted
+		 */
+		typedef std::function<void(std::string& out, const std::string& name, const std::string& labels)> Writer;
+
+		struct Entry
+		{
+			std::string m_name;
+			std::string m_help;
+			Type m_type;
+			std::string m_labels;
+			Writer m_write;
+		};
+
+		Registration addEntry(const char* const pName, const char* const pHelp, const Labels& labels,
+				const Type type, Writer&& write);
+		void remove(const uint64_t id) noexcept;
+
+		static void appendSample(std::string& out, const std::string& name, const std::string& labels,
+				const double value);
+		static std::string formatLabels(const Labels& labels);
+
+		mutable std::mutex m_lock;
+		// Entries sorted by name then by registration order
+		std::map<std::pair<std::string, uint64_t>, Entry> m_entryList;
+		std::map<uint64_t, std::string> m_idList;
+		uint64_t m_nextId;
+	};
+}
@@ -0,0 +1,244 @@
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "Trader/Generic/Writer/AsyncWriter.hpp"
+#include "Trader/Generic/Metrics/Metrics.hpp"
+
+IRSTD_TOPIC_REGISTER(Trader, AsyncWriter);
+IRSTD_TOPIC_USE_ALIAS(TraderAsyncWriter, Trader, AsyncWriter);
+
+// ---- Trader::AsyncWriter ---------------------------------------------------
+
+constexpr size_t Trader::AsyncWriter::QUEUE_SIZE;
+
+Trader::AsyncWriter::AsyncWriter(const uint64_t batchPeriodMs)
+		: m_queue(QUEUE_SIZE)
+		, m_pushPosition(0)
+		, m_popPosition(0)
+		, m_nbPushed(0)
+		, m_nbStalls(0)
+		, m_batchPeriodMs(batchPeriodMs)
+		, m_nbWritten(0)
+		, m_isFlushRequested(false)
+		, m_isRunning(true)
+{
+	static_assert((QUEUE_SIZE & (QUEUE_SIZE - 1)) == 0, "The queue size must be a power of 2");
+	for (size_t i = 0; i < QUEUE_SIZE; ++i)
+	{
+		m_queue[i].m_sequence.store(i, std::memory_order_relaxed);
+	}
+	m_threadId = IrStd::Threads::create("AsyncWriter", &AsyncWriter::writerThread, this);
+}
+
+Trader::AsyncWriter::~AsyncWriter()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		m_isRunning = false;
+	}
+	m_condition.notify_all();
+	IrStd::Threads::terminate(m_threadId);
+
+	for (const auto& file : m_fileList)
+	{
+		::close(file.second);
+	}
+}
+
+Trader::AsyncWriter& Trader::AsyncWriter::getDefault()
+{
+	static AsyncWriter writer;
+	static const Metrics::Registration registrationList[] = {
+		Metrics::getDefault().add("trader_recorder_backlog", "Number of lines waiting to be written", {},
+				[]() { return static_cast<double>(writer.getBacklog()); }),
+		Metrics::getDefault().add("trader_recorder_stalls_total", "Number of times a producer waited for the writer", {},
+				[]() { return static_cast<double>(writer.getNbStalls()); }, Metrics::Type::COUNTER)
+	};
+	return writer;
+}
+
+uint64_t Trader::AsyncWriter::getNbStalls() const noexcept
+{
+	return m_nbStalls.load(std::memory_order_relaxed);
+}
+
+size_t Trader::AsyncWriter::getBacklog() const noexcept
+{
+	const size_t popPosition = m_popPosition.load(std::memory_order_relaxed);
+	const size_t pushPosition = m_pushPosition.load(std::memory_order_relaxed);
+	return (pushPosition > popPosition) ? pushPosition - popPosition : 0;
+}
+
+// ---- Trader::AsyncWriter (queue) -------------------------------------------
+
+bool Trader::AsyncWriter::push(Line& line) noexcept
+{
+	size_t position = m_pushPosition.load(std::memory_order_relaxed);
+	while (true)
+	{
+		Cell& cell = m_queue[position & (QUEUE_SIZE - 1)];
+		const size_t sequence = cell.m_sequence.load(std::memory_order_acquire);
+		const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+		if (diff == 0)
+		{
+			if (m_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+			{
+				cell.m_line = std::move(line);
+				cell.m_sequence.store(position + 1, std::memory_order_release);
+				return true;
+			}
+		}
+		else if (diff < 0)
+		{
+			// The queue is full
+			return false;
+		}
+		else
+		{
+			position = m_pushPosition.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+bool Trader::AsyncWriter::pop(Line& line) noexcept
+{
+	size_t position = m_popPosition.load(std::memory_order_relaxed);
+	while (true)
+	{
+		Cell& cell = m_queue[position & (QUEUE_SIZE - 1)];
+		const size_t sequence = cell.m_sequence.load(std::memory_order_acquire);
+		const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+		if (diff == 0)
+		{
+			if (m_popPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+			{
+				line = std::move(cell.m_line);
+				cell.m_sequence.store(position + QUEUE_SIZE, std::memory_order_release);
+				return true;
+			}
+		}
+		else if (diff < 0)
+		{
+			// The queue is empty
+			return false;
+		}
+		else
+		{
+			position = m_popPosition.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+void Trader::AsyncWriter::write(const std::string& path, std::string line)
+{
+	line.push_back('\n');
+	Line entry{path, std::move(line)};
+
+	// Back-pressure, wait for the writer to make some room
+	if (!push(entry))
+	{
+		m_nbStalls.fetch_add(1, std::memory_order_relaxed);
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			m_isFlushRequested = true;
+		}
+		m_condition.notify_all();
+		do
+		{
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+		} while (!push(entry));
+	}
+	m_nbPushed.fetch_add(1, std::memory_order_release);
+}
+
+// ---- Trader::AsyncWriter (writer) ------------------------------------------
+
+void Trader::AsyncWriter::flush()
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+	const uint64_t target = m_nbPushed.load(std::memory_order_acquire);
+	m_isFlushRequested = true;
+	m_condition.notify_all();
+	m_condition.wait(lock, [&]() {
+		return m_nbWritten >= target || !m_isRunning;
+	});
+}
+
+int Trader::AsyncWriter::getFile(const std::string& path)
+{
+	auto it = m_fileList.find(path);
+	if (it == m_fileList.end())
+	{
+		const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+		IRSTD_THROW_ASSERT(TraderAsyncWriter, fd >= 0, "Cannot open '" << path << "': " << std::strerror(errno));
+		it = m_fileList.insert(std::make_pair(path, fd)).first;
+	}
+	return it->second;
+}
+
+void Trader::AsyncWriter::writeBatch(std::map<std::string, std::string>& batch)
+{
+	for (auto& content : batch)
+	{
+		try
+		{
+			const int fd = getFile(content.first);
+			const std::string& data = content.second;
+			size_t offset = 0;
+			while (offset < data.size())
+			{
+				const ssize_t written = ::write(fd, data.data() + offset, data.size() - offset);
+				if (written < 0 && errno == EINTR)
+				{
+					continue;
+				}
+				IRSTD_THROW_ASSERT(TraderAsyncWriter, written > 0, "Cannot write to '" << content.first
+						<< "': " << std::strerror(errno));
+				offset += static_cast<size_t>(written);
+			}
+			IRSTD_THROW_ASSERT(TraderAsyncWriter, ::fdatasync(fd) == 0, "Cannot sync '" << content.first
+					<< "': " << std::strerror(errno));
+		}
+		catch (const IrStd::Exception& e)
+		{
+			IRSTD_LOG_ERROR(TraderAsyncWriter, "Lost " << content.second.size() << " byte(s): " << e);
+		}
+	}
+	batch.clear();
+}
+
+void Trader::AsyncWriter::writerThread()
+{
+	std::map<std::string, std::string> batch;
+	bool isRunning = true;
+	while (isRunning)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+			m_condition.wait_for(lock, std::chrono::milliseconds(m_batchPeriodMs), [&]() {
+				return m_isFlushRequested || !m_isRunning;
+			});
+			m_isFlushRequested = false;
+			isRunning = m_isRunning;
+		}
+
+		// Group the lines per file
+		uint64_t nbLines = 0;
+		Line line;
+		while (pop(line))
+		{
+			batch[line.m_path].append(line.m_data);
+			++nbLines;
+		}
+		writeBatch(batch);
+
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			m_nbWritten += nbLines;
+		}
+		m_condition.notify_all();
+	}
+}
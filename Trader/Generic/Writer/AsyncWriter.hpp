@@ -0,0 +1,127 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "IrStd/IrStd.hpp"
+
+IRSTD_TOPIC_USE(Trader, AsyncWriter);
+
+namespace Trader
+{
+	/**
+	 * Append lines to files from a background thread.
+	 *
+	 * Producers push the lines into a bounded lock-free queue and never touch
+	 * the file system. The writer thread keeps the files open, groups all the
+	 * pending lines of a file into a single write and syncs each file once
+	 * per batch. When the queue is full, producers wait for the writer.
+	 */
+	class AsyncWriter
+	{
+	public:
+		/**
+		 * Number of lines the queue can hold, must be a power of 2
+		 */
+		static constexpr size_t QUEUE_SIZE = 4096;
+
+		/**
+		 * \param batchPeriodMs Maximal time a line stays in the queue
+		 */
+		explicit AsyncWriter(const uint64_t batchPeriodMs = 100);
+		~AsyncWriter();
+
+		/**
+		 * Writer shared by the whole application
+		 */
+		static AsyncWriter& getDefault();
+
+		/**
+		 * Queue a line to be appended to \p path, a new line is added at the end
+		 */
+		void write(const std::string& path, std::string line);
+
+		/**
+		 * Queue a line of comma separated values
+		 */
+		template<class ... Args>
+		void writeCsv(const std::string& path, Args&& ... args)
+		{
+			std::ostringstream stream;
+			stream.precision(12);
+			toCsv(stream, std::forward<Args>(args)...);
+			write(path, stream.str());
+		}
+
+		/**
+		 * Wait until all the lines queued so far are written and synced
+		 */
+		void flush();
+
+		/**
+		 * Number of times a producer had to wait because the queue was full
+		 */
+		uint64_t getNbStalls() const noexcept;
+
+		/**
+		 * Number of lines queued and not yet taken by the writer
+		 */
+		size_t getBacklog() const noexcept;
+
+	private:
+		struct Line
+		{
+			std::string m_path;
+			std::string m_data;
+		};
+
+		struct Cell
+		{
+			std::atomic<size_t> m_sequence;
+			Line m_line;
+		};
+
+		template<class T>
+		static void toCsv(std::ostream& out, T&& value)
+		{
+			out << value;
+		}
+
+		template<class T, class ... Args>
+		static void toCsv(std::ostream& out, T&& value, Args&& ... args)
+		{
+			out << value << ",";
+			toCsv(out, std::forward<Args>(args)...);
+		}
+
+		bool push(Line& line) noexcept;
+		bool pop(Line& line) noexcept;
+
+		void writerThread();
+		void writeBatch(std::map<std::string, std::string>& batch);
+		int getFile(const std::string& path);
+
+		std::vector<Cell> m_queue;
+		std::atomic<size_t> m_pushPosition;
+		std::atomic<size_t> m_popPosition;
+		std::atomic<uint64_t> m_nbPushed;
+		std::atomic<uint64_t> m_nbStalls;
+
+		const uint64_t m_batchPeriodMs;
+		std::mutex m_lock;
+		std::condition_variable m_condition;
+		uint64_t m_nbWritten;
+		bool m_isFlushRequested;
+		bool m_isRunning;
+
+		// Opened files, only accessed by the writer thread
+		std::map<std::string, int> m_fileList;
+		std::thread::id m_threadId;
+	};
+}
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <chrono>
 
 #include "Trader/Manager/Manager.hpp"
@@ -42,6 +43,7 @@ Trader::Manager::Manager(
 		const std::string& outputDirectory)
 		: m_server(*this, port)
 		, m_startedSince(0)
+		, m_pClock(Clock::getDefault())
 {
 	// Add a stream to log warning and errors
 	IrStd::Logger::Filter filter;
@@ -67,6 +69,21 @@ const std::string& Trader::Manager::getOutputDirectory() const noexcept
 	return m_outputDirectory;
 }
 
+void Trader::Manager::setClock(std::shared_ptr<Clock> pClock) noexcept
+{
+	m_pClock = pClock;
+}
+
+Trader::Clock& Trader::Manager::getClock() const noexcept
+{
+	return *m_pClock;
+}
+
+const Trader::QuoteBook& Trader::Manager::getQuoteBook() const noexcept
+{
+	return m_quoteBook;
+}
+
 const std::string& Trader::Manager::getGlobalOutputDirectory()
 {
 	return Trader::ManagerEnvironment::getInstance().m_outputDirectory;
@@ -74,7 +91,7 @@ const std::string& Trader::Manager::getGlobalOutputDirectory()
 
 void Trader::Manager::start()
 {
-	m_startedSince = IrStd::Type::Timestamp::now();
+	m_startedSince = getClock().now();
 	m_server.start();
 
 	// Start all exchanges
@@ -86,9 +103,14 @@ void Trader::Manager::start()
 			IrStd::FileSystem::append(exchangeDirectory, pExchange->getId().c_str());
 			pExchange->setOutputDirectory(exchangeDirectory);
 		}
+		pExchange->setClock(m_pClock);
 		pExchange->start();
 	}
 
+	// Consolidate the rates of all exchanges
+	m_quoteBook.setClock(m_pClock);
+	m_quoteBook.start(m_exchangeList);
+
 	// All important threads for this 
 	std::vector<std::pair<std::string, std::thread::id>> threadList;
 
@@ -97,6 +119,7 @@ void Trader::Manager::start()
 	{
 		// Setup the strategy
 		pStrategy->setup(m_exchangeList);
+		pStrategy->m_pQuoteBook = &m_quoteBook;
 
 		// Generate the name of the thread and create the entry
 		{
@@ -114,21 +137,25 @@ void Trader::Manager::start()
 		}
 
 		// This is the thread processing the strategy
-		threadList.back().second = IrStd::Threads::create(threadList.back().first.c_str(), [&pStrategy]() {
+		threadList.back().second = IrStd::Threads::create(threadList.back().first.c_str(), [this, &pStrategy]() {
 			std::mutex mutex;
 			std::unique_lock<std::mutex> lock(mutex);
 			std::condition_variable ratesUpdated;
 			const std::thread::id threadId = std::this_thread::get_id();
 			std::vector<std::future<void>> waitForNewRatesList;
 
-			// Create threads to listen to each echanges
+			// Create threads to listen to each echanges, only the strategies
+			// processing on rate change are triggered by new rates
+			const bool isTriggerOnRates = (pStrategy->getConfiguration().getTrigger()
+					== Trader::ConfigurationStrategy::Trigger::ON_RATE_CHANGE);
 			pStrategy->getExchangeList([&](const Exchange& exchange) {
 				const Exchange* const pExchange = &exchange;
-				waitForNewRatesList.push_back(std::async(std::launch::async, [threadId, pExchange, &pStrategy, &ratesUpdated] {
+				waitForNewRatesList.push_back(std::async(std::launch::async, [threadId, pExchange, isTriggerOnRates, &pStrategy, &ratesUpdated] {
 					while (IrStd::Threads::isActive(threadId))
 					{
-						if (pExchange->waitForNewRates(4000/*4 seconds*/))
+						if (pExchange->waitForNewRates(4000/*4 seconds*/) && isTriggerOnRates)
 						{
+							pStrategy->trigger();
 							ratesUpdated.notify_one();
 						}
 					}
@@ -159,15 +186,36 @@ void Trader::Manager::start()
 				case Trader::ConfigurationStrategy::Trigger::EVERY_HOUR:
 				case Trader::ConfigurationStrategy::Trigger::EVERY_DAY:
 					{
-						IrStd::Threads::sleep(1000);
-						const auto timeDiffS = (IrStd::Type::Timestamp::now() - lastProcessedTimestamp) / 1000;
-						if (((pStrategy->getConfiguration().getTrigger() == Trader::ConfigurationStrategy::Trigger::EVERY_SECOND) && timeDiffS < 1)
-								|| ((pStrategy->getConfiguration().getTrigger() == Trader::ConfigurationStrategy::Trigger::EVERY_MINUTE) && timeDiffS < 60)
-								|| ((pStrategy->getConfiguration().getTrigger() == Trader::ConfigurationStrategy::Trigger::EVERY_HOUR) && timeDiffS < 60 * 60)
-								|| ((pStrategy->getConfiguration().getTrigger() == Trader::ConfigurationStrategy::Trigger::EVERY_DAY) && timeDiffS < 24 * 60 * 60))
+						getClock().sleep(1000);
+						uint64_t periodMs = 0;
+						switch (pStrategy->getConfiguration().getTrigger())
+						{
+						case Trader::ConfigurationStrategy::Trigger::EVERY_SECOND:
+							periodMs = 1000;
+							break;
+						case Trader::ConfigurationStrategy::Trigger::EVERY_MINUTE:
+							periodMs = 60 * 1000;
+							break;
+						case Trader::ConfigurationStrategy::Trigger::EVERY_HOUR:
+							periodMs = 60 * 60 * 1000;
+							break;
+						case Trader::ConfigurationStrategy::Trigger::EVERY_DAY:
+							periodMs = 24 * 60 * 60 * 1000;
+							break;
+						case Trader::ConfigurationStrategy::Trigger::ON_RATE_CHANGE:
+						default:
+							IRSTD_UNREACHABLE(TraderManager);
+						}
+						const auto nowMs = static_cast<uint64_t>(getClock().now());
+						const auto lastProcessedMs = static_cast<uint64_t>(lastProcessedTimestamp);
+						if (nowMs - lastProcessedMs < periodMs)
 						{
 							continue;
 						}
+						// The trigger is pending since the deadline, not since it was noticed
+						const uint64_t lateMs = (lastProcessedMs) ? nowMs - lastProcessedMs - periodMs : 0;
+						const uint64_t nowUs = LatencyHistogram::nowUs();
+						pStrategy->trigger(nowUs - std::min(lateMs * 1000, nowUs - 1));
 					}
 					break;
 
@@ -200,7 +248,7 @@ void Trader::Manager::start()
 				// Process the exchange, at this point the strategy must be initilized and
 				// all related exchanges ready
 				pStrategy->process(++counterProcess);
-				lastProcessedTimestamp = IrStd::Type::Timestamp::now();
+				lastProcessedTimestamp = getClock().now();
 			}
 
 			for (auto& waitForNewRates : waitForNewRatesList)
@@ -231,6 +279,8 @@ void Trader::Manager::start()
 
 	IRSTD_LOG_INFO(IRSTD_TOPIC(Trader, Manager), "* All strategies are stopped");
 
+	m_quoteBook.stop();
+
 	// Disconnect all exchanges
 	for (auto& pExchange : m_exchangeList)
 	{
@@ -5,6 +5,7 @@
 #include "Trader/Exchange/Exchange.hpp"
 #include "Trader/Exchange/ExchangeReadOnly.hpp"
 #include "Trader/Exchange/ExchangeMock.hpp"
+#include "Trader/Manager/QuoteBook.hpp"
 #include "Trader/Strategy/Strategy.hpp"
 #include "Trader/Server/Server.hpp"
 
@@ -108,6 +109,18 @@ namespace Trader
 			return m_startedSince;
 		}
 
+		/**
+		 * Set the clock driving the strategies and the exchanges,
+		 * it is assigned to all exchanges when the manager starts.
+		 */
+		void setClock(std::shared_ptr<Clock> pClock) noexcept;
+		Clock& getClock() const noexcept;
+
+		/**
+		 * Best rates across all exchanges, updated once the manager is started
+		 */
+		const QuoteBook& getQuoteBook() const noexcept;
+
 		void start();
 
 		static const std::string& getGlobalOutputDirectory();
@@ -120,6 +133,8 @@ namespace Trader
 		std::vector<std::shared_ptr<Exchange>> m_exchangeList;
 		std::vector<std::unique_ptr<Strategy>> m_strategyList;
 		IrStd::Type::Timestamp m_startedSince;
+		std::shared_ptr<Clock> m_pClock;
+		QuoteBook m_quoteBook;
 
 		std::string m_outputDirectory;
 	};
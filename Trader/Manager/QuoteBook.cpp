@@ -0,0 +1,232 @@
+#include <cstring>
+
+#include "Trader/Manager/QuoteBook.hpp"
+#include "Trader/Exchange/Exchange.hpp"
+
+IRSTD_TOPIC_USE_ALIAS(TraderManager, Trader, Manager);
+
+namespace
+{
+	uint64_t toBits(const double value) noexcept
+	{
+		uint64_t bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return bits;
+	}
+
+	double fromBits(const uint64_t bits) noexcept
+	{
+		double value;
+		std::memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+}
+
+// ---- Trader::QuoteBook::Entry ----------------------------------------------
+
+Trader::QuoteBook::Entry::Entry() noexcept
+		: m_sequence(0)
+		, m_rate(toBits(0.))
+		, m_exchangeIndex(0)
+		, m_timestamp(0)
+{
+}
+
+void Trader::QuoteBook::Entry::store(const Quote& quote) noexcept
+{
+	// The sequence is odd while writing
+	const auto sequence = m_sequence.load(std::memory_order_relaxed);
+	m_sequence.store(sequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	m_rate.store(toBits(static_cast<double>(quote.m_rate)), std::memory_order_relaxed);
+	m_exchangeIndex.store(quote.m_exchangeIndex, std::memory_order_relaxed);
+	m_timestamp.store(static_cast<uint64_t>(quote.m_timestamp), std::memory_order_relaxed);
+	m_sequence.store(sequence + 2, std::memory_order_release);
+}
+
+bool Trader::QuoteBook::Entry::load(Quote& quote) const noexcept
+{
+	uint64_t sequence;
+	uint64_t rate;
+	uint64_t exchangeIndex;
+	uint64_t timestamp;
+	do
+	{
+		sequence = m_sequence.load(std::memory_order_acquire);
+		rate = m_rate.load(std::memory_order_relaxed);
+		exchangeIndex = m_exchangeIndex.load(std::memory_order_relaxed);
+		timestamp = m_timestamp.load(std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_acquire);
+	} while ((sequence & 1) || sequence != m_sequence.load(std::memory_order_relaxed));
+
+	quote.m_rate = fromBits(rate);
+	quote.m_exchangeIndex = static_cast<size_t>(exchangeIndex);
+	quote.m_timestamp = IrStd::Type::Timestamp(timestamp);
+	return fromBits(rate) > 0.;
+}
+
+// ---- Trader::QuoteBook -----------------------------------------------------
+
+constexpr uint64_t Trader::QuoteBook::DEFAULT_MAX_AGE_MS;
+constexpr uint64_t Trader::QuoteBook::UPDATE_PERIOD_MS;
+
+Trader::QuoteBook::QuoteBook(const uint64_t maxAgeMs)
+		: m_maxAgeMs(maxAgeMs)
+		, m_pClock(Clock::getDefault())
+		, m_bestList(new Entry[Currency::NB_CURRENCIES * Currency::NB_CURRENCIES])
+{
+}
+
+Trader::QuoteBook::~QuoteBook()
+{
+	stop();
+}
+
+void Trader::QuoteBook::setClock(std::shared_ptr<Clock> pClock) noexcept
+{
+	m_pClock = pClock;
+}
+
+void Trader::QuoteBook::start(const std::vector<std::shared_ptr<Exchange>>& exchangeList)
+{
+	IRSTD_ASSERT(TraderManager, m_threadIdList.empty(), "The quote book is already started");
+	for (size_t index = 0; index < exchangeList.size(); ++index)
+	{
+		std::string name(exchangeList[index]->getId());
+		name += "::QuoteBook";
+		m_threadIdList.push_back(IrStd::Threads::create(name.c_str(), &QuoteBook::exchangeThread, this,
+				index, std::cref(*exchangeList[index])));
+	}
+}
+
+void Trader::QuoteBook::stop()
+{
+	for (const auto id : m_threadIdList)
+	{
+		IrStd::Threads::terminate(id);
+	}
+	m_threadIdList.clear();
+}
+
+void Trader::QuoteBook::exchangeThread(
+		const size_t exchangeIndex,
+		const Exchange& exchange)
+{
+	while (IrStd::Threads::isActive())
+	{
+		IrStd::Threads::setIdle();
+		exchange.waitForNewRates(UPDATE_PERIOD_MS);
+		IrStd::Threads::setActive();
+		try
+		{
+			update(exchangeIndex, exchange.getTransactionMap());
+		}
+		catch (const IrStd::Exception& e)
+		{
+			IRSTD_LOG_ERROR(TraderManager, "Cannot update the quotes of " << exchange.getId() << ": " << e);
+		}
+	}
+}
+
+void Trader::QuoteBook::update(
+		const size_t exchangeIndex,
+		const PairTransactionMap& transactionMap)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+	const auto now = m_pClock->now();
+
+	if (m_exchangeQuoteList.size() <= exchangeIndex)
+	{
+		m_exchangeQuoteList.resize(exchangeIndex + 1, std::vector<Quote>(Currency::NB_CURRENCIES * Currency::NB_CURRENCIES,
+				Quote{IrStd::Type::Decimal(0.), 0, IrStd::Type::Timestamp(0)}));
+	}
+
+	// Latest rates of this exchange
+	auto& quoteList = m_exchangeQuoteList[exchangeIndex];
+	m_updatedIndexList.clear();
+	transactionMap.getTransactions([&](const CurrencyPtr initialCurrency, const CurrencyPtr finalCurrency,
+			const PairTransactionMap::PairTransactionPointer pTransaction) {
+		const auto index = getIndex(initialCurrency, finalCurrency);
+		quoteList[index] = Quote{pTransaction->getRate(), exchangeIndex, pTransaction->getTimestamp()};
+		m_updatedIndexList.push_back(index);
+	});
+
+	// Recompute the best quotes of these pairs only, stale quotes of the other
+	// exchanges are dropped as well. Stale best quotes of the other pairs are
+	// filtered out when read and replaced at the next update of their exchange.
+	// Entries are written only if they changed to not disturb the readers.
+	for (const auto index : m_updatedIndexList)
+	{
+		const Quote* pBest = nullptr;
+		for (const auto& exchangeQuoteList : m_exchangeQuoteList)
+		{
+			const auto& quote = exchangeQuoteList[index];
+			if (quote.m_rate > 0. && isRecent(quote.m_timestamp, now)
+					&& (!pBest || quote.m_rate > pBest->m_rate))
+			{
+				pBest = &quote;
+			}
+		}
+
+		Quote current{IrStd::Type::Decimal(0.), 0, IrStd::Type::Timestamp(0)};
+		const bool isCurrent = m_bestList[index].load(current);
+		if (pBest)
+		{
+			if (!isCurrent || current.m_rate != pBest->m_rate || current.m_exchangeIndex != pBest->m_exchangeIndex
+					|| static_cast<uint64_t>(current.m_timestamp) != static_cast<uint64_t>(pBest->m_timestamp))
+			{
+				m_bestList[index].store(*pBest);
+			}
+		}
+		else if (isCurrent)
+		{
+			m_bestList[index].store(Quote{IrStd::Type::Decimal(0.), 0, IrStd::Type::Timestamp(0)});
+		}
+	}
+}
+
+bool Trader::QuoteBook::getBest(
+		const CurrencyPtr initialCurrency,
+		const CurrencyPtr finalCurrency,
+		Quote& quote) const noexcept
+{
+	// The best quote might have become stale since the last update
+	return m_bestList[getIndex(initialCurrency, finalCurrency)].load(quote)
+			&& isRecent(quote.m_timestamp, m_pClock->now());
+}
+
+bool Trader::QuoteBook::getBestBid(
+		const CurrencyPtr currency,
+		const CurrencyPtr counterCurrency,
+		Quote& quote) const noexcept
+{
+	return getBest(currency, counterCurrency, quote);
+}
+
+bool Trader::QuoteBook::getBestAsk(
+		const CurrencyPtr currency,
+		const CurrencyPtr counterCurrency,
+		Quote& quote) const noexcept
+{
+	// Buying is converting the counter currency, the lowest price is the highest rate
+	if (!getBest(counterCurrency, currency, quote))
+	{
+		return false;
+	}
+	quote.m_rate = IrStd::Type::Decimal(1.) / quote.m_rate;
+	return true;
+}
+
+size_t Trader::QuoteBook::getIndex(
+		const CurrencyPtr initialCurrency,
+		const CurrencyPtr finalCurrency) noexcept
+{
+	return initialCurrency->getOrdinal() * Currency::NB_CURRENCIES + finalCurrency->getOrdinal();
+}
+
+bool Trader::QuoteBook::isRecent(
+		const IrStd::Type::Timestamp timestamp,
+		const IrStd::Type::Timestamp now) const noexcept
+{
+	return static_cast<uint64_t>(timestamp) + m_maxAgeMs >= static_cast<uint64_t>(now);
+}
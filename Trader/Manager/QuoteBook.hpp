@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "IrStd/IrStd.hpp"
+
+#include "Trader/Exchange/Currency/Currency.hpp"
+#include "Trader/Exchange/Transaction/PairTransactionMap.hpp"
+#include "Trader/Generic/Clock/Clock.hpp"
+
+namespace Trader
+{
+	class Exchange;
+
+	/**
+	 * Best rate of each currency pair across all the exchanges.
+	 *
+	 * Each exchange updates its own quotes when it receives new rates, the
+	 * consolidated quotes of the pairs it trades are then recomputed from the
+	 * quotes of all exchanges. Quotes older than the maximum age are ignored.
+	 * The consolidated quotes can be read lock-free from any thread in
+	 * constant time.
+	 */
+	class QuoteBook
+	{
+	public:
+		static constexpr uint64_t DEFAULT_MAX_AGE_MS = 10000;
+		/**
+		 * Maximal time between 2 updates of the quotes of an exchange,
+		 * so that stale quotes are replaced even without new rates.
+		 */
+		static constexpr uint64_t UPDATE_PERIOD_MS = 1000;
+
+		struct Quote
+		{
+			/**
+			 * Amount of the final currency received for one initial currency
+			 */
+			IrStd::Type::Decimal m_rate;
+			/**
+			 * Index of the exchange, as registered in the manager
+			 */
+			size_t m_exchangeIndex;
+			IrStd::Type::Timestamp m_timestamp;
+		};
+
+		explicit QuoteBook(const uint64_t maxAgeMs = DEFAULT_MAX_AGE_MS);
+		~QuoteBook();
+
+		void setClock(std::shared_ptr<Clock> pClock) noexcept;
+
+		/**
+		 * Update the quotes of each exchange in the background, on new rates
+		 */
+		void start(const std::vector<std::shared_ptr<Exchange>>& exchangeList);
+		void stop();
+
+		/**
+		 * Update the quotes of the exchange \p exchangeIndex from its current rates,
+		 * only the pairs present in \p transactionMap are recomputed
+		 */
+		void update(const size_t exchangeIndex, const PairTransactionMap& transactionMap);
+
+		/**
+		 * Highest rate to convert \p initialCurrency into \p finalCurrency
+		 * \return false if no exchange has a recent rate for this pair
+		 */
+		bool getBest(const CurrencyPtr initialCurrency, const CurrencyPtr finalCurrency, Quote& quote) const noexcept;
+
+		/**
+		 * Highest price offered for \p currency, in \p counterCurrency
+		 */
+		bool getBestBid(const CurrencyPtr currency, const CurrencyPtr counterCurrency, Quote& quote) const noexcept;
+
+		/**
+		 * Lowest price asked for \p currency, in \p counterCurrency
+		 */
+		bool getBestAsk(const CurrencyPtr currency, const CurrencyPtr counterCurrency, Quote& quote) const noexcept;
+
+	private:
+		/**
+		 * Quote written under the writer lock and read without lock, readers
+		 * retry if the sequence changed while reading (seqlock).
+		 */
+		class Entry
+		{
+		public:
+			Entry() noexcept;
+			void store(const Quote& quote) noexcept;
+			/**
+			 * \return false if there is no quote
+			 */
+			bool load(Quote& quote) const noexcept;
+
+		private:
+			std::atomic<uint64_t> m_sequence;
+			std::atomic<uint64_t> m_rate;
+			std::atomic<uint64_t> m_exchangeIndex;
+			std::atomic<uint64_t> m_timestamp;
+		};
+
+		static size_t getIndex(const CurrencyPtr initialCurrency, const CurrencyPtr finalCurrency) noexcept;
+		bool isRecent(const IrStd::Type::Timestamp timestamp, const IrStd::Type::Timestamp now) const noexcept;
+		void exchangeThread(const size_t exchangeIndex, const Exchange& exchange);
+
+		const uint64_t m_maxAgeMs;
+		std::shared_ptr<Clock> m_pClock;
+
+		// Consolidated quotes indexed by the ordinals of the currency pair
+		std::unique_ptr<Entry[]> m_bestList;
+
+		// Latest quotes of each exchange, protected by the writer lock
+		std::mutex m_lock;
+		std::vector<std::vector<Quote>> m_exchangeQuoteList;
+		// Pairs updated by the current call to update(), kept to not allocate each time
+		std::vector<size_t> m_updatedIndexList;
+
+		std::vector<std::thread::id> m_threadIdList;
+	};
+}
@@ -0,0 +1,287 @@
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include "Trader/Server/AssetCache.hpp"
+#include "Trader/Generic/Compression/Gzip.hpp"
+
+IRSTD_TOPIC_REGISTER(Trader, AssetCache);
+IRSTD_TOPIC_USE_ALIAS(TraderAssetCache, Trader, AssetCache);
+
+namespace
+{
+	/**
+	 * FNV-1a hash of the content, used as entity tag
+	 */
+	uint64_t hash(const std::string& data) noexcept
+	{
+		uint64_t value = 14695981039346656037ull;
+		for (const char c : data)
+		{
+			value ^= static_cast<uint8_t>(c);
+			value *= 1099511628211ull;
+		}
+		return value;
+	}
+
+	bool readFile(const std::string& path, std::string& content)
+	{
+		std::ifstream ifs(path, std::ios::binary);
+		if (!ifs)
+		{
+			return false;
+		}
+		content.assign((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
+		return true;
+	}
+}
+
+// ---- Trader::AssetCache ----------------------------------------------------
+
+constexpr size_t Trader::AssetCache::MAX_ASSET_SIZE;
+
+Trader::AssetCache::AssetCache(
+		const std::string& rootPath,
+		const bool isWatch)
+		: m_rootPath(rootPath)
+		, m_fdNotify(-1)
+		, m_isRunning(isWatch)
+{
+	if (isWatch)
+	{
+		m_fdNotify = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (m_fdNotify < 0)
+		{
+			IRSTD_LOG_WARNING(TraderAssetCache, "Cannot watch '" << m_rootPath << "', assets will not be reloaded: "
+					<< std::strerror(errno));
+			m_isRunning = false;
+		}
+	}
+
+	loadDirectory("");
+
+	size_t size = 0;
+	for (const auto& asset : m_assetList)
+	{
+		size += asset.second->m_content.size() + asset.second->m_contentGzip.size();
+	}
+	IRSTD_LOG_INFO(TraderAssetCache, "Loaded " << m_assetList.size() << " asset(s) from '" << m_rootPath
+			<< "' (" << IrStd::Type::Memory(size) << ")");
+
+	if (m_isRunning)
+	{
+		m_threadId = IrStd::Threads::create("AssetCache", &AssetCache::watchThread, this);
+	}
+}
+
+Trader::AssetCache::~AssetCache()
+{
+	if (m_isRunning)
+	{
+		m_isRunning = false;
+		IrStd::Threads::terminate(m_threadId);
+	}
+	if (m_fdNotify >= 0)
+	{
+		::close(m_fdNotify);
+	}
+}
+
+std::shared_ptr<const Trader::AssetCache::Asset> Trader::AssetCache::create(
+		std::string&& content,
+		const std::string& extension)
+{
+	std::shared_ptr<Asset> pAsset = std::make_shared<Asset>();
+	pAsset->m_mimeType = IrStd::ServerImpl::MimeType::fromFileExtension(extension.c_str());
+
+	char etag[24];
+	std::snprintf(etag, sizeof(etag), "\"%016llx\"", static_cast<unsigned long long>(hash(content)));
+	pAsset->m_etag = etag;
+
+	try
+	{
+		auto contentGzip = Gzip::compress(content);
+		if (contentGzip.size() < content.size())
+		{
+			pAsset->m_contentGzip = std::move(contentGzip);
+		}
+	}
+	catch (const IrStd::Exception& e)
+	{
+		IRSTD_LOG_WARNING(TraderAssetCache, "Asset will be served uncompressed: " << e);
+	}
+
+	pAsset->m_content = std::move(content);
+	return pAsset;
+}
+
+std::shared_ptr<const Trader::AssetCache::Asset> Trader::AssetCache::get(const std::string& uri) const
+{
+	auto scope = m_lock.readScope();
+	const auto it = m_assetList.find(uri);
+	return (it == m_assetList.end()) ? nullptr : it->second;
+}
+
+size_t Trader::AssetCache::getNbAssets() const
+{
+	auto scope = m_lock.readScope();
+	return m_assetList.size();
+}
+
+std::string Trader::AssetCache::getPath(const std::string& uri) const
+{
+	return m_rootPath + uri;
+}
+
+// ---- Trader::AssetCache (load) ---------------------------------------------
+
+void Trader::AssetCache::loadDirectory(const std::string& uri)
+{
+	DIR* const pDir = ::opendir(getPath(uri).c_str());
+	if (!pDir)
+	{
+		IRSTD_LOG_WARNING(TraderAssetCache, "Cannot open directory '" << getPath(uri) << "': " << std::strerror(errno));
+		return;
+	}
+
+	addWatch(uri);
+
+	std::vector<std::string> nameList;
+	while (const struct dirent* const pEntry = ::readdir(pDir))
+	{
+		if (std::strcmp(pEntry->d_name, ".") && std::strcmp(pEntry->d_name, ".."))
+		{
+			nameList.push_back(pEntry->d_name);
+		}
+	}
+	::closedir(pDir);
+
+	for (const auto& name : nameList)
+	{
+		const std::string uriEntry = uri + "/" + name;
+		struct stat info;
+		if (::stat(getPath(uriEntry).c_str(), &info) == 0)
+		{
+			if (S_ISDIR(info.st_mode))
+			{
+				loadDirectory(uriEntry);
+			}
+			else if (S_ISREG(info.st_mode))
+			{
+				loadFile(uriEntry);
+			}
+		}
+	}
+}
+
+void Trader::AssetCache::loadFile(const std::string& uri)
+{
+	std::string content;
+	if (!readFile(getPath(uri), content))
+	{
+		erase(uri);
+		return;
+	}
+	if (content.size() > MAX_ASSET_SIZE)
+	{
+		IRSTD_LOG_DEBUG(TraderAssetCache, "Asset '" << uri << "' is too large to be cached ("
+				<< IrStd::Type::Memory(content.size()) << ")");
+		erase(uri);
+		return;
+	}
+
+	const auto pos = uri.find_last_of('.');
+	const auto extension = (pos == std::string::npos) ? std::string() : uri.substr(pos + 1);
+	auto pAsset = create(std::move(content), extension);
+	{
+		auto scope = m_lock.writeScope();
+		m_assetList[uri] = std::move(pAsset);
+	}
+	IRSTD_LOG_TRACE(TraderAssetCache, "Loaded '" << uri << "'");
+}
+
+void Trader::AssetCache::erase(const std::string& uri)
+{
+	auto scope = m_lock.writeScope();
+	m_assetList.erase(uri);
+}
+
+// ---- Trader::AssetCache (watch) --------------------------------------------
+
+void Trader::AssetCache::addWatch(const std::string& uri)
+{
+	if (m_fdNotify < 0)
+	{
+		return;
+	}
+	const int wd = ::inotify_add_watch(m_fdNotify, getPath(uri).c_str(),
+			IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO);
+	if (wd < 0)
+	{
+		IRSTD_LOG_WARNING(TraderAssetCache, "Cannot watch '" << getPath(uri) << "': " << std::strerror(errno));
+		return;
+	}
+	m_watchList[wd] = uri;
+}
+
+void Trader::AssetCache::watchThread()
+{
+	alignas(struct inotify_event) char buffer[16 * 1024];
+	struct pollfd pollFd{m_fdNotify, POLLIN, 0};
+
+	while (m_isRunning)
+	{
+		// Wake up regularly to check if the cache is still in use
+		if (::poll(&pollFd, 1, /*timeoutMs*/200) <= 0)
+		{
+			continue;
+		}
+
+		ssize_t size;
+		while ((size = ::read(m_fdNotify, buffer, sizeof(buffer))) > 0)
+		{
+			for (ssize_t offset = 0; offset < size; )
+			{
+				const auto pEvent = reinterpret_cast<const struct inotify_event*>(buffer + offset);
+				offset += sizeof(struct inotify_event) + pEvent->len;
+
+				const auto it = m_watchList.find(pEvent->wd);
+				if (it == m_watchList.end() || !pEvent->len)
+				{
+					continue;
+				}
+				const std::string uri = it->second + "/" + pEvent->name;
+
+				try
+				{
+					if (pEvent->mask & IN_ISDIR)
+					{
+						if (pEvent->mask & (IN_CREATE | IN_MOVED_TO))
+						{
+							loadDirectory(uri);
+						}
+					}
+					else if (pEvent->mask & (IN_CLOSE_WRITE | IN_MOVED_TO))
+					{
+						loadFile(uri);
+					}
+					else if (pEvent->mask & (IN_DELETE | IN_MOVED_FROM))
+					{
+						erase(uri);
+					}
+				}
+				catch (const IrStd::Exception& e)
+				{
+					IRSTD_LOG_ERROR(TraderAssetCache, "Cannot reload '" << uri << "': " << e);
+				}
+			}
+		}
+	}
+}
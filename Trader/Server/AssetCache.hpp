@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "IrStd/IrStd.hpp"
+
+IRSTD_TOPIC_USE(Trader, AssetCache);
+
+namespace Trader
+{
+	/**
+	 * In-memory copy of the static files served by the HTTP server.
+	 *
+	 * All the files under the root directory are loaded at construction, with
+	 * their content type, entity tag and a gzip-compressed copy computed once.
+	 * A background thread watches the directories with inotify and reloads
+	 * the files as they change, so requests never touch the file system.
+	 */
+	class AssetCache
+	{
+	public:
+		/**
+		 * Files larger than this are not cached
+		 */
+		static constexpr size_t MAX_ASSET_SIZE = 16 * 1024 * 1024;
+
+		struct Asset
+		{
+			std::string m_content;
+			// Empty if compressing does not make the content smaller
+			std::string m_contentGzip;
+			std::string m_etag;
+			std::string m_mimeType;
+		};
+
+		/**
+		 * \param isWatch Reload the files when they are modified
+		 */
+		explicit AssetCache(const std::string& rootPath, const bool isWatch = true);
+		~AssetCache();
+
+		/**
+		 * Get an asset from its URI (relative to the root path, starting with '/'),
+		 * a null pointer is returned if it is not cached.
+		 */
+		std::shared_ptr<const Asset> get(const std::string& uri) const;
+
+		size_t getNbAssets() const;
+
+		/**
+		 * Build an asset from the content of a file
+		 */
+		static std::shared_ptr<const Asset> create(std::string&& content, const std::string& extension);
+
+	private:
+		void loadDirectory(const std::string& uri);
+		void loadFile(const std::string& uri);
+		void erase(const std::string& uri);
+		std::string getPath(const std::string& uri) const;
+
+		void addWatch(const std::string& uri);
+		void watchThread();
+
+		const std::string m_rootPath;
+		mutable IrStd::RWLock m_lock;
+		std::map<std::string, std::shared_ptr<const Asset>> m_assetList;
+
+		// Watched directories, only accessed by the constructor and the watch thread
+		std::map<int, std::string> m_watchList;
+		int m_fdNotify;
+		std::atomic<bool> m_isRunning;
+		std::thread::id m_threadId;
+	};
+}
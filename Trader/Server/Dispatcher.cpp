@@ -0,0 +1,106 @@
+#include "Trader/Server/Dispatcher.hpp"
+#include "Trader/Generic/Clock/Clock.hpp"
+
+IRSTD_TOPIC_USE_ALIAS(TraderServer, Trader, Server);
+
+namespace
+{
+	// Deadline of the request handled by the current thread, 0 if none
+	thread_local uint64_t tDeadlineUs = 0;
+
+	uint64_t nowUs() noexcept
+	{
+		return Trader::FastClock::getInstance().nowUs();
+	}
+}
+
+// ---- Trader::Dispatcher ----------------------------------------------------
+
+constexpr uint64_t Trader::Dispatcher::DEFAULT_TIMEOUT_MS;
+
+const char* Trader::Dispatcher::Cancelled::what() const noexcept
+{
+	return "Request cancelled";
+}
+
+Trader::Dispatcher::Dispatcher(IrStd::ServerREST& server, IrStd::ServerREST* const pMonitoringServer)
+		: m_server(server)
+		, m_pMonitoringServer(pMonitoringServer)
+{
+}
+
+void Trader::Dispatcher::addRoute(
+		const IrStd::HTTPMethod method,
+		const char* const pRoute,
+		Handler handler,
+		const uint64_t timeoutMs)
+{
+	m_server.addRoute(method, pRoute, [this, handler, timeoutMs](IrStd::ServerREST::Context& context) {
+		switch (execute([&]() { handler(context); }, timeoutMs))
+		{
+		case Status::DONE:
+			break;
+		case Status::TIMEOUT:
+			context.getResponse().setStatus(504);
+			break;
+		default:
+			IRSTD_UNREACHABLE(TraderServer);
+		}
+	});
+}
+
+void Trader::Dispatcher::addMonitoringRoute(
+		const IrStd::HTTPMethod method,
+		const char* const pRoute,
+		Handler handler)
+{
+	m_server.addRoute(method, pRoute, handler);
+	if (m_pMonitoringServer)
+	{
+		m_pMonitoringServer->addRoute(method, pRoute, handler);
+	}
+}
+
+Trader::Dispatcher::Status Trader::Dispatcher::execute(
+		const std::function<void()>& job,
+		const uint64_t timeoutMs)
+{
+	struct DeadlineScope
+	{
+		explicit DeadlineScope(const uint64_t deadlineUs) noexcept
+				: m_previousDeadlineUs(tDeadlineUs)
+		{
+			tDeadlineUs = deadlineUs;
+		}
+		~DeadlineScope()
+		{
+			tDeadlineUs = m_previousDeadlineUs;
+		}
+		const uint64_t m_previousDeadlineUs;
+	};
+
+	DeadlineScope scope(nowUs() + timeoutMs * 1000);
+	try
+	{
+		job();
+	}
+	catch (const Cancelled&)
+	{
+		IRSTD_LOG_WARNING(TraderServer, "Request took more than " << timeoutMs << "ms, cancelled");
+		return Status::TIMEOUT;
+	}
+	return Status::DONE;
+}
+
+void Trader::Dispatcher::checkCancelled()
+{
+	if (isCancelled())
+	{
+		throw Cancelled();
+	}
+}
+
+bool Trader::Dispatcher::isCancelled() noexcept
+{
+	return tDeadlineUs && nowUs() >= tDeadlineUs;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <exception>
+#include <functional>
+
+#include "IrStd/IrStd.hpp"
+
+namespace Trader
+{
+	/**
+	 * Execute the route handlers of the REST server with a deadline.
+	 *
+	 * Handlers run on the server thread. Past the deadline of its route, a request
+	 * is cancelled and answered with 504. Cancellation is cooperative: long handlers
+	 * call checkCancelled() while iterating, which unwinds them; a handler which
+	 * does not check runs to completion.
+	 *
+	 * Monitoring routes have no deadline. They are also served by a second server
+	 * on its own thread, so they stay responsive while a long request is running.
+	 */
+	class Dispatcher
+	{
+	public:
+		typedef std::function<void(IrStd::ServerREST::Context&)> Handler;
+
+		static constexpr uint64_t DEFAULT_TIMEOUT_MS = 10000;
+
+		enum class Status
+		{
+			DONE,
+			TIMEOUT
+		};
+
+		/**
+		 * Thrown by checkCancelled() to unwind a request past its deadline
+		 */
+		class Cancelled : public std::exception
+		{
+		public:
+			const char* what() const noexcept override;
+		};
+
+		Dispatcher(IrStd::ServerREST& server, IrStd::ServerREST* const pMonitoringServer = nullptr);
+
+		/**
+		 * Add a route cancelled after \p timeoutMs
+		 */
+		void addRoute(const IrStd::HTTPMethod method, const char* const pRoute, Handler handler,
+				const uint64_t timeoutMs = DEFAULT_TIMEOUT_MS);
+
+		/**
+		 * Add a route executed without deadline, it must be short.
+		 * It is registered to the monitoring server as well.
+		 */
+		void addMonitoringRoute(const IrStd::HTTPMethod method, const char* const pRoute, Handler handler);
+
+		/**
+		 * Execute \p job with a deadline. Exceptions are forwarded to the caller,
+		 * except Cancelled.
+		 */
+		Status execute(const std::function<void()>& job, const uint64_t timeoutMs);
+
+		/**
+		 * Throw Cancelled if the request handled by the current thread has been
+		 * cancelled. It must not be called from a noexcept function, use
+		 * isCancelled() there and call it once back.
+		 */
+		static void checkCancelled();
+		static bool isCancelled() noexcept;
+
+	private:
+		IrStd::ServerREST& m_server;
+		IrStd::ServerREST* const m_pMonitoringServer;
+	};
+}
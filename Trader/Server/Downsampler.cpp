@@ -0,0 +1,302 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Trader/Server/Downsampler.hpp"
+
+IRSTD_TOPIC_USE_ALIAS(TraderServer, Trader, Server);
+
+namespace
+{
+	struct Point
+	{
+		Point()
+				: m_timestamp(0)
+				, m_rate(0)
+		{
+		}
+
+		Point(const IrStd::Type::Timestamp timestamp, const IrStd::Type::Decimal rate)
+				: m_timestamp(timestamp)
+				, m_rate(rate)
+		{
+		}
+
+		IrStd::Type::Timestamp m_timestamp;
+		IrStd::Type::Decimal m_rate;
+	};
+}
+
+// ---- Trader::Downsampler ---------------------------------------------------
+
+constexpr size_t Trader::Downsampler::MIN_POINTS;
+constexpr size_t Trader::Downsampler::MAX_POINTS;
+
+Trader::Downsampler::Algorithm Trader::Downsampler::fromString(const std::string& name)
+{
+	if (name == "lttb")
+	{
+		return Algorithm::LTTB;
+	}
+	if (name == "minmax")
+	{
+		return Algorithm::MIN_MAX;
+	}
+	if (name == "last")
+	{
+		return Algorithm::LAST;
+	}
+	IRSTD_THROW(TraderServer, "Unknown downsampling algorithm '" << name << "'");
+}
+
+void Trader::Downsampler::process(
+		const Algorithm algorithm,
+		const Source& source,
+		const IrStd::Type::Timestamp fromTimestamp,
+		const IrStd::Type::Timestamp toTimestamp,
+		const size_t maxPoints,
+		const Callback& callback)
+{
+	const size_t nbPoints = std::min(std::max(maxPoints, MIN_POINTS), MAX_POINTS);
+	switch (algorithm)
+	{
+	case Algorithm::LTTB:
+		// The first and last points are always kept
+		processLttb(source, Buckets(fromTimestamp, toTimestamp, nbPoints - 2), nbPoints, callback);
+		break;
+	case Algorithm::MIN_MAX:
+		processMinMax(source, Buckets(fromTimestamp, toTimestamp, nbPoints / 2), callback);
+		break;
+	case Algorithm::LAST:
+		processLast(source, Buckets(fromTimestamp, toTimestamp, nbPoints), callback);
+		break;
+	default:
+		IRSTD_UNREACHABLE(TraderServer);
+	}
+}
+
+void Trader::Downsampler::processLttb(
+		const Source& source,
+		const Buckets& buckets,
+		const size_t maxPoints,
+		const Callback& callback)
+{
+	struct Bucket
+	{
+		double m_sumX;
+		double m_sumY;
+		size_t m_count;
+		// Average of the next non-empty bucket
+		double m_nextX;
+		double m_nextY;
+	};
+	std::vector<Bucket> bucketList(buckets.size(), Bucket{0., 0., 0, 0., 0.});
+
+	// First pass, average of each bucket
+	Point first;
+	Point last;
+	size_t nbPoints = 0;
+	source([&](const IrStd::Type::Timestamp timestamp, const IrStd::Type::Decimal rate) {
+		if (!nbPoints)
+		{
+			first = Point(timestamp, rate);
+		}
+		last = Point(timestamp, rate);
+		++nbPoints;
+		auto& bucket = bucketList[buckets.getIndex(timestamp)];
+		bucket.m_sumX += static_cast<double>(static_cast<uint64_t>(timestamp));
+		bucket.m_sumY += static_cast<double>(rate);
+		++bucket.m_count;
+	});
+
+	if (!nbPoints)
+	{
+		return;
+	}
+
+	const uint64_t newest = static_cast<uint64_t>(first.m_timestamp);
+	const uint64_t oldest = static_cast<uint64_t>(last.m_timestamp);
+
+	// Points added or removed since the first pass are ignored
+	const auto isInRange = [&](const IrStd::Type::Timestamp timestamp) {
+		return static_cast<uint64_t>(timestamp) <= newest && static_cast<uint64_t>(timestamp) >= oldest;
+	};
+
+	if (nbPoints <= maxPoints)
+	{
+		source([&](const IrStd::Type::Timestamp timestamp, const IrStd::Type::Decimal rate) {
+			if (isInRange(timestamp))
+			{
+				callback(timestamp, rate);
+			}
+		});
+		return;
+	}
+
+	// Abscissas are relative to the newest point to keep the precision
+	{
+		double nextX = static_cast<double>(newest - oldest);
+		double nextY = static_cast<double>(last.m_rate);
+		for (auto it = bucketList.rbegin(); it != bucketList.rend(); ++it)
+		{
+			it->m_nextX = nextX;
+			it->m_nextY = nextY;
+			if (it->m_count)
+			{
+				nextX = static_cast<double>(newest) - it->m_sumX / it->m_count;
+				nextY = it->m_sumY / it->m_count;
+			}
+		}
+	}
+
+	// Second pass, select the point forming the largest triangle with the
+	// previously selected point and the average of the next bucket.
+	Point selected = first;
+	Point best;
+	double bestArea = -1.;
+	size_t curIndex = 0;
+	bool isFirst = true;
+
+	const auto flush = [&]() {
+		if (bestArea >= 0.)
+		{
+			callback(best.m_timestamp, best.m_rate);
+			selected = best;
+			bestArea = -1.;
+		}
+	};
+
+	source([&](const IrStd::Type::Timestamp timestamp, const IrStd::Type::Decimal rate) {
+		const uint64_t t = static_cast<uint64_t>(timestamp);
+		if (!isInRange(timestamp) || t == oldest)
+		{
+			return;
+		}
+		if (isFirst)
+		{
+			callback(timestamp, rate);
+			isFirst = false;
+			return;
+		}
+
+		const size_t index = buckets.getIndex(timestamp);
+		if (index != curIndex)
+		{
+			flush();
+			curIndex = index;
+		}
+
+		const auto& bucket = bucketList[index];
+		const double aX = static_cast<double>(newest - static_cast<uint64_t>(selected.m_timestamp));
+		const double aY = static_cast<double>(selected.m_rate);
+		const double bX = static_cast<double>(newest - t);
+		const double bY = static_cast<double>(rate);
+		const double area = std::fabs((aX - bucket.m_nextX) * (bY - aY) - (aX - bX) * (bucket.m_nextY - aY));
+		if (area > bestArea)
+		{
+			best = Point(timestamp, rate);
+			bestArea = area;
+		}
+	});
+
+	flush();
+	callback(last.m_timestamp, last.m_rate);
+}
+
+void Trader::Downsampler::processMinMax(
+		const Source& source,
+		const Buckets& buckets,
+		const Callback& callback)
+{
+	Point min;
+	Point max;
+	size_t curIndex = 0;
+	bool isEmpty = true;
+
+	// Points are sent in the order they have been read, newest first
+	const auto flush = [&]() {
+		if (isEmpty)
+		{
+			return;
+		}
+		const bool isMinFirst = (static_cast<uint64_t>(min.m_timestamp) > static_cast<uint64_t>(max.m_timestamp));
+		const Point& point1 = (isMinFirst) ? min : max;
+		const Point& point2 = (isMinFirst) ? max : min;
+		callback(point1.m_timestamp, point1.m_rate);
+		if (static_cast<uint64_t>(point1.m_timestamp) != static_cast<uint64_t>(point2.m_timestamp))
+		{
+			callback(point2.m_timestamp, point2.m_rate);
+		}
+	};
+
+	source([&](const IrStd::Type::Timestamp timestamp, const IrStd::Type::Decimal rate) {
+		const size_t index = buckets.getIndex(timestamp);
+		if (isEmpty || index != curIndex)
+		{
+			flush();
+			min = Point(timestamp, rate);
+			max = min;
+			curIndex = index;
+			isEmpty = false;
+		}
+		else if (static_cast<double>(rate) < static_cast<double>(min.m_rate))
+		{
+			min = Point(timestamp, rate);
+		}
+		else if (static_cast<double>(rate) > static_cast<double>(max.m_rate))
+		{
+			max = Point(timestamp, rate);
+		}
+	});
+
+	flush();
+}
+
+void Trader::Downsampler::processLast(
+		const Source& source,
+		const Buckets& buckets,
+		const Callback& callback)
+{
+	size_t curIndex = 0;
+	bool isEmpty = true;
+
+	// The first point read of each bucket is the latest
+	source([&](const IrStd::Type::Timestamp timestamp, const IrStd::Type::Decimal rate) {
+		const size_t index = buckets.getIndex(timestamp);
+		if (isEmpty || index != curIndex)
+		{
+			callback(timestamp, rate);
+			curIndex = index;
+			isEmpty = false;
+		}
+	});
+}
+
+// ---- Trader::Downsampler::Buckets ------------------------------------------
+
+Trader::Downsampler::Buckets::Buckets(
+		const IrStd::Type::Timestamp fromTimestamp,
+		const IrStd::Type::Timestamp toTimestamp,
+		const size_t nbBuckets) noexcept
+		: m_fromTimestamp(static_cast<uint64_t>(fromTimestamp))
+		, m_scale(static_cast<double>(nbBuckets) / static_cast<double>(
+				std::max(static_cast<uint64_t>(fromTimestamp), static_cast<uint64_t>(toTimestamp))
+						- static_cast<uint64_t>(toTimestamp) + 1))
+		, m_nbBuckets(std::max(nbBuckets, static_cast<size_t>(1)))
+{
+}
+
+size_t Trader::Downsampler::Buckets::getIndex(const IrStd::Type::Timestamp timestamp) const noexcept
+{
+	const uint64_t t = static_cast<uint64_t>(timestamp);
+	if (t >= m_fromTimestamp)
+	{
+		return 0;
+	}
+	return std::min(static_cast<size_t>(static_cast<double>(m_fromTimestamp - t) * m_scale), m_nbBuckets - 1);
+}
+
+size_t Trader::Downsampler::Buckets::size() const noexcept
+{
+	return m_nbBuckets;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include "IrStd/IrStd.hpp"
+
+namespace Trader
+{
+	/**
+	 * Reduce a rate history to a bounded number of points.
+	 *
+	 * The range is split into buckets of equal duration and each bucket is
+	 * reduced while the history is read, so the memory used depends only on
+	 * the number of points requested. Points are expected and delivered from
+	 * the newest to the oldest, as read from a transaction.
+	 */
+	class Downsampler
+	{
+	public:
+		enum class Algorithm
+		{
+			/**
+			 * Largest-Triangle-Three-Buckets, keeps the visual shape of the
+			 * curve. It needs the average of the next bucket, the history is
+			 * therefore read twice.
+			 */
+			LTTB,
+			/**
+			 * Lowest and highest rates of each bucket
+			 */
+			MIN_MAX,
+			/**
+			 * Latest rate of each bucket
+			 */
+			LAST
+		};
+
+		typedef std::function<void(const IrStd::Type::Timestamp, const IrStd::Type::Decimal)> Callback;
+		/**
+		 * Read the history, calling the callback for each point
+		 */
+		typedef std::function<void(const Callback&)> Source;
+
+		static constexpr size_t MIN_POINTS = 3;
+		static constexpr size_t MAX_POINTS = 10000;
+
+		/**
+		 * Convert an algorithm name ("lttb", "minmax" or "last")
+		 */
+		static Algorithm fromString(const std::string& name);
+
+		/**
+		 * Downsample the points of \p source between \p fromTimestamp (the
+		 * newest) and \p toTimestamp (the oldest) to at most \p maxPoints,
+		 * clamped to [MIN_POINTS; MAX_POINTS].
+		 */
+		static void process(const Algorithm algorithm, const Source& source,
+				const IrStd::Type::Timestamp fromTimestamp, const IrStd::Type::Timestamp toTimestamp,
+				const size_t maxPoints, const Callback& callback);
+
+	private:
+		/**
+		 * Split a time range into buckets, bucket 0 holds the newest points
+		 */
+		class Buckets
+		{
+		public:
+			Buckets(const IrStd::Type::Timestamp fromTimestamp, const IrStd::Type::Timestamp toTimestamp,
+					const size_t nbBuckets) noexcept;
+			size_t getIndex(const IrStd::Type::Timestamp timestamp) const noexcept;
+			size_t size() const noexcept;
+
+		private:
+			const uint64_t m_fromTimestamp;
+			const double m_scale;
+			const size_t m_nbBuckets;
+		};
+
+		static void processLttb(const Source& source, const Buckets& buckets,
+				const size_t maxPoints, const Callback& callback);
+		static void processMinMax(const Source& source, const Buckets& buckets, const Callback& callback);
+		static void processLast(const Source& source, const Buckets& buckets, const Callback& callback);
+	};
+}
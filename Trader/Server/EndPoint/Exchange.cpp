@@ -1,9 +1,13 @@
 #include "Trader/Server/EndPoint/Exchange.hpp"
+#include "Trader/Generic/Json/JsonWriter.hpp"
+#include "Trader/Server/Response.hpp"
 #include "Trader/Generic/Event/Context.hpp"
 
 // ---- Trader::EndPoint::Exchange --------------------------------------------
 
-void Trader::EndPoint::Exchange::setup(IrStd::ServerREST& server)
+constexpr uint64_t Trader::EndPoint::Exchange::RATES_TIMEOUT_MS;
+
+void Trader::EndPoint::Exchange::setup(Dispatcher& server)
 {
 	setupList(server);
 	setupConfiguration(server);
@@ -16,27 +20,22 @@ void Trader::EndPoint::Exchange::setup(IrStd::ServerREST& server)
 	setupOrders(server);
 }
 
-void Trader::EndPoint::Exchange::setupList(IrStd::ServerREST& server)
+void Trader::EndPoint::Exchange::setupList(Dispatcher& server)
 {
 	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/exchange/list", [&](IrStd::ServerREST::Context& context) {
-		IrStd::Json json({
-			{"list", {}}
-		});
+		JsonWriter json(JsonWriter::getThreadBuffer());
+		json.beginObject().key("list").beginArray();
 		m_trader.eachExchanges([&](Trader::Exchange& exchange) {
-			const IrStd::Json jsonExchange({
-				{"name", exchange.getId().c_str()},
-				{"status", static_cast<size_t>(exchange.getStatus())},
-				{"timestamp", static_cast<uint64_t>(IrStd::Type::Timestamp::now())},
-				{"timestampServer", static_cast<uint64_t>(exchange.getServerTimestamp())},
-				{"timestampConnected", static_cast<uint64_t>(exchange.getConnectedTimestamp())}
-			});
-			json.getArray("list").add(json, jsonExchange);
+			json.beginObject();
+			writeInfo(json, exchange);
+			json.endObject();
 		});
-		context.getResponse().setData(json);
+		json.endArray().endObject();
+		Response::setJson(context, json.get());
 	});
 }
 
-void Trader::EndPoint::Exchange::setupConfiguration(IrStd::ServerREST& server)
+void Trader::EndPoint::Exchange::setupConfiguration(Dispatcher& server)
 {
 	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/exchange/{UINT}/configuration", [&](IrStd::ServerREST::Context& context) {
 		const size_t index = context.getMatchAsUInt(0);
@@ -46,121 +45,76 @@ void Trader::EndPoint::Exchange::setupConfiguration(IrStd::ServerREST& server)
 	});
 }
 
-void Trader::EndPoint::Exchange::setupBalance(IrStd::ServerREST& server)
+void Trader::EndPoint::Exchange::setupBalance(Dispatcher& server)
 {
 	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/exchange/{UINT}/balance", [&](IrStd::ServerREST::Context& context) {
 		const size_t index = context.getMatchAsUInt(0);
 		const auto& exchange = m_trader.getExchange(index);
 
-		{
-			IrStd::Json json;
+		// Estimates depend on the rates, the reserve is updated by the orders placed
+		m_cache.send(context, "balance/" + std::to_string(index), ResponseCache::makeVersion({
+				static_cast<uint64_t>(exchange.getConnectedTimestamp()),
+				static_cast<uint64_t>(exchange.getBalance().getVersion()),
+				static_cast<uint64_t>(exchange.getEventRates().getCounter())}), [&](JsonWriter& json) {
 			exchange.getBalance().toJson(json);
-			context.getResponse().setData(json);
-		}
+		});
 	});
 }
 
-void Trader::EndPoint::Exchange::setupInitialBalance(IrStd::ServerREST& server)
+void Trader::EndPoint::Exchange::setupInitialBalance(Dispatcher& server)
 {
 	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/exchange/{UINT}/initial/balance", [&](IrStd::ServerREST::Context& context) {
 		const size_t index = context.getMatchAsUInt(0);
 		const auto& exchange = m_trader.getExchange(index);
 
-		{
-			IrStd::Json json;
+		m_cache.send(context, "initial/balance/" + std::to_string(index), ResponseCache::makeVersion({
+				static_cast<uint64_t>(exchange.getConnectedTimestamp()),
+				static_cast<uint64_t>(exchange.getInitialBalance().getVersion()),
+				static_cast<uint64_t>(exchange.getEventRates().getCounter())}), [&](JsonWriter& json) {
 			exchange.getInitialBalance().toJson(json);
-			context.getResponse().setData(json);
-		}
+		});
 	});
 }
 
-void Trader::EndPoint::Exchange::setupActiveOrders(IrStd::ServerREST& server)
+void Trader::EndPoint::Exchange::setupActiveOrders(Dispatcher& server)
 {
 	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/exchange/{UINT}/orders/active", [&](IrStd::ServerREST::Context& context) {
 		const size_t index = context.getMatchAsUInt(0);
 		const auto& exchange = m_trader.getExchange(index);
 
 		{
-			IrStd::Json json({
-				{"list", {}}
-			});
-			exchange.getTrackOrderList().each([&](const TrackOrder& track) {
-				const IrStd::Json jsonOrder({
-					{"id", track.getId().c_str()},
-					{"orderType", track.getTypeToString()},
-					{"initialCurrency", track.getOrder().getInitialCurrency()->getId()},
-					{"finalCurrency", track.getOrder().getFirstOrderFinalCurrency()->getId()},
-					{"amount", track.getAmount()},
-					{"rate", track.getRate()},
-					{"context", ((track.getContext()) ? IrStd::Type::ShortString(track.getContext()->getId()).c_str() : "-")},
-					{"strategy", ((track.getContext()) ? track.getContext().cast<OperationContext>()->getStrategyId().c_str() : "-")},
-					{"timeout", IrStd::Type::ShortString(track.getOrder().getTimeout()).c_str()},
-					{"creationTime", track.getCreationTime()}
-				});
-				json.getArray("list").add(json, jsonOrder);
-			});
-			context.getResponse().setData(json);
+			JsonWriter json(JsonWriter::getThreadBuffer());
+			writeActiveOrders(json, exchange);
+			Response::setJson(context, json.get());
 		}
 	});
 }
 
-void Trader::EndPoint::Exchange::setupOrders(IrStd::ServerREST& server)
+void Trader::EndPoint::Exchange::setupOrders(Dispatcher& server)
 {
 	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/exchange/{UINT}/orders", [&](IrStd::ServerREST::Context& context) {
 		const size_t index = context.getMatchAsUInt(0);
 		const auto& exchange = m_trader.getExchange(index);
 
 		{
-			IrStd::Json json({
-				{"list", {}}
-			});
-			exchange.getTrackOrderList().getRecords(
-					[&](const IrStd::Type::Timestamp timestamp, const char* const pType,
-							const Id id, const char* const pOrderType, const CurrencyPtr initialCurrency,
-							const CurrencyPtr finalCurrency, const IrStd::Type::Decimal amount,
-							const IrStd::Type::Decimal rate, const size_t context,
-							const char* const pMessage, const Id strategyId) {
-						const IrStd::Json jsonOrder({
-							{"timestamp", timestamp},
-							{"type", pType},
-							{"id", id.c_str()},
-							{"orderType", pOrderType},
-							{"initialCurrency", initialCurrency->getId()},
-							{"finalCurrency", finalCurrency->getId()},
-							{"amount", amount},
-							{"rate", rate},
-							{"context", ((context) ? IrStd::Type::ShortString(context).c_str() : "-")},
-							{"message", pMessage},
-							{"strategy", strategyId.c_str()}
-						});
-						json.getArray("list").add(json, jsonOrder);
-				});
-			context.getResponse().setData(json);
+			JsonWriter json(JsonWriter::getThreadBuffer());
+			writeOrders(json, exchange);
+			Response::setJson(context, json.get());
 		}
 	});
 }
 
-void Trader::EndPoint::Exchange::setupRates(IrStd::ServerREST& server)
+void Trader::EndPoint::Exchange::setupRates(Dispatcher& server)
 {
 	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/exchange/{UINT}/rates", [&](IrStd::ServerREST::Context& context) {
 		const size_t index = context.getMatchAsUInt(0);
 		const auto& exchange = m_trader.getExchange(index);
 
-		{
-			IrStd::Json json({
-				{"list", {}}
-			});
-			exchange.getTransactionMap().getTransactions([&](const CurrencyPtr from, const CurrencyPtr to,
-					const PairTransactionMap::PairTransactionPointer pTransaction) {
-				const IrStd::Json jsonRate({
-						{"initialCurrency", from->getId()},
-						{"finalCurrency", to->getId()},
-						{"rate", pTransaction->getRate()}
-				});
-				json.getArray("list").add(json, jsonRate);
-			});
-			context.getResponse().setData(json);
-		}
+		m_cache.send(context, "rates/" + std::to_string(index), ResponseCache::makeVersion({
+				static_cast<uint64_t>(exchange.getConnectedTimestamp()),
+				static_cast<uint64_t>(exchange.getEventRates().getCounter())}), [&](JsonWriter& json) {
+			writeRates(json, exchange);
+		});
 	});
 
 	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/exchange/{UINT}/rates/{STRING}/{STRING}", [&](IrStd::ServerREST::Context& context) {
@@ -179,59 +133,84 @@ void Trader::EndPoint::Exchange::setupRates(IrStd::ServerREST& server)
 				<< currencies.second << ", is not available on this exchange");
 
 		{
-			IrStd::Json json({
-				{"list", {}}
-			});
+			JsonWriter json(JsonWriter::getThreadBuffer());
+			json.beginObject().key("list").beginArray();
 			const IrStd::Type::Timestamp curTimestamp = IrStd::Type::Timestamp::now();
 			pTransaction->getRates(curTimestamp, curTimestamp - IrStd::Type::Timestamp::min(15),
 					[&](const IrStd::Type::Timestamp t, const IrStd::Type::Decimal rate) {
-						const IrStd::Json jsonRate({
-							{"t", t},
-							{"r", rate}
-						});
-						json.getArray("list").add(json, jsonRate);
+						json.beginObject().member("t", t).member("r", rate).endObject();
 			});
-			context.getResponse().setData(json);
+			json.endArray().endObject();
+			Response::setJson(context, json.get());
 		}
 	});
 
 	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/exchange/{UINT}/rates/{STRING}/{STRING}/{UINT}/{UINT}", [&](IrStd::ServerREST::Context& context) {
-		const size_t index = context.getMatchAsUInt(0);
-		const std::string currencyInitial = context.getMatchAsString(1);
-		const std::string currencyFinal = context.getMatchAsString(2);
-		const auto currencies = Currency::tickerToCurrency(currencyInitial.c_str(), currencyFinal.c_str());
-		const auto& exchange = m_trader.getExchange(index);
-
-		IRSTD_THROW_ASSERT(currencies.first, "Unrecognized currencies " << currencyInitial
-				<< "and/or " << currencyFinal);
-
-		const auto pTransaction = exchange.getTransactionMap().getTransaction(currencies.first, currencies.second);
+		sendRates(context, /*maxPoints*/0, Downsampler::Algorithm::LTTB);
+	}, RATES_TIMEOUT_MS);
 
-		IRSTD_THROW_ASSERT(pTransaction, "This transaction pair " << currencyInitial << "/"
-				<< currencyFinal << ", is not available on this exchange");
+	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/exchange/{UINT}/rates/{STRING}/{STRING}/{UINT}/{UINT}/{UINT}", [&](IrStd::ServerREST::Context& context) {
+		sendRates(context, context.getMatchAsUInt(5), Downsampler::Algorithm::LTTB);
+	}, RATES_TIMEOUT_MS);
 
-		const IrStd::Type::Timestamp timestampFrom = context.getMatchAsUInt(3);
-		const IrStd::Type::Timestamp timestampTo = context.getMatchAsUInt(4);
-
-		{
-			IrStd::Json json({
-				{"list", {}}
-			});
-			pTransaction->getRates(timestampFrom, timestampTo,
-					[&](const IrStd::Type::Timestamp t, const IrStd::Type::Decimal rate) {
-						const IrStd::Json jsonRate({
-							{"t", t},
-							{"r", rate}
-						});
-						json.getArray("list").add(json, jsonRate);
-			});
-			context.getResponse().setData(json);
-		}
-	});
+	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/exchange/{UINT}/rates/{STRING}/{STRING}/{UINT}/{UINT}/{UINT}/{STRING}", [&](IrStd::ServerREST::Context& context) {
+		sendRates(context, context.getMatchAsUInt(5), Downsampler::fromString(context.getMatchAsString(6)));
+	}, RATES_TIMEOUT_MS);
 }
 
+void Trader::EndPoint::Exchange::sendRates(
+		IrStd::ServerREST::Context& context,
+		const size_t maxPoints,
+		const Downsampler::Algorithm algorithm)
+{
+	const size_t index = context.getMatchAsUInt(0);
+	const std::string currencyInitial = context.getMatchAsString(1);
+	const std::string currencyFinal = context.getMatchAsString(2);
+	const auto currencies = Currency::tickerToCurrency(currencyInitial.c_str(), currencyFinal.c_str());
+	const auto& exchange = m_trader.getExchange(index);
+
+	IRSTD_THROW_ASSERT(currencies.first, "Unrecognized currencies " << currencyInitial
+			<< "and/or " << currencyFinal);
+
+	const auto pTransaction = exchange.getTransactionMap().getTransaction(currencies.first, currencies.second);
+
+	IRSTD_THROW_ASSERT(pTransaction, "This transaction pair " << currencyInitial << "/"
+			<< currencyFinal << ", is not available on this exchange");
+
+	const IrStd::Type::Timestamp timestampFrom = context.getMatchAsUInt(3);
+	const IrStd::Type::Timestamp timestampTo = context.getMatchAsUInt(4);
+
+	JsonWriter json(JsonWriter::getThreadBuffer());
+	json.beginObject().key("list").beginArray();
+	const Downsampler::Callback write = [&](const IrStd::Type::Timestamp t, const IrStd::Type::Decimal rate) {
+		json.beginObject().member("t", t).member("r", rate).endObject();
+	};
+	const Downsampler::Source read = [&](const Downsampler::Callback& callback) {
+		// getRates() is noexcept, the remaining samples are skipped and the
+		// request is cancelled once it returns
+		bool isCancelled = false;
+		pTransaction->getRates(timestampFrom, timestampTo, [&](const IrStd::Type::Timestamp t, const IrStd::Type::Decimal rate) {
+			isCancelled = isCancelled || Dispatcher::isCancelled();
+			if (!isCancelled)
+			{
+				callback(t, rate);
+			}
+		});
+		Dispatcher::checkCancelled();
+	};
+	if (maxPoints)
+	{
+		Downsampler::process(algorithm, read, timestampFrom, timestampTo, maxPoints, write);
+	}
+	else
+	{
+		read(write);
+	}
+	json.endArray().endObject();
+	Response::setJson(context, json.get());
+}
 
-void Trader::EndPoint::Exchange::setupCurrencies(IrStd::ServerREST& server)
+void Trader::EndPoint::Exchange::setupCurrencies(Dispatcher& server)
 {
 	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/exchange/{UINT}/currencies", [&](IrStd::ServerREST::Context& context) {
 		{
@@ -243,46 +222,130 @@ void Trader::EndPoint::Exchange::setupCurrencies(IrStd::ServerREST& server)
 	});
 }
 
-void Trader::EndPoint::Exchange::setupTransactions(IrStd::ServerREST& server)
+void Trader::EndPoint::Exchange::setupTransactions(Dispatcher& server)
 {
 	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/exchange/{UINT}/transactions", [&](IrStd::ServerREST::Context& context) {
 		const size_t index = context.getMatchAsUInt(0);
 		const auto& exchange = m_trader.getExchange(index);
 
+		m_cache.send(context, "transactions/" + std::to_string(index), ResponseCache::makeVersion({
+				static_cast<uint64_t>(exchange.getConnectedTimestamp()),
+				static_cast<uint64_t>(exchange.getEventProperties().getCounter())}), [&](JsonWriter& json) {
+			writeTransactions(json, exchange);
+		});
+	});
+}
+
+// ---- Trader::EndPoint::Exchange (writers) ----------------------------------
+
+void Trader::EndPoint::Exchange::writeInfo(
+		JsonWriter& json,
+		const Trader::Exchange& exchange)
+{
+	json.member("name", exchange.getId().c_str())
+			.member("status", static_cast<uint64_t>(exchange.getStatus()))
+			.member("timestamp", IrStd::Type::Timestamp::now())
+			.member("timestampServer", exchange.getServerTimestamp())
+			.member("timestampConnected", exchange.getConnectedTimestamp());
+}
+
+void Trader::EndPoint::Exchange::writeRates(
+		JsonWriter& json,
+		const Trader::Exchange& exchange)
+{
+	json.beginObject().key("list").beginArray();
+	exchange.getTransactionMap().getTransactions([&](const CurrencyPtr from, const CurrencyPtr to,
+			const PairTransactionMap::PairTransactionPointer pTransaction) {
+		json.beginObject()
+				.member("initialCurrency", from->getId())
+				.member("finalCurrency", to->getId())
+				.member("rate", pTransaction->getRate())
+				.endObject();
+	});
+	json.endArray().endObject();
+}
+
+void Trader::EndPoint::Exchange::writeTransactions(
+		JsonWriter& json,
+		const Trader::Exchange& exchange)
+{
+	json.beginObject().key("list").beginArray();
+	exchange.getTransactionMap().getTransactions([&](const CurrencyPtr from, const CurrencyPtr to, const PairTransactionMap::PairTransactionPointer pTransaction) {
+		const auto decimal = pTransaction->getDecimalPlace();
+		const auto decimalOrder = pTransaction->getOrderDecimalPlace();
+		// Compute the fee
+		std::string fee;
 		{
-			IrStd::Json json({
-				{"list", {}}
-			});
-			exchange.getTransactionMap().getTransactions([&](const CurrencyPtr from, const CurrencyPtr to, const PairTransactionMap::PairTransactionPointer pTransaction) {
-				const auto decimal = pTransaction->getDecimalPlace();
-				const auto decimalOrder = pTransaction->getOrderDecimalPlace();
-				// Compute the fee
-				std::string fee;
-				{
-					const auto feeFixed = pTransaction->getFeeFixed();
-					const auto feePercent = pTransaction->getFeePercent();
-					fee.assign(IrStd::Type::ShortString(feeFixed));
-					fee.append(" + ");
-					fee.append(IrStd::Type::ShortString(feePercent));
-					fee.append("%");
-				}
-
-				// Compute the boundaries
-				std::stringstream boundariesStream;
-				pTransaction->getBoundaries().toStream(boundariesStream);
-
-				const IrStd::Json jsonTransaction({
-					{"initialCurrency", from->getId()},
-					{"finalCurrency", to->getId()},
-					{"decimal", (decimal == 14) ? "-" : IrStd::Type::ShortString(decimal).c_str()},
-					{"decimalOrder", (decimalOrder == 14) ? "-" : IrStd::Type::ShortString(decimalOrder).c_str()},
-					{"fee", fee},
-					{"boundaries", boundariesStream.str()}
-
-				});
-				json.getArray("list").add(json, jsonTransaction);
-			});
-			context.getResponse().setData(json);
+			const auto feeFixed = pTransaction->getFeeFixed();
+			const auto feePercent = pTransaction->getFeePercent();
+			fee.assign(IrStd::Type::ShortString(feeFixed));
+			fee.append(" + ");
+			fee.append(IrStd::Type::ShortString(feePercent));
+			fee.append("%");
 		}
+
+		// Compute the boundaries
+		std::stringstream boundariesStream;
+		pTransaction->getBoundaries().toStream(boundariesStream);
+
+		json.beginObject()
+				.member("initialCurrency", from->getId())
+				.member("finalCurrency", to->getId())
+				.member("decimal", (decimal == 14) ? "-" : IrStd::Type::ShortString(decimal).c_str())
+				.member("decimalOrder", (decimalOrder == 14) ? "-" : IrStd::Type::ShortString(decimalOrder).c_str())
+				.member("fee", fee)
+				.member("boundaries", boundariesStream.str())
+				.endObject();
+	});
+	json.endArray().endObject();
+}
+
+void Trader::EndPoint::Exchange::writeActiveOrders(
+		JsonWriter& json,
+		const Trader::Exchange& exchange)
+{
+	json.beginObject().key("list").beginArray();
+	exchange.getTrackOrderList().each([&](const TrackOrder& track) {
+		json.beginObject()
+				.member("id", track.getId().c_str())
+				.member("orderType", track.getTypeToString())
+				.member("initialCurrency", track.getOrder().getInitialCurrency()->getId())
+				.member("finalCurrency", track.getOrder().getFirstOrderFinalCurrency()->getId())
+				.member("amount", track.getAmount())
+				.member("rate", track.getRate())
+				.member("context", ((track.getContext()) ? IrStd::Type::ShortString(track.getContext()->getId()).c_str() : "-"))
+				.member("strategy", ((track.getContext()) ? track.getContext().cast<OperationContext>()->getStrategyId().c_str() : "-"))
+				.member("timeout", IrStd::Type::ShortString(track.getOrder().getTimeout()).c_str())
+				.member("creationTime", track.getCreationTime())
+				.endObject();
 	});
+	json.endArray().endObject();
+}
+
+void Trader::EndPoint::Exchange::writeOrders(
+		JsonWriter& json,
+		const Trader::Exchange& exchange)
+{
+	json.beginObject().key("list").beginArray();
+	exchange.getTrackOrderList().getRecords(
+			[&](const IrStd::Type::Timestamp timestamp, const char* const pType,
+					const Id id, const char* const pOrderType, const CurrencyPtr initialCurrency,
+					const CurrencyPtr finalCurrency, const IrStd::Type::Decimal amount,
+					const IrStd::Type::Decimal rate, const size_t context,
+					const char* const pMessage, const Id strategyId) {
+				json.beginObject()
+						.member("timestamp", timestamp)
+						.member("type", pType)
+						.member("id", id.c_str())
+						.member("orderType", pOrderType)
+						.member("initialCurrency", initialCurrency->getId())
+						.member("finalCurrency", finalCurrency->getId())
+						.member("amount", amount)
+						.member("rate", rate)
+						.member("context", ((context) ? IrStd::Type::ShortString(context).c_str() : "-"))
+						.member("message", pMessage)
+						.member("strategy", strategyId.c_str())
+						.endObject();
+		});
+	json.endArray().endObject();
 }
@@ -3,6 +3,10 @@
 #include "IrStd/IrStd.hpp"
 
 #include "Trader/Manager/Manager.hpp"
+#include "Trader/Server/Dispatcher.hpp"
+#include "Trader/Generic/Json/JsonWriter.hpp"
+#include "Trader/Server/ResponseCache.hpp"
+#include "Trader/Server/Downsampler.hpp"
 
 namespace Trader
 {
@@ -11,12 +15,17 @@ namespace Trader
 		class Exchange
 		{
 		public:
+			/**
+			 * Deadline of the rate history requests, which may read a large range
+			 */
+			static constexpr uint64_t RATES_TIMEOUT_MS = 30000;
+
 			Exchange(Trader::Manager& trader)
 					: m_trader(trader)
 			{
 			}
 
-			void setup(IrStd::ServerREST& server);
+			void setup(Dispatcher& server);
 
 			/**
 			 * \brief Get information about the exchanges
@@ -32,7 +41,7 @@ namespace Trader
 			 *     ]
 			 * }
 			 */
-			void setupList(IrStd::ServerREST& server);
+			void setupList(Dispatcher& server);
 
 			/**
 			 * \brief Get configuration of a specific exchange
@@ -43,7 +52,7 @@ namespace Trader
 			 *     // List of parameters
 			 * }
 			 */
-			void setupConfiguration(IrStd::ServerREST& server);
+			void setupConfiguration(Dispatcher& server);
 
 			/**
 			 * \brief Get the balance of a specific exchange
@@ -54,7 +63,7 @@ namespace Trader
 			 *     // List of currency and their amount
 			 * }
 			 */
-			void setupBalance(IrStd::ServerREST& server);
+			void setupBalance(Dispatcher& server);
 
 			/**
 			 * \brief Get the initial balance of a specific exchange
@@ -65,19 +74,23 @@ namespace Trader
 			 *     // List of currency and their amount
 			 * }
 			 */
-			void setupInitialBalance(IrStd::ServerREST& server);
+			void setupInitialBalance(Dispatcher& server);
 
 			/**
 			 * \brief Get the latest 1 min rates for a specific pair of a specific exchange
 			 *
 			 * Endpoint: GET /api/v1/exchange/{UINT}/rates/{STRING}/{STRING}
 			 * or        GET /api/v1/exchange/{UINT}/rates/{STRING}/{STRING}/{UINT}/{UINT}
+			 * or        GET /api/v1/exchange/{UINT}/rates/{STRING}/{STRING}/{UINT}/{UINT}/{UINT}[/{STRING}]
+			 *
+			 * The last form returns at most maxPoints rates between the 2 timestamps,
+			 * downsampled with "lttb" (default), "minmax" or "last".
 			 * Response: json
 			 * {
 			 *     // Rates and timestamps
 			 * }
 			 */
-			void setupRates(IrStd::ServerREST& server);
+			void setupRates(Dispatcher& server);
 
 			/**
 			 * \brief Get the list of currencies supported by the exchange
@@ -88,7 +101,7 @@ namespace Trader
 			 *     // Rates and timestamps
 			 * }
 			 */
-			void setupCurrencies(IrStd::ServerREST& server);
+			void setupCurrencies(Dispatcher& server);
 
 			/**
 			 * \brief Get the list of transactions supported by the exchange
@@ -99,14 +112,14 @@ namespace Trader
 			 *     // Rates and timestamps
 			 * }
 			 */
-			void setupTransactions(IrStd::ServerREST& server);
+			void setupTransactions(Dispatcher& server);
 
 			/**
 			 * \brief Get the list of active orders
 			 *
 			 * Endpoint: GET /api/v1/exchange/{UINT}/orders/active
 			 */
-			void setupActiveOrders(IrStd::ServerREST& server);
+			void setupActiveOrders(Dispatcher& server);
 
 			/**
 			 * \brief Get the list of the last orders
@@ -117,10 +130,27 @@ namespace Trader
 			 *     // Orders
 			 * }
 			 */
-			void setupOrders(IrStd::ServerREST& server);
+			void setupOrders(Dispatcher& server);
+
+			/**
+			 * Writers shared with the snapshot endpoint. writeInfo() writes the
+			 * members of the current object, the others write a complete object.
+			 */
+			static void writeInfo(JsonWriter& json, const Trader::Exchange& exchange);
+			static void writeRates(JsonWriter& json, const Trader::Exchange& exchange);
+			static void writeTransactions(JsonWriter& json, const Trader::Exchange& exchange);
+			static void writeActiveOrders(JsonWriter& json, const Trader::Exchange& exchange);
+			static void writeOrders(JsonWriter& json, const Trader::Exchange& exchange);
 
 		private:
+			/**
+			 * Send the rates of the pair and range matched, downsampled if \p maxPoints is set
+			 */
+			void sendRates(IrStd::ServerREST::Context& context, const size_t maxPoints,
+					const Downsampler::Algorithm algorithm);
+
 			Trader::Manager& m_trader;
+			ResponseCache m_cache;
 		};
 	}
 }
@@ -1,10 +1,11 @@
 #include "Trader/Server/EndPoint/Manager.hpp"
+#include "Trader/Generic/Metrics/Metrics.hpp"
 
 // ---- Trader::EndPoint::Manager ---------------------------------------------
 
-void Trader::EndPoint::Manager::setup(IrStd::ServerREST& server)
+void Trader::EndPoint::Manager::setup(Dispatcher& server)
 {
-	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/manager", [&](IrStd::ServerREST::Context& context) {
+	server.addMonitoringRoute(IrStd::HTTPMethod::GET, "/api/v1/manager", [&](IrStd::ServerREST::Context& context) {
 		IrStd::Json json({
 			{"version", IrStd::Main::getInstance().getVersion()},
 			{"time", IrStd::Type::Timestamp::now()},
@@ -24,11 +25,12 @@ void Trader::EndPoint::Manager::setup(IrStd::ServerREST& server)
 	// Add other endpoints
 	setupTraces(server);
 	setupThreads(server);
+	setupMetrics(server);
 }
 
-void Trader::EndPoint::Manager::setupTraces(IrStd::ServerREST& server)
+void Trader::EndPoint::Manager::setupTraces(Dispatcher& server)
 {
-	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/manager/traces", [&](IrStd::ServerREST::Context& context) {
+	server.addMonitoringRoute(IrStd::HTTPMethod::GET, "/api/v1/manager/traces", [&](IrStd::ServerREST::Context& context) {
 		IrStd::Json json({{"list", {}}});
 		m_trader.getTraces().read([&](const IrStd::Type::Timestamp timestamp, const Trader::ManagerTrace::TraceInfo& info) {
 			const char level[2] = {IrStd::Logger::levelToChar(info.m_level), '\0'};
@@ -45,9 +47,9 @@ void Trader::EndPoint::Manager::setupTraces(IrStd::ServerREST& server)
 	});
 }
 
-void Trader::EndPoint::Manager::setupThreads(IrStd::ServerREST& server)
+void Trader::EndPoint::Manager::setupThreads(Dispatcher& server)
 {
-	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/manager/threads", [&](IrStd::ServerREST::Context& context) {
+	server.addMonitoringRoute(IrStd::HTTPMethod::GET, "/api/v1/manager/threads", [&](IrStd::ServerREST::Context& context) {
 		IrStd::Json json({{"list", {}}});
 		 IrStd::Threads::each([&](const IrStd::Thread& thread) {
 			const IrStd::Json jsonThread({
@@ -59,3 +61,13 @@ void Trader::EndPoint::Manager::setupThreads(IrStd::ServerREST& server)
 		context.getResponse().setData(json);
 	});
 }
+
+void Trader::EndPoint::Manager::setupMetrics(Dispatcher& server)
+{
+	server.addMonitoringRoute(IrStd::HTTPMethod::GET, "/metrics", [&](IrStd::ServerREST::Context& context) {
+		std::string text;
+		Metrics::getDefault().toText(text);
+		context.getResponse().addHeader("Content-Type", "text/plain; version=0.0.4");
+		context.getResponse().setData(text.c_str(), text.size());
+	});
+}
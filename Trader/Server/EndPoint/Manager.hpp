@@ -3,6 +3,7 @@
 #include "IrStd/IrStd.hpp"
 
 #include "Trader/Manager/Manager.hpp"
+#include "Trader/Server/Dispatcher.hpp"
 
 namespace Trader
 {
@@ -16,21 +17,28 @@ namespace Trader
 			{
 			}
 
-			void setup(IrStd::ServerREST& server);
+			void setup(Dispatcher& server);
 
 			/**
 			 * \brief Get traces of warning or higher level
 			 *
 			 * Endpoint: GET /api/v1/manager/traces
 			 */
-			void setupTraces(IrStd::ServerREST& server);
+			void setupTraces(Dispatcher& server);
 
 			/**
 			 * \brief Get infromation about running threads
 			 *
 			 * Endpoint: GET /api/v1/manager/threads
 			 */
-			void setupThreads(IrStd::ServerREST& server);
+			void setupThreads(Dispatcher& server);
+
+			/**
+			 * \brief Get the metrics of the engine in the Prometheus text format
+			 *
+			 * Endpoint: GET /metrics
+			 */
+			void setupMetrics(Dispatcher& server);
 
 		private:
 			Trader::Manager& m_trader;
@@ -0,0 +1,290 @@
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <thread>
+
+#include "Trader/Server/EndPoint/Push.hpp"
+#include "Trader/Server/Response.hpp"
+#include "Trader/Generic/Json/JsonWriter.hpp"
+#include "Trader/Generic/Event/Context.hpp"
+
+IRSTD_TOPIC_USE_ALIAS(TraderServer, Trader, Server);
+
+namespace
+{
+	std::vector<std::string> split(const std::string& str, const char separator)
+	{
+		std::vector<std::string> list;
+		std::stringstream stream(str);
+		std::string item;
+		while (std::getline(stream, item, separator))
+		{
+			if (!item.empty())
+			{
+				list.push_back(item);
+			}
+		}
+		return list;
+	}
+
+	/**
+	 * Split an exchange topic "{UINT}.{STRING}" into its exchange index and name
+	 */
+	bool splitExchangeTopic(const std::string& topic, size_t& index, std::string& name)
+	{
+		index = 0;
+		size_t position = 0;
+		for (; position < topic.size() && topic[position] >= '0' && topic[position] <= '9'; ++position)
+		{
+			index = index * 10 + (topic[position] - '0');
+		}
+		if (!position || position == topic.size() || topic[position] != '.')
+		{
+			return false;
+		}
+		name.assign(topic, position + 1, std::string::npos);
+		return true;
+	}
+}
+
+// ---- Trader::EndPoint::Push ------------------------------------------------
+
+constexpr uint64_t Trader::EndPoint::Push::MIN_PUBLISH_PERIOD_MS;
+constexpr uint64_t Trader::EndPoint::Push::LONG_POLL_TIMEOUT_MS;
+
+Trader::EndPoint::Push::Push(Trader::Manager& trader)
+		: m_trader(trader)
+{
+}
+
+void Trader::EndPoint::Push::setup(Dispatcher& server)
+{
+	m_trader.eachExchanges([&](Trader::Exchange& /*exchange*/) {
+		m_exchangePublicationList.emplace_back(new Publication());
+	});
+
+	setupPoll(server);
+}
+
+void Trader::EndPoint::Push::setupPoll(Dispatcher& server)
+{
+	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/push/{UINT}/{STRING}", [&](IrStd::ServerREST::Context& context) {
+		const PushChannel::Sequence cursor = context.getMatchAsUInt(0);
+		const auto topicList = split(context.getMatchAsString(1), ',');
+		publish(topicList);
+		waitForChanges(cursor, topicList);
+		// The push server listens on its own port
+		context.getResponse().addHeader("Access-Control-Allow-Origin", "*");
+		Response::setJson(context, m_channel.poll(cursor, topicList));
+	});
+}
+
+void Trader::EndPoint::Push::waitForChanges(
+		const PushChannel::Sequence cursor,
+		const std::vector<std::string>& topicList)
+{
+	// Events of the subscribed exchange topics, the traces have none and are published every period
+	std::vector<const IrStd::Event*> eventList;
+	bool isTraces = false;
+	for (const auto& topic : topicList)
+	{
+		size_t index;
+		std::string name;
+		if (topic == "traces")
+		{
+			isTraces = true;
+		}
+		else if (splitExchangeTopic(topic, index, name) && index < m_exchangePublicationList.size())
+		{
+			const auto& exchange = m_trader.getExchange(index);
+			const IrStd::Event* const pEvent = (name == "rates") ? &exchange.getEventRates()
+					: (name == "balance") ? &exchange.getEventBalance()
+					: (name == "orders") ? &exchange.getEventOrders() : nullptr;
+			if (pEvent && std::find(eventList.begin(), eventList.end(), pEvent) == eventList.end())
+			{
+				eventList.push_back(pEvent);
+			}
+		}
+	}
+
+	std::vector<uint64_t> counterList;
+	for (const auto pEvent : eventList)
+	{
+		counterList.push_back(static_cast<uint64_t>(pEvent->getCounter()));
+	}
+
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(LONG_POLL_TIMEOUT_MS);
+	bool isPending = false;
+	while (!m_channel.isModified(cursor, topicList))
+	{
+		const auto remainingMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+				deadline - std::chrono::steady_clock::now()).count();
+		if (remainingMs <= 0)
+		{
+			break;
+		}
+		const uint64_t periodMs = std::min(MIN_PUBLISH_PERIOD_MS, static_cast<uint64_t>(remainingMs));
+
+		// Only the first event is waited on, the others are checked every period
+		if (isPending || eventList.empty())
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(periodMs));
+		}
+		else
+		{
+			eventList.front()->waitForAtLeast(counterList.front() + 1, periodMs);
+		}
+
+		for (size_t i = 0; i < eventList.size(); ++i)
+		{
+			const uint64_t counter = static_cast<uint64_t>(eventList[i]->getCounter());
+			isPending |= (counter != counterList[i]);
+			counterList[i] = counter;
+		}
+
+		// A publication skipped because too recent is retried the next period
+		if (isPending || isTraces)
+		{
+			isPending = !publish(topicList);
+		}
+	}
+}
+
+// ---- Trader::EndPoint::Push (publishers) -----------------------------------
+
+bool Trader::EndPoint::Push::publish(const std::vector<std::string>& topicList)
+{
+	bool isComplete = true;
+	for (const auto& topic : topicList)
+	{
+		if (topic == "traces")
+		{
+			isComplete &= publishIfOutdated(m_tracesPublication, [&]() {
+				publishTraces();
+			});
+			continue;
+		}
+
+		// Exchange topics are prefixed with the index of the exchange, unknown topics are ignored
+		size_t index;
+		std::string name;
+		if (!splitExchangeTopic(topic, index, name) || index >= m_exchangePublicationList.size())
+		{
+			continue;
+		}
+		isComplete &= publishIfOutdated(*m_exchangePublicationList[index], [&]() {
+			const auto& exchange = m_trader.getExchange(index);
+			try
+			{
+				publishExchange(index, exchange);
+			}
+			catch (const IrStd::Exception& e)
+			{
+				IRSTD_LOG_ERROR(TraderServer, "Cannot publish the data of " << exchange.getId() << ": " << e);
+			}
+		});
+	}
+	return isComplete;
+}
+
+bool Trader::EndPoint::Push::publishIfOutdated(
+		Publication& publication,
+		const std::function<void()>& callback)
+{
+	// Concurrent polls wait for the publication in progress and use it
+	std::lock_guard<std::mutex> lock(publication.m_lock);
+	const uint64_t timestampMs = static_cast<uint64_t>(m_trader.getClock().now());
+	if (publication.m_timestampMs && timestampMs < publication.m_timestampMs + MIN_PUBLISH_PERIOD_MS)
+	{
+		return false;
+	}
+	callback();
+	publication.m_timestampMs = timestampMs;
+	return true;
+}
+
+void Trader::EndPoint::Push::publishExchange(
+		const size_t index,
+		const Trader::Exchange& exchange)
+{
+	const std::string prefix = std::to_string(index) + ".";
+
+	{
+		PushChannel::Values values;
+		exchange.getTransactionMap().getTransactions([&](const CurrencyPtr from, const CurrencyPtr to,
+				const PairTransactionMap::PairTransactionPointer pTransaction) {
+			const std::string key = std::string(from->getId()) + "/" + to->getId();
+			JsonWriter(values[key]).beginObject()
+					.member("initialCurrency", from->getId())
+					.member("finalCurrency", to->getId())
+					.member("rate", pTransaction->getRate())
+					.endObject();
+		});
+		m_channel.publish(prefix + "rates", values);
+	}
+
+	// Same layout as Balance::toJson
+	{
+		PushChannel::Values values;
+		const auto& balance = exchange.getBalance();
+		IrStd::Type::Decimal totalEstimate = 0;
+		balance.getCurrencies([&](const CurrencyPtr currency) {
+			const auto amount = balance.get(currency);
+			const auto estimate = balance.estimate(currency, amount, &exchange);
+			JsonWriter json(values[currency->getId()]);
+			json.beginObject()
+					.member("amount", amount)
+					.member("reserve", balance.getWithReserve(currency) - amount);
+			if (estimate != Trader::Balance::INVALID_AMOUNT)
+			{
+				json.member("estimate", estimate);
+				totalEstimate += estimate;
+			}
+			json.endObject();
+		});
+		JsonWriter(values["total"]).beginObject()
+				.member("estimate", totalEstimate)
+				.member("initial", balance.getInitialEstimate())
+				.endObject();
+		values["estimate"] = PushChannel::toJson(exchange.getEstimateCurrency()->getId());
+		m_channel.publish(prefix + "balance", values);
+	}
+
+	// Same layout as EndPoint::Exchange::writeActiveOrders
+	{
+		PushChannel::Values values;
+		exchange.getTrackOrderList().each([&](const TrackOrder& track) {
+			JsonWriter(values[track.getId().c_str()]).beginObject()
+					.member("id", track.getId().c_str())
+					.member("orderType", track.getTypeToString())
+					.member("initialCurrency", track.getOrder().getInitialCurrency()->getId())
+					.member("finalCurrency", track.getOrder().getFirstOrderFinalCurrency()->getId())
+					.member("amount", track.getAmount())
+					.member("rate", track.getRate())
+					.member("context", ((track.getContext()) ? IrStd::Type::ShortString(track.getContext()->getId()).c_str() : "-"))
+					.member("strategy", ((track.getContext()) ? track.getContext().cast<OperationContext>()->getStrategyId().c_str() : "-"))
+					.member("timeout", IrStd::Type::ShortString(track.getOrder().getTimeout()).c_str())
+					.member("creationTime", track.getCreationTime())
+					.endObject();
+		});
+		m_channel.publish(prefix + "orders", values);
+	}
+}
+
+void Trader::EndPoint::Push::publishTraces()
+{
+	PushChannel::Values values;
+	m_trader.getTraces().read([&](const IrStd::Type::Timestamp timestamp, const Trader::ManagerTrace::TraceInfo& info) {
+		// Traces with the same timestamp are differentiated by their topic and message
+		const std::string key = std::to_string(static_cast<uint64_t>(timestamp)) + ":" + info.m_pTopic->getStr()
+				+ ":" + info.m_message;
+		const char level[2] = {IrStd::Logger::levelToChar(info.m_level), '\0'};
+		JsonWriter(values[key]).beginObject()
+				.member("timestamp", timestamp)
+				.member("level", level)
+				.member("topic", info.m_pTopic->getStr())
+				.member("message", info.m_message)
+				.endObject();
+	});
+	m_channel.publish("traces", values);
+}
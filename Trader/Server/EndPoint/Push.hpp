@@ -0,0 +1,100 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "IrStd/IrStd.hpp"
+
+#include "Trader/Manager/Manager.hpp"
+#include "Trader/Server/Dispatcher.hpp"
+#include "Trader/Server/PushChannel.hpp"
+
+namespace Trader
+{
+	namespace EndPoint
+	{
+		class Push
+		{
+		public:
+			/**
+			 * Minimal time between 2 publications of the same exchange or of the traces,
+			 * the clients polling in between receive the previous publication
+			 */
+			static constexpr uint64_t MIN_PUBLISH_PERIOD_MS = 100;
+
+			/**
+			 * Maximum time a poll is held when there is nothing new to send
+			 */
+			static constexpr uint64_t LONG_POLL_TIMEOUT_MS = 5000;
+
+			Push(Trader::Manager& trader);
+
+			void setup(Dispatcher& server);
+
+			/**
+			 * \brief Get the changes on the subscribed topics since the last poll
+			 *
+			 * The topics are separated with commas, the available topics are:
+			 * "{UINT}.rates", "{UINT}.balance", "{UINT}.orders" for a specific
+			 * exchange and "traces". The cursor is the one returned by the previous
+			 * poll, 0 to receive the whole content.
+			 * The data is only serialized when a client polls a topic.
+			 * If nothing changed since the cursor, the request is held until the
+			 * rates, balance or orders event of a subscribed exchange triggers, or
+			 * for at most LONG_POLL_TIMEOUT_MS. It should be served by a dedicated
+			 * server, as it blocks the thread of its server while held.
+			 *
+			 * Endpoint: GET /api/v1/push/{UINT}/{STRING}
+			 * Response: json
+			 * {
+			 *     cursor: 12,     // cursor for the next poll
+			 *     reset: false,   // true if the whole content is sent
+			 *     topics: {
+			 *         "0.rates": {
+			 *             "BTC/USD": {initialCurrency: "BTC", finalCurrency: "USD", rate: 6512.3},
+			 *             "ETH/USD": null   // removed entry
+			 *         }
+			 *     }
+			 * }
+			 */
+			void setupPoll(Dispatcher& server);
+
+		private:
+			/**
+			 * Time of the last publication of a group of topics
+			 */
+			struct Publication
+			{
+				Publication()
+						: m_timestampMs(0)
+				{
+				}
+
+				std::mutex m_lock;
+				uint64_t m_timestampMs;
+			};
+
+			/**
+			 * Publish the topics requested, unless they have been published recently.
+			 * Return false if some of them were skipped for this reason.
+			 */
+			bool publish(const std::vector<std::string>& topicList);
+			bool publishIfOutdated(Publication& publication, const std::function<void()>& callback);
+
+			/**
+			 * Wait until the topics changed since \p cursor, publishing them each time
+			 * the corresponding exchange events trigger
+			 */
+			void waitForChanges(const PushChannel::Sequence cursor, const std::vector<std::string>& topicList);
+			void publishExchange(const size_t index, const Trader::Exchange& exchange);
+			void publishTraces();
+
+			Trader::Manager& m_trader;
+			PushChannel m_channel;
+			std::vector<std::unique_ptr<Publication>> m_exchangePublicationList;
+			Publication m_tracesPublication;
+		};
+	}
+}
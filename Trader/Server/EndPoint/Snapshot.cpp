@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <sstream>
+
+#include "Trader/Server/EndPoint/Snapshot.hpp"
+#include "Trader/Server/EndPoint/Exchange.hpp"
+#include "Trader/Server/Response.hpp"
+#include "Trader/Generic/Json/JsonWriter.hpp"
+
+IRSTD_TOPIC_USE_ALIAS(TraderServer, Trader, Server);
+
+// ---- Trader::EndPoint::Snapshot --------------------------------------------
+
+void Trader::EndPoint::Snapshot::setup(Dispatcher& server)
+{
+	setupSnapshot(server);
+}
+
+void Trader::EndPoint::Snapshot::setupSnapshot(Dispatcher& server)
+{
+	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/snapshot", [&](IrStd::ServerREST::Context& context) {
+		sendSnapshot(context, Field::ALL);
+	});
+
+	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/snapshot/{STRING}", [&](IrStd::ServerREST::Context& context) {
+		sendSnapshot(context, fromString(context.getMatchAsString(0)));
+	});
+
+	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/snapshot/{UINT}/{STRING}", [&](IrStd::ServerREST::Context& context) {
+		const size_t index = context.getMatchAsUInt(0);
+		sendSnapshot(context, fromString(context.getMatchAsString(1)), &m_trader.getExchange(index));
+	});
+}
+
+uint32_t Trader::EndPoint::Snapshot::fromString(const std::string& fields)
+{
+	static const std::pair<const char*, Field> fieldList[] = {
+		{"balance", Field::BALANCE},
+		{"initialBalance", Field::INITIAL_BALANCE},
+		{"rates", Field::RATES},
+		{"transactions", Field::TRANSACTIONS},
+		{"activeOrders", Field::ACTIVE_ORDERS},
+		{"orders", Field::ORDERS},
+		{"profit", Field::PROFIT}
+	};
+
+	uint32_t mask = 0;
+	std::stringstream stream(fields);
+	std::string name;
+	while (std::getline(stream, name, ','))
+	{
+		if (name.empty())
+		{
+			continue;
+		}
+		const auto it = std::find_if(std::begin(fieldList), std::end(fieldList),
+				[&](const std::pair<const char*, Field>& field) { return name == field.first; });
+		IRSTD_THROW_ASSERT(TraderServer, it != std::end(fieldList), "Unknown snapshot field '" << name << "'");
+		mask |= it->second;
+	}
+	return (mask) ? mask : static_cast<uint32_t>(Field::ALL);
+}
+
+void Trader::EndPoint::Snapshot::sendSnapshot(
+		IrStd::ServerREST::Context& context,
+		const uint32_t fields,
+		const Trader::Exchange* const pExchange)
+{
+	JsonWriter json(JsonWriter::getThreadBuffer());
+	json.beginObject().member("timestamp", IrStd::Type::Timestamp::now());
+
+	json.key("exchanges").beginArray();
+	const auto writeExchange = [&](const Trader::Exchange& exchange) {
+		Dispatcher::checkCancelled();
+		json.beginObject();
+		Exchange::writeInfo(json, exchange);
+		if (fields & Field::BALANCE)
+		{
+			json.key("balance");
+			exchange.getBalance().toJson(json);
+		}
+		if (fields & Field::INITIAL_BALANCE)
+		{
+			json.key("initialBalance");
+			exchange.getInitialBalance().toJson(json);
+		}
+		if (fields & Field::RATES)
+		{
+			json.key("rates");
+			Exchange::writeRates(json, exchange);
+		}
+		if (fields & Field::TRANSACTIONS)
+		{
+			json.key("transactions");
+			Exchange::writeTransactions(json, exchange);
+		}
+		if (fields & Field::ACTIVE_ORDERS)
+		{
+			json.key("activeOrders");
+			Exchange::writeActiveOrders(json, exchange);
+		}
+		if (fields & Field::ORDERS)
+		{
+			json.key("orders");
+			Exchange::writeOrders(json, exchange);
+		}
+		json.endObject();
+	};
+	if (pExchange)
+	{
+		writeExchange(*pExchange);
+	}
+	else
+	{
+		m_trader.eachExchanges([&](Trader::Exchange& exchange) {
+			writeExchange(exchange);
+		});
+	}
+	json.endArray();
+
+	json.key("strategies").beginArray();
+	m_trader.eachStrategies([&](Trader::Strategy& strategy) {
+		json.beginObject()
+				.member("name", strategy.getId().c_str())
+				.member("type", strategy.getType().c_str());
+		if (fields & Field::PROFIT)
+		{
+			json.key("profit");
+			strategy.getProfitInJson(json);
+		}
+		json.endObject();
+	});
+	json.endArray();
+
+	json.endObject();
+	Response::setJson(context, json.get());
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <string>
+
+#include "IrStd/IrStd.hpp"
+
+#include "Trader/Manager/Manager.hpp"
+#include "Trader/Server/Dispatcher.hpp"
+
+namespace Trader
+{
+	namespace EndPoint
+	{
+		class Snapshot
+		{
+		public:
+			enum Field : uint32_t
+			{
+				BALANCE = 1 << 0,
+				INITIAL_BALANCE = 1 << 1,
+				RATES = 1 << 2,
+				TRANSACTIONS = 1 << 3,
+				ACTIVE_ORDERS = 1 << 4,
+				ORDERS = 1 << 5,
+				PROFIT = 1 << 6,
+				ALL = (1 << 7) - 1
+			};
+
+			Snapshot(Trader::Manager& trader)
+					: m_trader(trader)
+			{
+			}
+
+			void setup(Dispatcher& server);
+
+			/**
+			 * \brief Get the state of all the exchanges and strategies in a single call
+			 *
+			 * The fields are separated with commas, the available fields are:
+			 * "balance", "initialBalance", "rates", "transactions", "activeOrders",
+			 * "orders" and "profit". All of them are sent if none is specified.
+			 * Each field has the same content as its dedicated endpoint.
+			 * When an exchange index is given, only this exchange is listed.
+			 *
+			 * Endpoint: GET /api/v1/snapshot
+			 * or        GET /api/v1/snapshot/{STRING}
+			 * or        GET /api/v1/snapshot/{UINT}/{STRING}
+			 * Response: json
+			 * {
+			 *     timestamp: 1514764800000,
+			 *     exchanges: [
+			 *         {
+			 *             name: "BTC-E#0",
+			 *             status: 1,
+			 *             ...
+			 *             balance: {...}
+			 *         }
+			 *     ],
+			 *     strategies: [
+			 *         {
+			 *             name: "Arbitrage#0",
+			 *             type: "Arbitrage",
+			 *             profit: {...}
+			 *         }
+			 *     ]
+			 * }
+			 */
+			void setupSnapshot(Dispatcher& server);
+
+			/**
+			 * Convert a comma separated list of fields into a mask of Field
+			 */
+			static uint32_t fromString(const std::string& fields);
+
+		private:
+			void sendSnapshot(IrStd::ServerREST::Context& context, const uint32_t fields,
+					const Trader::Exchange* const pExchange = nullptr);
+
+			Trader::Manager& m_trader;
+		};
+	}
+}
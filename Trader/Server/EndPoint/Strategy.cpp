@@ -2,7 +2,7 @@
 
 // ---- Trader::EndPoint::Strategy --------------------------------------------
 
-void Trader::EndPoint::Strategy::setup(IrStd::ServerREST& server)
+void Trader::EndPoint::Strategy::setup(Dispatcher& server)
 {
 	setupList(server);
 	setupStatus(server);
@@ -12,7 +12,7 @@ void Trader::EndPoint::Strategy::setup(IrStd::ServerREST& server)
 	setupOperations(server);
 }
 
-void Trader::EndPoint::Strategy::setupList(IrStd::ServerREST& server)
+void Trader::EndPoint::Strategy::setupList(Dispatcher& server)
 {
 	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/strategy/list", [&](IrStd::ServerREST::Context& context) {
 		IrStd::Json json({
@@ -29,36 +29,52 @@ void Trader::EndPoint::Strategy::setupList(IrStd::ServerREST& server)
 	});
 }
 
-void Trader::EndPoint::Strategy::setupStatus(IrStd::ServerREST& server)
+void Trader::EndPoint::Strategy::setupStatus(Dispatcher& server)
 {
 	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/strategy/{UINT}/status", [&](IrStd::ServerREST::Context& context) {
 		const size_t index = context.getMatchAsUInt(0);
 		const auto& strategy = m_trader.getStrategy(index);
 
 		{
+			const auto& processLatency = strategy.getProcessLatency();
+			const auto& triggerLatency = strategy.getTriggerLatency();
 			const IrStd::Json json({
-				{"processTime", strategy.getProcessTimePercent()}
+				{"processTime", strategy.getProcessTimePercent()},
+				{"processLatencyP50", processLatency.getPercentile(50)},
+				{"processLatencyP90", processLatency.getPercentile(90)},
+				{"processLatencyP99", processLatency.getPercentile(99)},
+				{"processLatencyMax", processLatency.getMax()},
+				{"triggerLatencyP50", triggerLatency.getPercentile(50)},
+				{"triggerLatencyP90", triggerLatency.getPercentile(90)},
+				{"triggerLatencyP99", triggerLatency.getPercentile(99)},
+				{"triggerLatencyMax", triggerLatency.getMax()},
+				{"nbProcess", processLatency.getCount()},
+				{"nbMissedTriggers", strategy.getNbMissedTriggers()}
 			});
 			context.getResponse().setData(json);
 		}
 	});
 }
 
-void Trader::EndPoint::Strategy::setupProfit(IrStd::ServerREST& server)
+void Trader::EndPoint::Strategy::setupProfit(Dispatcher& server)
 {
 	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/strategy/{UINT}/profit", [&](IrStd::ServerREST::Context& context) {
 		const size_t index = context.getMatchAsUInt(0);
 		const auto& strategy = m_trader.getStrategy(index);
 
-		{
-			IrStd::Json json;
+		// The profit estimates depend on the rates of all the exchanges involved
+		std::vector<uint64_t> counterList{strategy.getProfitVersion()};
+		strategy.getExchangeList([&](const Trader::Exchange& exchange) {
+			counterList.push_back(static_cast<uint64_t>(exchange.getEventRates().getCounter()));
+		});
+		m_cache.send(context, "profit/" + std::to_string(index), ResponseCache::makeVersion(counterList),
+				[&](JsonWriter& json) {
 			strategy.getProfitInJson(json);
-			context.getResponse().setData(json);
-		}
+		});
 	});
 }
 
-void Trader::EndPoint::Strategy::setupConfiguration(IrStd::ServerREST& server)
+void Trader::EndPoint::Strategy::setupConfiguration(Dispatcher& server)
 {
 	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/strategy/{UINT}/configuration", [&](IrStd::ServerREST::Context& context) {
 		const size_t index = context.getMatchAsUInt(0);
@@ -68,7 +84,7 @@ void Trader::EndPoint::Strategy::setupConfiguration(IrStd::ServerREST& server)
 	});
 }
 
-void Trader::EndPoint::Strategy::setupData(IrStd::ServerREST& server)
+void Trader::EndPoint::Strategy::setupData(Dispatcher& server)
 {
 	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/strategy/{UINT}/data", [&](IrStd::ServerREST::Context& context) {
 		const size_t index = context.getMatchAsUInt(0);
@@ -77,7 +93,7 @@ void Trader::EndPoint::Strategy::setupData(IrStd::ServerREST& server)
 	});
 }
 
-void Trader::EndPoint::Strategy::setupOperations(IrStd::ServerREST& server)
+void Trader::EndPoint::Strategy::setupOperations(Dispatcher& server)
 {
 	server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/strategy/{UINT}/operations", [&](IrStd::ServerREST::Context& context) {
 		const size_t index = context.getMatchAsUInt(0);
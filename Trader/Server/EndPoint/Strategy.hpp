@@ -3,6 +3,8 @@
 #include "IrStd/IrStd.hpp"
 
 #include "Trader/Manager/Manager.hpp"
+#include "Trader/Server/Dispatcher.hpp"
+#include "Trader/Server/ResponseCache.hpp"
 
 namespace Trader
 {
@@ -16,7 +18,7 @@ namespace Trader
 			{
 			}
 
-			void setup(IrStd::ServerREST& server);
+			void setup(Dispatcher& server);
 
 			/**
 			 * \brief Get information about the strategies
@@ -31,7 +33,7 @@ namespace Trader
 			 *     ]
 			 * }
 			 */
-			void setupList(IrStd::ServerREST& server);
+			void setupList(Dispatcher& server);
 
 			/**
 			 * \brief Return the current status of the strategy
@@ -41,7 +43,7 @@ namespace Trader
 			 * {
 			 * }
 			 */
-			void setupStatus(IrStd::ServerREST& server);
+			void setupStatus(Dispatcher& server);
 
 			/**
 			 * \brief Get the profit registered by a specific strategy
@@ -51,7 +53,7 @@ namespace Trader
 			 * {
 			 * }
 			 */
-			void setupProfit(IrStd::ServerREST& server);
+			void setupProfit(Dispatcher& server);
 
 			/**
 			 * \brief Returns configuration of the strategy
@@ -61,7 +63,7 @@ namespace Trader
 			 * {
 			 * }
 			 */
-			void setupConfiguration(IrStd::ServerREST& server);
+			void setupConfiguration(Dispatcher& server);
 
 			/**
 			 * \brief Returns specific information about the strategy
@@ -71,7 +73,7 @@ namespace Trader
 			 * {
 			 * }
 			 */
-			void setupData(IrStd::ServerREST& server);
+			void setupData(Dispatcher& server);
 
 			/**
 			 * \brief Get the list of the last operations
@@ -82,10 +84,11 @@ namespace Trader
 			 *     // Operations
 			 * }
 			 */
-			void setupOperations(IrStd::ServerREST& server);
+			void setupOperations(Dispatcher& server);
 
 		private:
 			Trader::Manager& m_trader;
+			ResponseCache m_cache;
 		};
 	}
 }
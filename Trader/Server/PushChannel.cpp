@@ -0,0 +1,172 @@
+#include <algorithm>
+
+#include "Trader/Server/PushChannel.hpp"
+#include "Trader/Generic/Json/JsonWriter.hpp"
+
+// ---- Trader::PushChannel ---------------------------------------------------
+
+constexpr Trader::PushChannel::Sequence Trader::PushChannel::DELETED_HISTORY;
+
+Trader::PushChannel::PushChannel()
+		: m_sequence(0)
+		, m_pruneSequence(0)
+{
+}
+
+Trader::PushChannel::Sequence Trader::PushChannel::getSequence() const
+{
+	auto scope = m_lock.readScope();
+	return m_sequence;
+}
+
+void Trader::PushChannel::publish(
+		const std::string& topicName,
+		const Values& values)
+{
+	auto scope = m_lock.writeScope();
+	auto& topic = m_topicList[topicName];
+	const Sequence sequence = m_sequence + 1;
+	bool isModified = false;
+
+	// Mark the entries not published anymore as deleted
+	for (auto& it : topic.m_entryList)
+	{
+		if (!it.second.m_isDeleted && values.find(it.first) == values.end())
+		{
+			it.second.m_value.clear();
+			it.second.m_sequence = sequence;
+			it.second.m_isDeleted = true;
+			isModified = true;
+		}
+	}
+
+	for (const auto& value : values)
+	{
+		auto it = topic.m_entryList.find(value.first);
+		if (it == topic.m_entryList.end())
+		{
+			topic.m_entryList.insert(std::make_pair(value.first, Entry{value.second, sequence, false}));
+			isModified = true;
+		}
+		else if (it->second.m_isDeleted || it->second.m_value != value.second)
+		{
+			it->second = Entry{value.second, sequence, false};
+			isModified = true;
+		}
+	}
+
+	if (isModified)
+	{
+		m_sequence = sequence;
+		topic.m_sequence = sequence;
+		pruneNoLock(topic);
+	}
+}
+
+void Trader::PushChannel::pruneNoLock(Topic& topic)
+{
+	if (m_sequence <= DELETED_HISTORY)
+	{
+		return;
+	}
+	const Sequence limit = m_sequence - DELETED_HISTORY;
+	for (auto it = topic.m_entryList.begin(); it != topic.m_entryList.end(); )
+	{
+		if (it->second.m_isDeleted && it->second.m_sequence < limit)
+		{
+			m_pruneSequence = std::max(m_pruneSequence, it->second.m_sequence);
+			it = topic.m_entryList.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+}
+
+std::string Trader::PushChannel::poll(
+		const Sequence cursor,
+		const std::vector<std::string>& topicList) const
+{
+	auto scope = m_lock.readScope();
+
+	// Send everything if the client might have missed some deletions or comes from another instance
+	const bool isReset = (cursor < m_pruneSequence || cursor > m_sequence);
+
+	std::string json("{\"cursor\":");
+	JsonWriter::appendNumber(json, m_sequence);
+	json.append(",\"reset\":");
+	json.append((isReset) ? "true" : "false");
+	json.append(",\"topics\":{");
+
+	bool isFirstTopic = true;
+	for (const auto& topicName : topicList)
+	{
+		const auto itTopic = m_topicList.find(topicName);
+		if (itTopic == m_topicList.end() || (!isReset && itTopic->second.m_sequence <= cursor))
+		{
+			continue;
+		}
+
+		json.append((isFirstTopic) ? "" : ",");
+		json.append(toJson(topicName));
+		json.append(":{");
+		isFirstTopic = false;
+
+		bool isFirstEntry = true;
+		for (const auto& it : itTopic->second.m_entryList)
+		{
+			const auto& entry = it.second;
+			if ((isReset) ? entry.m_isDeleted : (entry.m_sequence <= cursor))
+			{
+				continue;
+			}
+			json.append((isFirstEntry) ? "" : ",");
+			json.append(toJson(it.first));
+			json.push_back(':');
+			json.append((entry.m_isDeleted) ? "null" : entry.m_value);
+			isFirstEntry = false;
+		}
+		json.push_back('}');
+	}
+	json.append("}}");
+
+	return json;
+}
+
+bool Trader::PushChannel::isModified(
+		const Sequence cursor,
+		const std::vector<std::string>& topicList) const
+{
+	auto scope = m_lock.readScope();
+
+	if (cursor < m_pruneSequence || cursor > m_sequence)
+	{
+		return true;
+	}
+	for (const auto& topicName : topicList)
+	{
+		const auto itTopic = m_topicList.find(topicName);
+		if (itTopic != m_topicList.end() && itTopic->second.m_sequence > cursor)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// ---- Trader::PushChannel (helpers) -----------------------------------------
+
+std::string Trader::PushChannel::toJson(const std::string& str)
+{
+	std::string json;
+	JsonWriter::appendString(json, str.data(), str.size());
+	return json;
+}
+
+std::string Trader::PushChannel::toJson(const double number)
+{
+	std::string json;
+	JsonWriter::appendNumber(json, number);
+	return json;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "IrStd/IrStd.hpp"
+
+namespace Trader
+{
+	/**
+	 * Versioned key/value store of the data pushed to the clients.
+	 *
+	 * Publishers replace the whole content of a topic, only the entries that
+	 * changed get a new sequence number. Clients send back the cursor of their
+	 * previous poll and receive the entries modified or deleted since, so
+	 * multiple updates between two polls are coalesced into the latest value
+	 * and a slow client never holds any state on the server.
+	 */
+	class PushChannel
+	{
+	public:
+		typedef uint64_t Sequence;
+		/**
+		 * Content of a topic, each value is a JSON document
+		 */
+		typedef std::map<std::string, std::string> Values;
+
+		/**
+		 * Number of sequences deleted entries are remembered for, clients
+		 * with an older cursor receive the full content instead.
+		 */
+		static constexpr Sequence DELETED_HISTORY = 4096;
+
+		PushChannel();
+
+		/**
+		 * Replace the content of a topic, the entries not present are deleted
+		 */
+		void publish(const std::string& topic, const Values& values);
+
+		/**
+		 * Build the changes of the topics since \p cursor as a JSON document:
+		 * {
+		 *     cursor: 12,     // cursor to be sent with the next poll
+		 *     reset: false,   // true if the full content is sent
+		 *     topics: {
+		 *         "0.rates": {"BTC/USD": {...}, "ETH/USD": null} // null if deleted
+		 *     }
+		 * }
+		 */
+		std::string poll(const Sequence cursor, const std::vector<std::string>& topicList) const;
+
+		/**
+		 * Tells if poll() would return any change on the topics since \p cursor
+		 */
+		bool isModified(const Sequence cursor, const std::vector<std::string>& topicList) const;
+
+		Sequence getSequence() const;
+
+		/**
+		 * Helpers to build the values
+		 */
+		static std::string toJson(const std::string& str);
+		static std::string toJson(const double number);
+
+	private:
+		struct Entry
+		{
+			std::string m_value;
+			Sequence m_sequence;
+			bool m_isDeleted;
+		};
+
+		struct Topic
+		{
+			std::map<std::string, Entry> m_entryList;
+			Sequence m_sequence;
+		};
+
+		void pruneNoLock(Topic& topic);
+
+		mutable IrStd::RWLock m_lock;
+		std::map<std::string, Topic> m_topicList;
+		Sequence m_sequence;
+		// Clients with a cursor older than this might have missed deleted entries
+		Sequence m_pruneSequence;
+	};
+}
@@ -0,0 +1,48 @@
+#include "Trader/Server/Response.hpp"
+#include "Trader/Generic/Compression/Gzip.hpp"
+
+IRSTD_TOPIC_USE_ALIAS(TraderServer, Trader, Server);
+
+// ---- Trader::Response ------------------------------------------------------
+
+constexpr size_t Trader::Response::GZIP_MIN_SIZE;
+
+std::string Trader::Response::getHeader(
+		IrStd::ServerHTTP::Context& context,
+		const char* const pName)
+{
+	const char* const pValue = context.getRequest().getHeader(pName);
+	return (pValue) ? std::string(pValue) : std::string();
+}
+
+bool Trader::Response::isGzipAccepted(IrStd::ServerHTTP::Context& context)
+{
+	return getHeader(context, "Accept-Encoding").find("gzip") != std::string::npos;
+}
+
+void Trader::Response::setJson(
+		IrStd::ServerHTTP::Context& context,
+		const std::string& json)
+{
+	auto& response = context.getResponse();
+	response.addHeader("Content-Type", "application/json");
+	// Caches must not serve a compressed body to a client that does not accept it
+	response.addHeader("Vary", "Accept-Encoding");
+
+	if (json.size() >= GZIP_MIN_SIZE && isGzipAccepted(context))
+	{
+		try
+		{
+			// Favor speed, this runs on the server thread for every request
+			const auto jsonGzip = Gzip::compress(json, /*level*/1);
+			response.addHeader("Content-Encoding", "gzip");
+			response.setData(jsonGzip.c_str(), jsonGzip.size());
+			return;
+		}
+		catch (const IrStd::Exception& e)
+		{
+			IRSTD_LOG_WARNING(TraderServer, "Response sent uncompressed: " << e);
+		}
+	}
+	response.setData(json.c_str(), json.size());
+}
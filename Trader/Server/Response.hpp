@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+
+#include "IrStd/IrStd.hpp"
+
+namespace Trader
+{
+	/**
+	 * Helpers to read the requests and fill the responses of the HTTP server
+	 */
+	class Response
+	{
+	public:
+		/**
+		 * Responses smaller than this are not compressed
+		 */
+		static constexpr size_t GZIP_MIN_SIZE = 1024;
+
+		/**
+		 * Value of a request header, empty if not present
+		 */
+		static std::string getHeader(IrStd::ServerHTTP::Context& context, const char* const pName);
+
+		static bool isGzipAccepted(IrStd::ServerHTTP::Context& context);
+
+		/**
+		 * Send a serialized JSON document, compressed if the client supports it
+		 */
+		static void setJson(IrStd::ServerHTTP::Context& context, const std::string& json);
+	};
+}
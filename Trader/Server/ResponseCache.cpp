@@ -0,0 +1,109 @@
+#include <cstdio>
+
+#include "Trader/Server/ResponseCache.hpp"
+#include "Trader/Server/Response.hpp"
+#include "Trader/Generic/Compression/Gzip.hpp"
+
+IRSTD_TOPIC_USE_ALIAS(TraderServer, Trader, Server);
+
+// ---- Trader::ResponseCache -------------------------------------------------
+
+Trader::ResponseCache::ResponseCache()
+		: m_nbBuilds(0)
+{
+}
+
+std::string Trader::ResponseCache::makeVersion(const std::vector<uint64_t>& counterList)
+{
+	std::string version;
+	for (const auto counter : counterList)
+	{
+		char str[24];
+		std::snprintf(str, sizeof(str), "%s%llx", (version.empty()) ? "" : "-",
+				static_cast<unsigned long long>(counter));
+		version.append(str);
+	}
+	return version;
+}
+
+std::string Trader::ResponseCache::toEtag(const std::string& version)
+{
+	return "\"" + version + "\"";
+}
+
+size_t Trader::ResponseCache::getNbBuilds() const noexcept
+{
+	return m_nbBuilds;
+}
+
+std::shared_ptr<const Trader::ResponseCache::Entry> Trader::ResponseCache::get(
+		const std::string& key,
+		const std::string& version,
+		const Builder& build)
+{
+	const auto etag = toEtag(version);
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		const auto it = m_entryList.find(key);
+		if (it != m_entryList.end() && it->second->m_etag == etag)
+		{
+			return it->second;
+		}
+	}
+
+	// Build the response without holding the lock, concurrent builds of the same version are harmless
+	std::shared_ptr<Entry> pEntry = std::make_shared<Entry>();
+	pEntry->m_etag = etag;
+	{
+		JsonWriter json(pEntry->m_body);
+		build(json);
+	}
+	if (pEntry->m_body.size() >= Response::GZIP_MIN_SIZE)
+	{
+		try
+		{
+			pEntry->m_bodyGzip = Gzip::compress(pEntry->m_body, /*level*/6);
+		}
+		catch (const IrStd::Exception& e)
+		{
+			IRSTD_LOG_WARNING(TraderServer, "Response of '" << key << "' cached uncompressed: " << e);
+		}
+	}
+
+	++m_nbBuilds;
+	std::lock_guard<std::mutex> lock(m_lock);
+	m_entryList[key] = pEntry;
+	return pEntry;
+}
+
+void Trader::ResponseCache::send(
+		IrStd::ServerHTTP::Context& context,
+		const std::string& key,
+		const std::string& version,
+		const Builder& build)
+{
+	auto& response = context.getResponse();
+	const auto etag = toEtag(version);
+	response.addHeader("ETag", etag.c_str());
+	response.addHeader("Cache-Control", "no-cache");
+
+	// The client is up to date, nothing needs to be built
+	if (Response::getHeader(context, "If-None-Match") == etag)
+	{
+		response.setStatus(304);
+		return;
+	}
+
+	const auto pEntry = get(key, version, build);
+	response.addHeader("Content-Type", "application/json");
+	response.addHeader("Vary", "Accept-Encoding");
+	if (!pEntry->m_bodyGzip.empty() && Response::isGzipAccepted(context))
+	{
+		response.addHeader("Content-Encoding", "gzip");
+		response.setData(pEntry->m_bodyGzip.c_str(), pEntry->m_bodyGzip.size());
+	}
+	else
+	{
+		response.setData(pEntry->m_body.c_str(), pEntry->m_body.size());
+	}
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "IrStd/IrStd.hpp"
+#include "Trader/Generic/Json/JsonWriter.hpp"
+
+namespace Trader
+{
+	/**
+	 * Cache of serialized responses, indexed by resource and version.
+	 *
+	 * The version of a resource is built from counters that change each time
+	 * the underlying data is updated (events of the exchange for example). A
+	 * response is serialized once per version and shared between all the
+	 * requests, clients sending back the version as entity tag receive a 304.
+	 */
+	class ResponseCache
+	{
+	public:
+		typedef std::function<void(JsonWriter& json)> Builder;
+
+		struct Entry
+		{
+			std::string m_etag;
+			std::string m_body;
+			// Empty if the body is too small to be compressed
+			std::string m_bodyGzip;
+		};
+
+		ResponseCache();
+
+		/**
+		 * Build a version from a list of counters
+		 */
+		static std::string makeVersion(const std::vector<uint64_t>& counterList);
+
+		/**
+		 * Get the response of a resource at a specific version, \p build is
+		 * called only if it is not cached already.
+		 */
+		std::shared_ptr<const Entry> get(const std::string& key, const std::string& version, const Builder& build);
+
+		/**
+		 * Send the response of a resource at a specific version
+		 */
+		void send(IrStd::ServerHTTP::Context& context, const std::string& key, const std::string& version,
+				const Builder& build);
+
+		/**
+		 * Number of responses built so far
+		 */
+		size_t getNbBuilds() const noexcept;
+
+	private:
+		static std::string toEtag(const std::string& version);
+
+		std::mutex m_lock;
+		std::map<std::string, std::shared_ptr<const Entry>> m_entryList;
+		std::atomic<size_t> m_nbBuilds;
+	};
+}
@@ -3,9 +3,13 @@
 #include "IrStd/IrStd.hpp"
 
 #include "Trader/Server/Server.hpp"
+#include "Trader/Server/Response.hpp"
+#include "Trader/Server/Dispatcher.hpp"
 #include "Trader/Server/EndPoint/Manager.hpp"
 #include "Trader/Server/EndPoint/Exchange.hpp"
 #include "Trader/Server/EndPoint/Strategy.hpp"
+#include "Trader/Server/EndPoint/Push.hpp"
+#include "Trader/Server/EndPoint/Snapshot.hpp"
 
 #include "Trader/Manager/Manager.hpp"
 
@@ -19,6 +23,7 @@ Trader::Server::ServerREST::ServerREST(const int port)
 {
 	IrStd::FileSystem::pwd(m_rootPath);
 	IrStd::FileSystem::append(m_rootPath, "www");
+	m_pAssetCache.reset(new AssetCache(m_rootPath));
 }
 
 void Trader::Server::ServerREST::routeNotFound(IrStd::ServerHTTP::Context& context)
@@ -34,10 +39,38 @@ void Trader::Server::ServerREST::routeNotFound(IrStd::ServerHTTP::Context& conte
 
 	if (uri.find("..") == std::string::npos)
 	{
+		// Serve the file from memory if possible
+		if (const auto pAsset = m_pAssetCache->get(uri))
+		{
+			auto& response = context.getResponse();
+			response.addHeader("Content-Type", pAsset->m_mimeType.c_str());
+			response.addHeader("ETag", pAsset->m_etag.c_str());
+			// Let the browser keep a copy but revalidate it with the entity tag
+			response.addHeader("Cache-Control", "no-cache");
+			response.addHeader("Vary", "Accept-Encoding");
+
+			if (Response::getHeader(context, "If-None-Match") == pAsset->m_etag)
+			{
+				response.setStatus(304);
+			}
+			else if (!pAsset->m_contentGzip.empty()
+					&& Response::isGzipAccepted(context))
+			{
+				response.addHeader("Content-Encoding", "gzip");
+				response.setData(pAsset->m_contentGzip.c_str(), pAsset->m_contentGzip.size());
+			}
+			else
+			{
+				response.setData(pAsset->m_content.c_str(), pAsset->m_content.size());
+			}
+			return;
+		}
+
 		// Construct the full path
 		auto fullPath = m_rootPath;
 		IrStd::FileSystem::append(fullPath, uri.c_str());
 
+		// Files too large to be cached are read from the disk
 		if (IrStd::FileSystem::isFile(fullPath))
 		{
 			// Read the file type
@@ -64,25 +97,38 @@ void Trader::Server::ServerREST::routeNotFound(IrStd::ServerHTTP::Context& conte
 
 // ---- Trader::Server --------------------------------------------------------
 
+constexpr int Trader::Server::MONITORING_PORT_OFFSET;
+constexpr int Trader::Server::PUSH_PORT_OFFSET;
+
 Trader::Server::Server(Manager& trader, const int port)
 		: m_server(port)
+		, m_monitoringServer(port + MONITORING_PORT_OFFSET)
+		, m_pushServer(port + PUSH_PORT_OFFSET)
 		, m_threadId()
+		, m_monitoringThreadId(std::thread::id())
+		, m_pushThreadId(std::thread::id())
 		, m_trader(trader)
 {
 }
 
 void Trader::Server::serverThread()
 {
+	Dispatcher dispatcher(m_server, &m_monitoringServer);
+	Dispatcher pushDispatcher(m_pushServer);
 	EndPoint::Exchange exchangeEndPoint(m_trader);
 	EndPoint::Strategy strategyEndPoint(m_trader);
 	EndPoint::Manager managerEndPoint(m_trader);
+	EndPoint::Push pushEndPoint(m_trader);
+	EndPoint::Snapshot snapshotEndPoint(m_trader);
 
-	exchangeEndPoint.setup(m_server);
-	strategyEndPoint.setup(m_server);
-	managerEndPoint.setup(m_server);
+	exchangeEndPoint.setup(dispatcher);
+	strategyEndPoint.setup(dispatcher);
+	managerEndPoint.setup(dispatcher);
+	pushEndPoint.setup(pushDispatcher);
+	snapshotEndPoint.setup(dispatcher);
 
 	// List all available traces
-	m_server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/trace", [&](IrStd::ServerREST::Context& context) {
+	dispatcher.addMonitoringRoute(IrStd::HTTPMethod::GET, "/api/v1/trace", [&](IrStd::ServerREST::Context& context) {
 
 		IrStd::Json json;
 		size_t index = 0;
@@ -93,7 +139,7 @@ void Trader::Server::serverThread()
 	});
 
 	// Set trace level to a specific topic
-	m_server.addRoute(IrStd::HTTPMethod::GET, "/api/v1/trace/{UINT}/trace", [&](IrStd::ServerREST::Context& context) {
+	dispatcher.addMonitoringRoute(IrStd::HTTPMethod::GET, "/api/v1/trace/{UINT}/trace", [&](IrStd::ServerREST::Context& context) {
 
 		const size_t topicIndex = context.getMatchAsUInt(0);
 		size_t index = 0;
@@ -109,9 +155,25 @@ void Trader::Server::serverThread()
 			<< ", reading from '" << m_server.m_rootPath
 			<< "', example of usage: 'curl http://localhost:" << m_server.getPort() << "/api/v1/trace'");
 
+	// All routes are registered, the monitoring and push servers can start
+	m_monitoringThreadId.store(IrStd::Threads::create("RESTMonitoringServer", &Trader::Server::monitoringServerThread, this));
+	m_pushThreadId.store(IrStd::Threads::create("RESTPushServer", &Trader::Server::pushServerThread, this));
+
 	m_server.start();
 }
 
+void Trader::Server::monitoringServerThread()
+{
+	IRSTD_LOG_INFO(TraderServer, "Monitoring server started on port " << m_monitoringServer.getPort());
+	m_monitoringServer.start();
+}
+
+void Trader::Server::pushServerThread()
+{
+	IRSTD_LOG_INFO(TraderServer, "Push server started on port " << m_pushServer.getPort());
+	m_pushServer.start();
+}
+
 void Trader::Server::start()
 {
 	IRSTD_ASSERT(m_threadId == std::thread::id());
@@ -121,6 +183,19 @@ void Trader::Server::start()
 void Trader::Server::stop()
 {
 	IRSTD_ASSERT(m_threadId != std::thread::id());
+	// The monitoring and push routes belong to the endpoints of the server thread
+	const auto monitoringThreadId = m_monitoringThreadId.load();
+	if (monitoringThreadId != std::thread::id())
+	{
+		m_monitoringServer.stop();
+		IrStd::Threads::terminate(monitoringThreadId);
+	}
+	const auto pushThreadId = m_pushThreadId.load();
+	if (pushThreadId != std::thread::id())
+	{
+		m_pushServer.stop();
+		IrStd::Threads::terminate(pushThreadId);
+	}
 	m_server.stop();
 	IrStd::Threads::terminate(m_threadId);
 }
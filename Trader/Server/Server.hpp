@@ -1,8 +1,11 @@
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <thread>
 
 #include "IrStd/IrStd.hpp"
+#include "Trader/Server/AssetCache.hpp"
 
 namespace Trader
 {
@@ -10,6 +13,15 @@ namespace Trader
 	class Server
 	{
 	public:
+		/**
+		 * The monitoring routes are also served on \p port + MONITORING_PORT_OFFSET
+		 */
+		static constexpr int MONITORING_PORT_OFFSET = 1;
+		/**
+		 * The push endpoint, which holds the requests, is served on \p port + PUSH_PORT_OFFSET
+		 */
+		static constexpr int PUSH_PORT_OFFSET = 2;
+
 		Server(Manager& trader, const int port);
 
 		void start();
@@ -17,6 +29,8 @@ namespace Trader
 
 	private:
 		void serverThread();
+		void monitoringServerThread();
+		void pushServerThread();
 
 		class ServerREST : public IrStd::ServerREST
 		{
@@ -27,10 +41,16 @@ namespace Trader
 		private:
 			friend Trader::Server;
 			std::string m_rootPath;
+			std::unique_ptr<AssetCache> m_pAssetCache;
 		};
 
 		ServerREST m_server;
+		IrStd::ServerREST m_monitoringServer;
+		IrStd::ServerREST m_pushServer;
 		std::thread::id m_threadId;
+		//! Set by the server thread once the routes are registered
+		std::atomic<std::thread::id> m_monitoringThreadId;
+		std::atomic<std::thread::id> m_pushThreadId;
 		Manager& m_trader;
 	};
 }
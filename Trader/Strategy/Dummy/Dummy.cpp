@@ -4,12 +4,17 @@
 IRSTD_TOPIC_REGISTER(Trader, Strategy, Dummy);
 IRSTD_TOPIC_USE_ALIAS(TraderDummy, Trader, Strategy, Dummy);
 
-#define SELL_PROFIT_PERCENT 1.
-#define BUY_MIN_SPREAD_PERCENT 0.1
-
 Trader::Dummy::Dummy(const IrStd::Type::Gson::Map& config)
 		: Strategy(Id("Dummy"), ConfigurationStrategy({
-			{"trigger", IrStd::Type::toIntegral(ConfigurationStrategy::Trigger::ON_RATE_CHANGE)}
+			{"trigger", IrStd::Type::toIntegral(ConfigurationStrategy::Trigger::ON_RATE_CHANGE)},
+			/**
+			 * Profit expected when selling back (exculding fee)
+			 */
+			{"sellProfitPercent", 1.},
+			/**
+			 * Minimal spread of the rates over the last minute to buy
+			 */
+			{"buyMinSpreadPercent", 0.1}
 		}, config))
 {
 #ifdef DEBUG_DUMMY
@@ -23,6 +28,9 @@ void Trader::Dummy::initializeImpl()
 
 void Trader::Dummy::processImpl(const size_t /*counter*/)
 {
+	const double sellProfitPercent = getConfiguration().getJson().getNumber("sellProfitPercent");
+	const double buyMinSpreadPercent = getConfiguration().getJson().getNumber("buyMinSpreadPercent");
+
 	// Loop through the available currency
 	getExchange().getCurrencies([&](const CurrencyPtr currency) {
 
@@ -39,8 +47,9 @@ void Trader::Dummy::processImpl(const size_t /*counter*/)
 				IrStd::Type::Decimal maxRate = IrStd::Type::Decimal::min();
 				IrStd::Type::Decimal minRate = IrStd::Type::Decimal::max();
 				// Check if the current rate is the highest of the last x samples
+				const auto timestamp = getExchange().getClock().now();
 				const bool isComplete = pTransaction->getRates(
-					IrStd::Type::Timestamp::now(), IrStd::Type::Timestamp::now() - 60 * 1000,
+					timestamp, timestamp - 60 * 1000,
 					[&](const IrStd::Type::Timestamp /*timestamp*/, const IrStd::Type::Decimal rate) {
 						nbData++;
 						maxRate = (rate > maxRate) ? rate : maxRate;
@@ -50,7 +59,7 @@ void Trader::Dummy::processImpl(const size_t /*counter*/)
 				const auto spreadPrecent = (maxRate - minRate) / maxRate * 100;
 
 				// If an opportunity is detected...
-				if (!isComplete || spreadPrecent < BUY_MIN_SPREAD_PERCENT || pTransaction->getRate() != maxRate)
+				if (!isComplete || spreadPrecent < buyMinSpreadPercent || pTransaction->getRate() != maxRate)
 				{
 					return;
 				}
@@ -64,8 +73,8 @@ void Trader::Dummy::processImpl(const size_t /*counter*/)
 				auto pInverseTransaction = getExchange().getTransactionMap().getTransactionForWrite(order.getFinalCurrency(), order.getInitialCurrency());
 				if (pInverseTransaction)
 				{
-					// Sell with 1% profit (exculding fee)
-					Order inverseOrder(pInverseTransaction, (1. / order.getRate()) * (1. + SELL_PROFIT_PERCENT / 100.));
+					// Sell with some profit (exculding fee)
+					Order inverseOrder(pInverseTransaction, (1. / order.getRate()) * (1. + sellProfitPercent / 100.));
 					order.addNext(inverseOrder);
 
 					// Create the sell operation
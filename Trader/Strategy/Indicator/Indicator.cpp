@@ -0,0 +1,280 @@
+#include <algorithm>
+#include <cmath>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	#define TRADER_INDICATOR_AVX2 1
+	#define TRADER_INDICATOR_INLINE inline __attribute__((always_inline))
+#else
+	#define TRADER_INDICATOR_INLINE inline
+#endif
+
+#include "Trader/Strategy/Indicator/Indicator.hpp"
+
+IRSTD_TOPIC_REGISTER(Trader, Indicator);
+IRSTD_TOPIC_USE_ALIAS(TraderIndicator, Trader, Indicator);
+
+namespace
+{
+	// The kernels go through the matrix sample by sample, the inner loops run over
+	// the contiguous series and are left to the compiler to vectorize. They are
+	// compiled once for the baseline instruction set and once for AVX2.
+
+	TRADER_INDICATOR_INLINE void sumKernel(const double* pData, const size_t nbSeries,
+			const size_t begin, const size_t end, double* pSum)
+	{
+		std::fill(pSum, pSum + nbSeries, 0.);
+		for (size_t sample = begin; sample < end; ++sample)
+		{
+			const double* const pSample = pData + sample * nbSeries;
+			for (size_t i = 0; i < nbSeries; ++i)
+			{
+				pSum[i] += pSample[i];
+			}
+		}
+	}
+
+	TRADER_INDICATOR_INLINE void squaredDeviationKernel(const double* pData, const size_t nbSeries,
+			const size_t begin, const size_t end, const double* pMean, double* pSum)
+	{
+		std::fill(pSum, pSum + nbSeries, 0.);
+		for (size_t sample = begin; sample < end; ++sample)
+		{
+			const double* const pSample = pData + sample * nbSeries;
+			for (size_t i = 0; i < nbSeries; ++i)
+			{
+				const double delta = pSample[i] - pMean[i];
+				pSum[i] += delta * delta;
+			}
+		}
+	}
+
+	TRADER_INDICATOR_INLINE void minMaxKernel(const double* pData, const size_t nbSeries,
+			const size_t begin, const size_t end, double* pMin, double* pMax)
+	{
+		std::copy(pData + begin * nbSeries, pData + (begin + 1) * nbSeries, pMin);
+		std::copy(pData + begin * nbSeries, pData + (begin + 1) * nbSeries, pMax);
+		for (size_t sample = begin + 1; sample < end; ++sample)
+		{
+			const double* const pSample = pData + sample * nbSeries;
+			for (size_t i = 0; i < nbSeries; ++i)
+			{
+				pMin[i] = (pSample[i] < pMin[i]) ? pSample[i] : pMin[i];
+				pMax[i] = (pSample[i] > pMax[i]) ? pSample[i] : pMax[i];
+			}
+		}
+	}
+
+	TRADER_INDICATOR_INLINE void emaKernel(const double* pData, const size_t nbSeries,
+			const size_t end, const double alpha, double* pAverage)
+	{
+		std::copy(pData, pData + nbSeries, pAverage);
+		for (size_t sample = 1; sample < end; ++sample)
+		{
+			const double* const pSample = pData + sample * nbSeries;
+			for (size_t i = 0; i < nbSeries; ++i)
+			{
+				pAverage[i] += alpha * (pSample[i] - pAverage[i]);
+			}
+		}
+	}
+
+	struct Kernels
+	{
+		decltype(&sumKernel) m_sum;
+		decltype(&squaredDeviationKernel) m_squaredDeviation;
+		decltype(&minMaxKernel) m_minMax;
+		decltype(&emaKernel) m_ema;
+		const char* m_pName;
+	};
+
+	void sumDefault(const double* pData, const size_t nbSeries, const size_t begin, const size_t end, double* pSum)
+	{
+		sumKernel(pData, nbSeries, begin, end, pSum);
+	}
+
+	void squaredDeviationDefault(const double* pData, const size_t nbSeries, const size_t begin, const size_t end,
+			const double* pMean, double* pSum)
+	{
+		squaredDeviationKernel(pData, nbSeries, begin, end, pMean, pSum);
+	}
+
+	void minMaxDefault(const double* pData, const size_t nbSeries, const size_t begin, const size_t end,
+			double* pMin, double* pMax)
+	{
+		minMaxKernel(pData, nbSeries, begin, end, pMin, pMax);
+	}
+
+	void emaDefault(const double* pData, const size_t nbSeries, const size_t end, const double alpha,
+			double* pAverage)
+	{
+		emaKernel(pData, nbSeries, end, alpha, pAverage);
+	}
+
+#if defined(TRADER_INDICATOR_AVX2)
+	__attribute__((target("avx2"))) void sumAvx2(const double* pData, const size_t nbSeries,
+			const size_t begin, const size_t end, double* pSum)
+	{
+		sumKernel(pData, nbSeries, begin, end, pSum);
+	}
+
+	__attribute__((target("avx2"))) void squaredDeviationAvx2(const double* pData, const size_t nbSeries,
+			const size_t begin, const size_t end, const double* pMean, double* pSum)
+	{
+		squaredDeviationKernel(pData, nbSeries, begin, end, pMean, pSum);
+	}
+
+	__attribute__((target("avx2"))) void minMaxAvx2(const double* pData, const size_t nbSeries,
+			const size_t begin, const size_t end, double* pMin, double* pMax)
+	{
+		minMaxKernel(pData, nbSeries, begin, end, pMin, pMax);
+	}
+
+	__attribute__((target("avx2"))) void emaAvx2(const double* pData, const size_t nbSeries,
+			const size_t end, const double alpha, double* pAverage)
+	{
+		emaKernel(pData, nbSeries, end, alpha, pAverage);
+	}
+#endif
+
+	Kernels selectKernels()
+	{
+#if defined(TRADER_INDICATOR_AVX2)
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2"))
+		{
+			return Kernels{sumAvx2, squaredDeviationAvx2, minMaxAvx2, emaAvx2, "avx2"};
+		}
+#endif
+		return Kernels{sumDefault, squaredDeviationDefault, minMaxDefault, emaDefault, "default"};
+	}
+
+	const Kernels& getKernels()
+	{
+		static const Kernels kernels = selectKernels();
+		return kernels;
+	}
+
+	/**
+	 * Return the first sample of the window, after validating it
+	 */
+	size_t getWindowBegin(const Trader::RateMatrix& matrix, const size_t period, const size_t lag)
+	{
+		IRSTD_THROW_ASSERT(TraderIndicator, period && period + lag <= matrix.getLength(),
+				"The window (period=" << period << ", lag=" << lag << ") does not fit in the "
+				<< matrix.getLength() << " samples of the matrix");
+		return matrix.getLength() - lag - period;
+	}
+}
+
+// ---- Trader::Indicator -----------------------------------------------------
+
+void Trader::Indicator::sma(
+		const RateMatrix& matrix,
+		const size_t period,
+		std::vector<double>& average,
+		const size_t lag)
+{
+	const size_t begin = getWindowBegin(matrix, period, lag);
+	const size_t nbSeries = matrix.getNbSeries();
+
+	average.resize(nbSeries);
+	getKernels().m_sum(matrix.getData(), nbSeries, begin, begin + period, average.data());
+	for (auto& value : average)
+	{
+		value /= period;
+	}
+}
+
+void Trader::Indicator::ema(
+		const RateMatrix& matrix,
+		const size_t period,
+		std::vector<double>& average,
+		const size_t lag)
+{
+	const size_t begin = getWindowBegin(matrix, period, lag);
+
+	average.resize(matrix.getNbSeries());
+	getKernels().m_ema(matrix.getData(), matrix.getNbSeries(), begin + period, 2. / (period + 1),
+			average.data());
+}
+
+void Trader::Indicator::stddev(
+		const RateMatrix& matrix,
+		const size_t period,
+		std::vector<double>& deviation,
+		const size_t lag)
+{
+	const size_t begin = getWindowBegin(matrix, period, lag);
+	const size_t nbSeries = matrix.getNbSeries();
+
+	// Two passes, to not lose precision on rates with a small variance
+	std::vector<double> average;
+	sma(matrix, period, average, lag);
+	deviation.resize(nbSeries);
+	getKernels().m_squaredDeviation(matrix.getData(), nbSeries, begin, begin + period, average.data(),
+			deviation.data());
+	for (auto& value : deviation)
+	{
+		value = std::sqrt(value / period);
+	}
+}
+
+void Trader::Indicator::minMax(
+		const RateMatrix& matrix,
+		const size_t period,
+		std::vector<double>& min,
+		std::vector<double>& max,
+		const size_t lag)
+{
+	const size_t begin = getWindowBegin(matrix, period, lag);
+
+	min.resize(matrix.getNbSeries());
+	max.resize(matrix.getNbSeries());
+	getKernels().m_minMax(matrix.getData(), matrix.getNbSeries(), begin, begin + period, min.data(), max.data());
+}
+
+void Trader::Indicator::zScore(
+		const RateMatrix& matrix,
+		const size_t period,
+		std::vector<double>& score,
+		const size_t lag)
+{
+	std::vector<double> average;
+	std::vector<double> deviation;
+	sma(matrix, period, average, lag);
+	stddev(matrix, period, deviation, lag);
+
+	const double* const pLatest = matrix.getSample(matrix.getLength() - lag - 1);
+	score.resize(matrix.getNbSeries());
+	for (size_t i = 0; i < score.size(); ++i)
+	{
+		score[i] = (deviation[i] > 0) ? (pLatest[i] - average[i]) / deviation[i] : 0.;
+	}
+}
+
+void Trader::Indicator::bollinger(
+		const RateMatrix& matrix,
+		const size_t period,
+		const double nbDeviations,
+		std::vector<double>& lower,
+		std::vector<double>& middle,
+		std::vector<double>& upper,
+		const size_t lag)
+{
+	std::vector<double> deviation;
+	sma(matrix, period, middle, lag);
+	stddev(matrix, period, deviation, lag);
+
+	lower.resize(matrix.getNbSeries());
+	upper.resize(matrix.getNbSeries());
+	for (size_t i = 0; i < middle.size(); ++i)
+	{
+		lower[i] = middle[i] - nbDeviations * deviation[i];
+		upper[i] = middle[i] + nbDeviations * deviation[i];
+	}
+}
+
+const char* Trader::Indicator::getKernelName() noexcept
+{
+	return getKernels().m_pName;
+}
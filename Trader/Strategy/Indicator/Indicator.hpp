@@ -0,0 +1,62 @@
+#pragma once
+
+#include <vector>
+
+#include "Trader/Strategy/Indicator/RateSeries.hpp"
+
+namespace Trader
+{
+	/**
+	 * Technical indicators computed over all the series of a rate matrix at once.
+	 *
+	 * The window used is made of the last \p period samples of the matrix,
+	 * \p lag allows to shift it toward the past. The outputs are resized to
+	 * the number of series, the values of invalid series are meaningless.
+	 *
+	 * The kernels are selected at runtime depending on the CPU features.
+	 */
+	class Indicator
+	{
+	public:
+		/**
+		 * Simple moving average
+		 */
+		static void sma(const RateMatrix& matrix, const size_t period, std::vector<double>& average,
+				const size_t lag = 0);
+
+		/**
+		 * Exponential moving average, with a smoothing factor of 2 / (period + 1).
+		 * It is seeded with the oldest sample of the matrix.
+		 */
+		static void ema(const RateMatrix& matrix, const size_t period, std::vector<double>& average,
+				const size_t lag = 0);
+
+		/**
+		 * Standard deviation (population)
+		 */
+		static void stddev(const RateMatrix& matrix, const size_t period, std::vector<double>& deviation,
+				const size_t lag = 0);
+
+		static void minMax(const RateMatrix& matrix, const size_t period, std::vector<double>& min,
+				std::vector<double>& max, const size_t lag = 0);
+
+		/**
+		 * Distance of the latest sample of the window to its average, in standard deviations.
+		 * It is 0 if the rate did not move over the window.
+		 */
+		static void zScore(const RateMatrix& matrix, const size_t period, std::vector<double>& score,
+				const size_t lag = 0);
+
+		/**
+		 * Bollinger bands, \p nbDeviations standard deviations around the moving average
+		 */
+		static void bollinger(const RateMatrix& matrix, const size_t period, const double nbDeviations,
+				std::vector<double>& lower, std::vector<double>& middle, std::vector<double>& upper,
+				const size_t lag = 0);
+
+		/**
+		 * Name of the set of kernels in use
+		 */
+		static const char* getKernelName() noexcept;
+	};
+}
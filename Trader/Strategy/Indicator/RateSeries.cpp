@@ -0,0 +1,121 @@
+#include <algorithm>
+
+#include "Trader/Strategy/Indicator/RateSeries.hpp"
+
+IRSTD_TOPIC_USE_ALIAS(TraderIndicator, Trader, Indicator);
+
+// ---- Trader::RateSeries ----------------------------------------------------
+
+bool Trader::RateSeries::load(
+		const Transaction& transaction,
+		const IrStd::Type::Timestamp fromTimestamp,
+		const IrStd::Type::Timestamp toTimestamp)
+{
+	clear();
+	// Rates are delivered from the newest to the oldest
+	const bool isComplete = transaction.getRates(fromTimestamp, toTimestamp,
+			[&](const IrStd::Type::Timestamp timestamp, const IrStd::Type::Decimal rate) {
+				push(timestamp, static_cast<double>(rate));
+			});
+	std::reverse(m_timestampList.begin(), m_timestampList.end());
+	std::reverse(m_rateList.begin(), m_rateList.end());
+	return isComplete;
+}
+
+size_t Trader::RateSeries::load(
+		const Transaction& transaction,
+		const size_t nbSamples)
+{
+	clear();
+	const int nbRates = static_cast<int>(std::min(nbSamples, transaction.getNbRates()));
+	for (int position = -nbRates + 1; position <= 0; ++position)
+	{
+		push(transaction.getTimestamp(position), static_cast<double>(transaction.getRate(position)));
+	}
+	return size();
+}
+
+void Trader::RateSeries::push(
+		const IrStd::Type::Timestamp timestamp,
+		const double rate)
+{
+	m_timestampList.push_back(static_cast<uint64_t>(timestamp));
+	m_rateList.push_back(rate);
+}
+
+void Trader::RateSeries::clear() noexcept
+{
+	m_timestampList.clear();
+	m_rateList.clear();
+}
+
+size_t Trader::RateSeries::size() const noexcept
+{
+	return m_rateList.size();
+}
+
+const uint64_t* Trader::RateSeries::getTimestamps() const noexcept
+{
+	return m_timestampList.data();
+}
+
+const double* Trader::RateSeries::getRates() const noexcept
+{
+	return m_rateList.data();
+}
+
+// ---- Trader::RateMatrix ----------------------------------------------------
+
+Trader::RateMatrix::RateMatrix(
+		const size_t nbSeries,
+		const size_t length)
+		: m_nbSeries(nbSeries)
+		, m_length(length)
+		, m_data(nbSeries * length, 0.)
+		, m_isValidList(nbSeries, false)
+{
+	IRSTD_THROW_ASSERT(TraderIndicator, nbSeries && length, "A rate matrix cannot be empty");
+}
+
+bool Trader::RateMatrix::set(
+		const size_t index,
+		const RateSeries& series)
+{
+	IRSTD_THROW_ASSERT(TraderIndicator, index < m_nbSeries, "Series #" << index
+			<< " is out of bound, the matrix has " << m_nbSeries << " series");
+
+	const bool isValid = (series.size() >= m_length);
+	const double* const pRate = series.getRates() + series.size() - std::min(series.size(), m_length);
+	for (size_t sample = 0; sample < m_length; ++sample)
+	{
+		m_data[sample * m_nbSeries + index] = (isValid) ? pRate[sample] : 0.;
+	}
+	m_isValidList[index] = isValid;
+
+	return isValid;
+}
+
+bool Trader::RateMatrix::isValid(const size_t index) const noexcept
+{
+	return (index < m_nbSeries && m_isValidList[index]);
+}
+
+size_t Trader::RateMatrix::getNbSeries() const noexcept
+{
+	return m_nbSeries;
+}
+
+size_t Trader::RateMatrix::getLength() const noexcept
+{
+	return m_length;
+}
+
+const double* Trader::RateMatrix::getData() const noexcept
+{
+	return m_data.data();
+}
+
+const double* Trader::RateMatrix::getSample(const size_t sample) const noexcept
+{
+	return m_data.data() + sample * m_nbSeries;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <vector>
+
+#include "Trader/Exchange/Transaction/Transaction.hpp"
+
+namespace Trader
+{
+	/**
+	 * Rate history of a transaction copied into contiguous arrays,
+	 * timestamps and rates are stored separately, the oldest first.
+	 */
+	class RateSeries
+	{
+	public:
+		/**
+		 * Load the rates between 2 timestamps, \p fromTimestamp being the newest.
+		 *
+		 * \return true if all the samples asked have been delivered, false otherwise.
+		 */
+		bool load(const Transaction& transaction, const IrStd::Type::Timestamp fromTimestamp,
+				const IrStd::Type::Timestamp toTimestamp);
+
+		/**
+		 * Load the last \p nbSamples rates, the current one included.
+		 *
+		 * \return The number of samples loaded, it can be less if the history is not long enough.
+		 */
+		size_t load(const Transaction& transaction, const size_t nbSamples);
+
+		/**
+		 * Append a newer rate
+		 */
+		void push(const IrStd::Type::Timestamp timestamp, const double rate);
+
+		void clear() noexcept;
+		size_t size() const noexcept;
+
+		const uint64_t* getTimestamps() const noexcept;
+		const double* getRates() const noexcept;
+
+	private:
+		std::vector<uint64_t> m_timestampList;
+		std::vector<double> m_rateList;
+	};
+
+	/**
+	 * Last rates of several series of the same length, to compute
+	 * indicators of many pairs at once.
+	 * The data is stored by sample: the rates of all the series for a
+	 * given sample are contiguous, the first sample being the oldest.
+	 */
+	class RateMatrix
+	{
+	public:
+		RateMatrix(const size_t nbSeries, const size_t length);
+
+		/**
+		 * Copy the last rates of \p series into the column \p index.
+		 *
+		 * \return false if the series is too short, the column is then invalid.
+		 */
+		bool set(const size_t index, const RateSeries& series);
+
+		bool isValid(const size_t index) const noexcept;
+		size_t getNbSeries() const noexcept;
+		size_t getLength() const noexcept;
+
+		const double* getData() const noexcept;
+		const double* getSample(const size_t sample) const noexcept;
+
+	private:
+		const size_t m_nbSeries;
+		const size_t m_length;
+		std::vector<double> m_data;
+		// Not a vector<bool>, to be able to write each entry independently
+		std::vector<char> m_isValidList;
+	};
+}
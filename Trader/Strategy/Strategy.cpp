@@ -1,5 +1,6 @@
 #include "Trader/Strategy/Strategy.hpp"
 #include "Trader/Manager/Manager.hpp"
+#include "Trader/Generic/Writer/AsyncWriter.hpp"
 #include "Trader/Exchange/Operation/OperationOrder.hpp"
 #include "Trader/Exchange/Transaction/WithdrawTransaction.hpp"
 
@@ -10,8 +11,27 @@ Trader::Strategy::Strategy(const Id type, ConfigurationStrategy&& config)
 		: m_type(type)
 		, m_id(generateUniqueId(type))
 		, m_configuration(std::move(config))
+		, m_recordDirectory(Manager::getGlobalOutputDirectory())
+		, m_pContextPool(std::make_shared<ContextPool>())
+		, m_nbPendingTriggers(0)
+		, m_firstPendingTriggerUs(0)
+		, m_nbMissedTriggers(0)
+		, m_profitVersion(0)
 		, m_status(Status::UNINITIALIZED)
+		, m_pQuoteBook(nullptr)
 {
+	auto& metrics = Metrics::getDefault();
+	const Metrics::Labels labels{{"strategy", m_id.c_str()}};
+	m_metricList.push_back(metrics.add("trader_strategy_process_seconds",
+			"Duration of the processing of the strategy", labels, m_processLatency));
+	m_metricList.push_back(metrics.add("trader_strategy_trigger_seconds",
+			"Delay between a trigger and the start of the processing", labels, m_triggerLatency));
+	m_metricList.push_back(metrics.add("trader_strategy_missed_triggers_total",
+			"Number of triggers merged because the processing was overrunning", labels,
+			[this]() { return static_cast<double>(getNbMissedTriggers()); }, Metrics::Type::COUNTER));
+	m_metricList.push_back(metrics.add("trader_strategy_process_time_ratio",
+			"Fraction of the time spent processing", labels,
+			[this]() { return getProcessTimePercent() / 100.; }));
 }
 
 void Trader::Strategy::setup(std::vector<std::shared_ptr<Exchange>>& exchangeList)
@@ -39,6 +59,16 @@ void Trader::Strategy::setup(std::vector<std::shared_ptr<Exchange>>& exchangeLis
 	});
 }
 
+void Trader::Strategy::setup(std::shared_ptr<Exchange> pExchange)
+{
+	IRSTD_ASSERT(TraderStrategy, m_status == Status::UNINITIALIZED,
+			"Can only setup the strategy when uninitialized");
+	IRSTD_ASSERT(TraderStrategy, m_exchangeList.empty(),
+			"The exchange list has laready been initialized");
+	const auto id = pExchange->getId();
+	m_exchangeList.insert(std::make_pair(id, ExchangeInfo(pExchange)));
+}
+
 Trader::Id Trader::Strategy::generateUniqueId(const Id type)
 {
 	static std::mutex mutex;
@@ -63,6 +93,11 @@ const Trader::ConfigurationStrategy& Trader::Strategy::getConfiguration() const
 	return m_configuration;
 }
 
+Trader::ContextPool& Trader::Strategy::getContextPool() const noexcept
+{
+	return *m_pContextPool;
+}
+
 Trader::Id Trader::Strategy::getType() const noexcept
 {
 	return m_type;
@@ -73,6 +108,16 @@ Trader::Id Trader::Strategy::getId() const noexcept
 	return m_id;
 }
 
+const std::string& Trader::Strategy::getRecordDirectory() const noexcept
+{
+	return m_recordDirectory;
+}
+
+void Trader::Strategy::setRecordDirectory(const std::string& directory)
+{
+	m_recordDirectory = directory;
+}
+
 void Trader::Strategy::initialize()
 {
 	initializeImpl();
@@ -86,6 +131,21 @@ void Trader::Strategy::process(const size_t counter)
 {
 	IRSTD_ASSERT(TraderStrategy, m_status == Status::INITIALIZED,
 			"Strategy must be initilaized first");
+
+	const uint64_t startUs = LatencyHistogram::nowUs();
+	{
+		const uint64_t triggerUs = m_firstPendingTriggerUs.exchange(0);
+		const size_t nbTriggers = m_nbPendingTriggers.exchange(0);
+		if (triggerUs)
+		{
+			m_triggerLatency.record((startUs > triggerUs) ? startUs - triggerUs : 0);
+		}
+		if (nbTriggers > 1)
+		{
+			m_nbMissedTriggers += nbTriggers - 1;
+		}
+	}
+
 	try
 	{
 		IrStd::Type::Stopwatch scope(m_processTime, /*autoStart*/true);
@@ -96,6 +156,7 @@ void Trader::Strategy::process(const size_t counter)
 		IRSTD_LOG_FATAL(TraderStrategy, "Exception thrown by " << getId()
 				<< ": " << e.what());
 	}
+	m_processLatency.record(LatencyHistogram::nowUs() - startUs);
 }
 
 double Trader::Strategy::getProcessTimePercent() const noexcept
@@ -107,34 +168,61 @@ double Trader::Strategy::getProcessTimePercent() const noexcept
 	return m_processTime.getMs() / (1. * m_totalTime.get().getMs()) * 100.;
 }
 
+void Trader::Strategy::trigger() noexcept
+{
+	trigger(LatencyHistogram::nowUs());
+}
+
+void Trader::Strategy::trigger(const uint64_t timestampUs) noexcept
+{
+	uint64_t noTrigger = 0;
+	m_firstPendingTriggerUs.compare_exchange_strong(noTrigger, timestampUs);
+	m_nbPendingTriggers++;
+}
+
+const Trader::LatencyHistogram& Trader::Strategy::getProcessLatency() const noexcept
+{
+	return m_processLatency;
+}
+
+const Trader::LatencyHistogram& Trader::Strategy::getTriggerLatency() const noexcept
+{
+	return m_triggerLatency;
+}
+
+size_t Trader::Strategy::getNbMissedTriggers() const noexcept
+{
+	return m_nbMissedTriggers;
+}
+
+uint64_t Trader::Strategy::getProfitVersion() const noexcept
+{
+	return m_profitVersion.load(std::memory_order_acquire);
+}
+
 const IrStd::Json& Trader::Strategy::getJson() const
 {
 	const static IrStd::Json json;
 	return json;
 }
 
-void Trader::Strategy::getProfitInJson(IrStd::Json& json) const
+void Trader::Strategy::getProfitInJson(JsonWriter& json) const
 {
-	const IrStd::Type::Gson emptyArray;
-	json.add("list", emptyArray);
-
+	json.beginObject().key("list").beginArray();
 	for (const auto& it : m_exchangeList)
 	{
 		const auto& entry = it.second;
-		IrStd::Json statistics;
+		json.beginObject();
 		// Add the profit
-		{
-			IrStd::Json jsonExchangeProfit;
-			entry.m_profit.toJson(jsonExchangeProfit, entry.m_pExchange.get());
-			statistics.add("profit", jsonExchangeProfit);
-		}
+		json.key("profit");
+		entry.m_profit.toJson(json, entry.m_pExchange.get());
 		// Add statistics
-		statistics.add("nbSuccess", entry.m_nbSuccess);
-		statistics.add("nbFailedTimeout", entry.m_nbFailedTimeout);
-		statistics.add("nbFailedPlaceOrder", entry.m_nbFailedPlaceOrder);
-
-		json.getArray("list").add(json, statistics);
+		json.member("nbSuccess", static_cast<uint64_t>(entry.m_nbSuccess))
+				.member("nbFailedTimeout", static_cast<uint64_t>(entry.m_nbFailedTimeout))
+				.member("nbFailedPlaceOrder", static_cast<uint64_t>(entry.m_nbFailedPlaceOrder))
+				.endObject();
 	}
+	json.endArray().endObject();
 }
 
 Trader::OperationContextHandle Trader::Strategy::sell(
@@ -213,6 +301,7 @@ Trader::OperationContextHandle Trader::Strategy::sell(
 
 		// Record the operation
 		recordOperation(operationStatus, curContext, profitEstimate, entry.m_pExchange->getEstimateCurrency());
+		m_profitVersion.fetch_add(1, std::memory_order_release);
 		IRSTD_LOG_INFO(TraderStrategy, "Total profit estimation for " << getId() << ": "
 				<< totalProfitEstimate << " " << entry.m_pExchange->getEstimateCurrency());
 	});
@@ -248,7 +337,7 @@ void Trader::Strategy::recordOperation(
 		currency,
 		std::string(context.getDescription())
 	};
-	m_operationRecordList.push(IrStd::Type::Timestamp::now(), state);
+	m_operationRecordList.push(Clock::getDefault()->now(), state);
 }
 
 void Trader::Strategy::getRecordedOperations(const std::function<void(
@@ -303,6 +392,11 @@ Trader::Exchange& Trader::Strategy::getExchange() noexcept
 	return *(m_exchangeList.begin()->second.m_pExchange);
 }
 
+const Trader::QuoteBook* Trader::Strategy::getQuoteBook() const noexcept
+{
+	return m_pQuoteBook;
+}
+
 Trader::Exchange& Trader::Strategy::getExchange(const Id id) noexcept
 {
 	auto it = m_exchangeList.find(id);
@@ -321,15 +415,16 @@ void Trader::Strategy::monitorProfit(
 		const CurrencyPtr currencyEstimate,
 		const IrStd::Type::Decimal profitEstimate)
 {
-	static std::mutex mutex;
-	std::lock_guard<std::mutex> lock(mutex);
+	if (strategy.getRecordDirectory().empty())
+	{
+		return;
+	}
 
-	// Open the file and populate it with the data
+	// Queue the data to the file, the writer thread does the actual write
 	{
-		std::string path = Trader::Manager::getGlobalOutputDirectory();
+		std::string path = strategy.getRecordDirectory();
 		IrStd::FileSystem::append(path, "profit.csv");
-		IrStd::FileSystem::FileCsv file(path);
-		file.write(static_cast<uint64_t>(IrStd::Type::Timestamp::now()),
+		AsyncWriter::getDefault().writeCsv(path, static_cast<uint64_t>(Clock::getDefault()->now()),
 				strategy.getId(), contextId, currency, profit,
 				currencyEstimate, profitEstimate);
 	}
@@ -4,7 +4,9 @@
 
 #include "Trader/Exchange/Exchange.hpp"
 #include "Trader/Exchange/Order/Order.hpp"
+#include "Trader/Generic/Histogram/LatencyHistogram.hpp"
 #include "Trader/Generic/Id/Id.hpp"
+#include "Trader/Generic/Metrics/Metrics.hpp"
 
 #include "Trader/Strategy/ConfigurationStrategy.hpp"
 
@@ -14,6 +16,7 @@ namespace Trader
 	{
 		class Strategy;
 	}
+	class QuoteBook;
 
 	class Strategy
 	{
@@ -36,6 +39,15 @@ namespace Trader
 		 */
 		Id getId() const noexcept;
 
+		/**
+		 * \brief Directory where the transactions and profits are recorded
+		 *
+		 * It defaults to the global output directory, an empty string disables
+		 * the recording. It only applies to the operations created afterwards.
+		 */
+		const std::string& getRecordDirectory() const noexcept;
+		void setRecordDirectory(const std::string& directory);
+
 		virtual void initializeImpl() = 0;
 
 		/**
@@ -83,16 +95,47 @@ namespace Trader
 		 */
 		Exchange& getExchange() noexcept;
 
+		/**
+		 * Best rates across all the exchanges of the manager,
+		 * nullptr if the strategy does not run within a manager.
+		 */
+		const QuoteBook* getQuoteBook() const noexcept;
+
 		/**
 		 * Return the configuration associated with this strategy
 		 */
 		const ConfigurationStrategy& getConfiguration() const noexcept;
 
+		/**
+		 * Pool from which the operation contexts of this strategy are allocated
+		 */
+		ContextPool& getContextPool() const noexcept;
+
 		/**
 		 * Get the processign time in percent of this strategy
 		 */
 		double getProcessTimePercent() const noexcept;
 
+		/**
+		 * Duration of each call to processImpl
+		 */
+		const LatencyHistogram& getProcessLatency() const noexcept;
+
+		/**
+		 * Delay between the trigger (new rates for example) and the start of the processing
+		 */
+		const LatencyHistogram& getTriggerLatency() const noexcept;
+
+		/**
+		 * Number of triggers not processed because the processing was overrunning
+		 */
+		size_t getNbMissedTriggers() const noexcept;
+
+		/**
+		 * Incremented each time the profit or the operation statistics change
+		 */
+		uint64_t getProfitVersion() const noexcept;
+
 		/**
 		 * Returns records related to operations
 		 */
@@ -101,15 +144,36 @@ namespace Trader
 
 	private:
 		friend class Manager;
+		friend class Backtest;
 		friend class EndPoint::Strategy;
 
 		IrStd::Type::Stopwatch m_totalTime;
 		IrStd::Type::Stopwatch::Counter m_processTime;
+		LatencyHistogram m_processLatency;
+		LatencyHistogram m_triggerLatency;
+		std::atomic<size_t> m_nbPendingTriggers;
+		std::atomic<uint64_t> m_firstPendingTriggerUs;
+		std::atomic<size_t> m_nbMissedTriggers;
+		std::atomic<uint64_t> m_profitVersion;
+
+		/**
+		 * Notify the strategy that it should process, this can be called from any thread.
+		 * Triggers received until the processing starts are merged, all but one are missed.
+		 */
+		void trigger() noexcept;
+		/**
+		 * Same as trigger(), for an event that occurred at \p timestampUs (see LatencyHistogram::nowUs)
+		 */
+		void trigger(const uint64_t timestampUs) noexcept;
 
 		/**
 		 * Setup the strategy and assing the exchanges
 		 */
 		void setup(std::vector<std::shared_ptr<Exchange>>& exchangeList);
+		/**
+		 * Setup the strategy with a single exchange, regardless of the configuration
+		 */
+		void setup(std::shared_ptr<Exchange> pExchange);
 		void initialize();
 		void process(const size_t counter);
 
@@ -126,7 +190,7 @@ namespace Trader
 		/**
 		 * Return the profit made by this strategy
 		 */
-		void getProfitInJson(IrStd::Json& json) const;
+		void getProfitInJson(JsonWriter& json) const;
 
 		enum class OperationStatus
 		{
@@ -148,6 +212,8 @@ namespace Trader
 		Id m_type;
 		Id m_id;
 		ConfigurationStrategy m_configuration;
+		std::string m_recordDirectory;
+		std::shared_ptr<ContextPool> m_pContextPool;
 
 		/**
 		 * Statuses of the strategy
@@ -158,6 +224,7 @@ namespace Trader
 			INITIALIZED = 1
 		};
 		Status m_status;
+		const QuoteBook* m_pQuoteBook;
 
 		/**
 		 * Structure coresponding to the exchange
@@ -194,5 +261,8 @@ namespace Trader
 			std::string m_description;
 		};
 		IrStd::Type::RingBufferSorted<IrStd::Type::Timestamp, OperationState, NB_RECORDS> m_operationRecordList;
+
+		// Declared last, to be unregistered before the metrics are destroyed
+		std::vector<Metrics::Registration> m_metricList;
 	};
 }
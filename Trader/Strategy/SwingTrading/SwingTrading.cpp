@@ -1,5 +1,6 @@
 #include "IrStd/IrStd.hpp"
 #include "Trader/Strategy/SwingTrading/SwingTrading.hpp"
+#include "Trader/Strategy/Indicator/Indicator.hpp"
 
 IRSTD_TOPIC_REGISTER(Trader, Strategy, SwingTrading);
 IRSTD_TOPIC_USE_ALIAS(TraderSwingTrading, Trader, Strategy, SwingTrading);
@@ -21,7 +22,9 @@ void Trader::SwingTrading::initializeImpl()
 
 void Trader::SwingTrading::processImpl(const size_t /*counter*/)
 {
-	eachExchanges([this](const Id id) {
+	const double minProfitPercent = getConfiguration().getJson().getNumber("minProfitPercent");
+
+	eachExchanges([this, minProfitPercent](const Id id) {
 		auto& exchange = getExchange(id);
 
 		// Only operates on EUR/BTC pair
@@ -32,21 +35,24 @@ void Trader::SwingTrading::processImpl(const size_t /*counter*/)
 			const auto curRate = pTransaction->getRate();
 
 			// Look for the last 5 samples
-			const auto avgCurrent = (curRate
-					+ pTransaction->getRate(-1)
-					+ pTransaction->getRate(-2)
-					+ pTransaction->getRate(-3)
-					+ pTransaction->getRate(-4)) / 5.;
-			const auto avgMinus1 = (pTransaction->getRate(-1)
-					+ pTransaction->getRate(-2)
-					+ pTransaction->getRate(-3)
-					+ pTransaction->getRate(-4)
-					+ pTransaction->getRate(-5)) / 5.;
-			const auto avgMinus2 = (pTransaction->getRate(-2)
-					+ pTransaction->getRate(-3)
-					+ pTransaction->getRate(-4)
-					+ pTransaction->getRate(-5)
-					+ pTransaction->getRate(-6)) / 5.;
+			RateSeries series;
+			RateMatrix matrix(/*nbSeries*/1, /*length*/7);
+			series.load(*pTransaction, matrix.getLength());
+			// The history might be shorter than checked above, if it has been reset meanwhile
+			if (!matrix.set(0, series) || !matrix.isValid(0))
+			{
+				IRSTD_LOG_DEBUG(TraderSwingTrading, exchange.getId() << ": not enough rates to compute the averages ("
+						<< series.size() << "/" << matrix.getLength() << ")");
+				return;
+			}
+
+			std::vector<double> average;
+			Indicator::sma(matrix, /*period*/5, average);
+			const auto avgCurrent = average[0];
+			Indicator::sma(matrix, /*period*/5, average, /*lag*/1);
+			const auto avgMinus1 = average[0];
+			Indicator::sma(matrix, /*period*/5, average, /*lag*/2);
+			const auto avgMinus2 = average[0];
 
 			// Detect a low swing value
 			if (avgMinus2 < avgMinus1 && avgMinus1 > avgCurrent)
@@ -59,7 +65,7 @@ void Trader::SwingTrading::processImpl(const size_t /*counter*/)
 				{
 					order.setTimeout(300);
 					const auto pTransactionInverse = exchange.getTransactionMap().getTransaction(Currency::BTC, Currency::EUR);
-					Order orderInverse(pTransactionInverse, (1. / curRate) * 1.01);
+					Order orderInverse(pTransactionInverse, (1. / curRate) * (1. + minProfitPercent / 100.));
 					orderInverse.setTimeout(99999999999);
 					order.addNext(orderInverse);
 				}
@@ -4,6 +4,8 @@
 #include "Trader/Strategy/SwingTrading/SwingTrading.hpp"
 #include "Trader/Strategy/Dummy/Dummy.hpp"
 
+#include "Trader/Strategy/Indicator/Indicator.hpp"
+
 #include "Trader/Exchange/Currency/Currency.hpp"
 #include "Trader/Exchange/Exchange.hpp"
 #include "Trader/Exchange/ExchangeMock.hpp"
@@ -19,6 +21,11 @@
 #include "Trader/ExchangeImpl/Bitfinex/ExchangeBitfinex.hpp"
 #include "Trader/ExchangeImpl/Bitstamp/ExchangeBitstamp.hpp"
 #include "Trader/ExchangeImpl/Kraken/ExchangeKraken.hpp"
+#include "Trader/ExchangeImpl/Backtest/ExchangeBacktest.hpp"
+
+#include "Trader/Backtest/RateHistory.hpp"
+#include "Trader/Backtest/Backtest.hpp"
+#include "Trader/Backtest/Sweep.hpp"
 
 #include "Trader/Server/Server.hpp"
 #include "Trader/Manager/Manager.hpp"
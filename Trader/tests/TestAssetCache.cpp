@@ -0,0 +1,143 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <zlib.h>
+
+#include "Trader/tests/TestBase.hpp"
+#include "Trader/Server/AssetCache.hpp"
+
+class AssetCacheTest : public Trader::TestBase
+{
+public:
+	void SetUp()
+	{
+		Trader::TestBase::SetUp();
+		m_directory = createTemporaryDirectory("asset");
+		ASSERT_EQ(::mkdir((m_directory + "/js").c_str(), 0755), 0);
+	}
+
+	void write(const char* const pUri, const std::string& content)
+	{
+		std::ofstream file(m_directory + pUri, std::ios::binary);
+		file << content;
+	}
+
+	static std::string gunzip(const std::string& data)
+	{
+		z_stream stream;
+		std::memset(&stream, 0, sizeof(stream));
+		EXPECT_EQ(inflateInit2(&stream, 15 + 16), Z_OK);
+
+		std::string output;
+		char buffer[4096];
+		stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+		stream.avail_in = static_cast<uInt>(data.size());
+		int result;
+		do
+		{
+			stream.next_out = reinterpret_cast<Bytef*>(buffer);
+			stream.avail_out = sizeof(buffer);
+			result = inflate(&stream, Z_NO_FLUSH);
+			output.append(buffer, sizeof(buffer) - stream.avail_out);
+		} while (result == Z_OK);
+		inflateEnd(&stream);
+		EXPECT_EQ(result, Z_STREAM_END);
+		return output;
+	}
+
+	/**
+	 * Wait for the watch thread to apply a change
+	 */
+	template<class Predicate>
+	static bool waitFor(Predicate predicate)
+	{
+		for (size_t i = 0; i < 200 && !predicate(); ++i)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+		return predicate();
+	}
+
+protected:
+	std::string m_directory;
+};
+
+// ---- testLoad --------------------------------------------------------------
+
+TEST_F(AssetCacheTest, testLoad)
+{
+	std::string html("<html>");
+	for (size_t i = 0; i < 100; ++i)
+	{
+		html.append("<p>Hello World</p>");
+	}
+	html.append("</html>");
+	write("/index.html", html);
+	write("/js/app.js", "1");
+
+	Trader::AssetCache cache(m_directory, /*isWatch*/false);
+	ASSERT_EQ(cache.getNbAssets(), 2u);
+	ASSERT_FALSE(cache.get("/missing.html"));
+
+	const auto pHtml = cache.get("/index.html");
+	ASSERT_TRUE(pHtml);
+	ASSERT_EQ(pHtml->m_content, html);
+	ASSERT_FALSE(pHtml->m_etag.empty());
+	ASSERT_LT(pHtml->m_contentGzip.size(), html.size());
+	ASSERT_EQ(gunzip(pHtml->m_contentGzip), html);
+
+	// Compressing a single byte is not worth it
+	const auto pJs = cache.get("/js/app.js");
+	ASSERT_TRUE(pJs);
+	ASSERT_EQ(pJs->m_content, "1");
+	ASSERT_TRUE(pJs->m_contentGzip.empty());
+	ASSERT_NE(pJs->m_etag, pHtml->m_etag);
+}
+
+// ---- testEtag --------------------------------------------------------------
+
+TEST_F(AssetCacheTest, testEtag)
+{
+	const auto pAsset1 = Trader::AssetCache::create("content", "txt");
+	const auto pAsset2 = Trader::AssetCache::create("content", "txt");
+	const auto pAsset3 = Trader::AssetCache::create("Content", "txt");
+	ASSERT_EQ(pAsset1->m_etag, pAsset2->m_etag);
+	ASSERT_NE(pAsset1->m_etag, pAsset3->m_etag);
+	ASSERT_EQ(pAsset1->m_etag.front(), '"');
+	ASSERT_EQ(pAsset1->m_etag.back(), '"');
+}
+
+// ---- testWatch -------------------------------------------------------------
+
+TEST_F(AssetCacheTest, testWatch)
+{
+	write("/index.html", "v1");
+
+	Trader::AssetCache cache(m_directory);
+	const auto pOriginal = cache.get("/index.html");
+	ASSERT_TRUE(pOriginal);
+	ASSERT_EQ(pOriginal->m_content, "v1");
+
+	write("/index.html", "v2");
+	ASSERT_TRUE(waitFor([&]() {
+		const auto pAsset = cache.get("/index.html");
+		return pAsset && pAsset->m_content == "v2";
+	}));
+	// Previous readers keep their copy
+	ASSERT_EQ(pOriginal->m_content, "v1");
+
+	write("/new.css", "body {}");
+	ASSERT_TRUE(waitFor([&]() {
+		return static_cast<bool>(cache.get("/new.css"));
+	}));
+
+	std::remove((m_directory + "/new.css").c_str());
+	ASSERT_TRUE(waitFor([&]() {
+		return !cache.get("/new.css");
+	}));
+}
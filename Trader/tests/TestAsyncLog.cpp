@@ -0,0 +1,217 @@
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "Trader/tests/TestBase.hpp"
+#include "Trader/Generic/Log/AsyncLog.hpp"
+
+IRSTD_TOPIC_USE(Trader);
+IRSTD_TOPIC_REGISTER(Trader, AsyncLogTest);
+IRSTD_TOPIC_USE_ALIAS(TraderAsyncLogTest, Trader, AsyncLogTest);
+
+class AsyncLogTest : public Trader::TestBase
+{
+public:
+	void SetUp()
+	{
+		Trader::TestBase::SetUp();
+		std::lock_guard<std::mutex> lock(m_lock);
+		m_messageList.clear();
+		m_originList.clear();
+	}
+
+	static void emit(const std::string& str, const Trader::AsyncLog::Origin& origin)
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		m_messageList.push_back(str);
+		m_originList.push_back(origin);
+	}
+
+	static std::vector<std::string> getMessageList()
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		return m_messageList;
+	}
+
+	static std::vector<Trader::AsyncLog::Origin> getOriginList()
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		return m_originList;
+	}
+
+protected:
+	static std::mutex m_lock;
+	static std::vector<std::string> m_messageList;
+	static std::vector<Trader::AsyncLog::Origin> m_originList;
+};
+
+std::mutex AsyncLogTest::m_lock;
+std::vector<std::string> AsyncLogTest::m_messageList;
+std::vector<Trader::AsyncLog::Origin> AsyncLogTest::m_originList;
+
+namespace
+{
+	struct Large
+	{
+		char m_data[Trader::AsyncLog::SLOT_SIZE * 2];
+	};
+
+	std::ostream& operator<<(std::ostream& os, const Large&)
+	{
+		return os << "large";
+	}
+
+	struct Owner
+	{
+		std::shared_ptr<int> m_pValue;
+	};
+
+	std::ostream& operator<<(std::ostream& os, const Owner& owner)
+	{
+		return os << "owner=" << *owner.m_pValue;
+	}
+}
+
+// ---- testFormat ------------------------------------------------------------
+
+TEST_F(AsyncLogTest, testFormat)
+{
+	auto& log = Trader::AsyncLog::getDefault();
+	{
+		std::string str("temporary");
+		log.push(&AsyncLogTest::emit, Trader::AsyncLog::Capture<>() << "a=" << 42 << ", b=" << str.c_str());
+		str = "modified";
+	}
+	log.push(&AsyncLogTest::emit, Trader::AsyncLog::Capture<>() << std::showpos << 1.5);
+	log.push(&AsyncLogTest::emit, Trader::AsyncLog::Capture<>() << 2.5);
+	log.push(&AsyncLogTest::emit, Trader::AsyncLog::Capture<>() << Large() << "!");
+	log.flush();
+
+	ASSERT_EQ(getMessageList(), (std::vector<std::string>{"a=42, b=temporary", "+1.5", "2.5", "large!"}));
+
+	// The origin is the one of the log statement, not of the log thread
+	const auto originList = getOriginList();
+	ASSERT_EQ(originList.size(), 4u);
+	for (size_t i = 0; i < originList.size(); ++i)
+	{
+		ASSERT_EQ(originList[i].m_threadId, std::this_thread::get_id());
+		ASSERT_TRUE(i == 0 || originList[i - 1].m_timestampUs <= originList[i].m_timestampUs);
+	}
+}
+
+// ---- testLifetime ----------------------------------------------------------
+
+TEST_F(AsyncLogTest, testLifetime)
+{
+	auto& log = Trader::AsyncLog::getDefault();
+	Owner owner{std::make_shared<int>(12)};
+	log.push(&AsyncLogTest::emit, Trader::AsyncLog::Capture<>() << owner);
+
+	// The object is formatted by the log statement, not kept until the log thread runs
+	ASSERT_EQ(owner.m_pValue.use_count(), 1);
+	*owner.m_pValue = 13;
+	log.flush();
+	ASSERT_EQ(getMessageList(), (std::vector<std::string>{"owner=12"}));
+}
+
+// ---- testOrdering ----------------------------------------------------------
+
+TEST_F(AsyncLogTest, testOrdering)
+{
+	constexpr size_t NB_THREADS = 4;
+	constexpr size_t NB_MESSAGES = 3000;
+
+	std::vector<std::thread> threadList;
+	for (size_t t = 0; t < NB_THREADS; ++t)
+	{
+		threadList.emplace_back([t]() {
+			for (size_t i = 0; i < NB_MESSAGES; ++i)
+			{
+				Trader::AsyncLog::getDefault().push(&AsyncLogTest::emit,
+						Trader::AsyncLog::Capture<>() << t << " " << i);
+			}
+		});
+	}
+	for (auto& thread : threadList)
+	{
+		thread.join();
+	}
+	Trader::AsyncLog::getDefault().flush();
+
+	// Messages of a same thread keep their order
+	const auto messageList = getMessageList();
+	ASSERT_EQ(messageList.size(), NB_THREADS * NB_MESSAGES);
+	std::vector<size_t> nextList(NB_THREADS, 0);
+	for (const auto& message : messageList)
+	{
+		std::istringstream stream(message);
+		size_t t, i;
+		stream >> t >> i;
+		ASSERT_EQ(i, nextList[t]);
+		++nextList[t];
+	}
+}
+
+// ---- testLevel -------------------------------------------------------------
+
+TEST_F(AsyncLogTest, testLevel)
+{
+	// A topic of its own, to not change the configuration of the other tests
+	IrStd::Logger::getDefault().addTopic(TraderAsyncLogTest, IrStd::Logger::Level::Info);
+	ASSERT_TRUE(Trader::AsyncLog::isEnabled(TraderAsyncLogTest, IrStd::Logger::Level::Info));
+	ASSERT_FALSE(Trader::AsyncLog::isEnabled(TraderAsyncLogTest, IrStd::Logger::Level::Debug));
+
+	IrStd::Logger::getDefault().addTopic(TraderAsyncLogTest, IrStd::Logger::Level::Trace);
+	ASSERT_TRUE(Trader::AsyncLog::isEnabled(TraderAsyncLogTest, IrStd::Logger::Level::Trace));
+
+	IrStd::Logger::getDefault().addTopic(TraderAsyncLogTest, IrStd::Logger::Level::Error);
+	ASSERT_FALSE(Trader::AsyncLog::isEnabled(TraderAsyncLogTest, IrStd::Logger::Level::Warning));
+	ASSERT_TRUE(Trader::AsyncLog::isEnabled(TraderAsyncLogTest, IrStd::Logger::Level::Error));
+
+	// Filtered statements are not evaluated
+	size_t nbEvaluations = 0;
+	TRADER_LOG_INFO(TraderAsyncLogTest, "evaluated " << ++nbEvaluations);
+	ASSERT_EQ(nbEvaluations, 0u);
+
+	IrStd::Logger::getDefault().addTopic(TraderAsyncLogTest, IrStd::Logger::Level::Info);
+}
+
+// ---- testBenchmark ---------------------------------------------------------
+
+TEST_F(AsyncLogTest, testBenchmark)
+{
+	constexpr size_t NB_BURSTS = 100;
+	// Bursts smaller than the ring, to not measure the stalls
+	constexpr size_t BURST_SIZE = 512;
+
+	auto& log = Trader::AsyncLog::getDefault();
+	double durationSyncNs = 0;
+	double durationAsyncNs = 0;
+	for (size_t burst = 0; burst < NB_BURSTS; ++burst)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < BURST_SIZE; ++i)
+		{
+			std::ostringstream stream;
+			stream << "placing order#" << i << " at rate " << (1.2345 * i);
+			emit(stream.str(), Trader::AsyncLog::Origin{0, std::this_thread::get_id()});
+		}
+		const auto middle = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < BURST_SIZE; ++i)
+		{
+			log.push(&AsyncLogTest::emit, Trader::AsyncLog::Capture<>() << "placing order#" << i
+					<< " at rate " << (1.2345 * i));
+		}
+		const auto end = std::chrono::steady_clock::now();
+		durationSyncNs += std::chrono::duration<double, std::nano>(middle - start).count();
+		durationAsyncNs += std::chrono::duration<double, std::nano>(end - middle).count();
+		log.flush();
+	}
+
+	IRSTD_LOG_INFO(IRSTD_TOPIC(Trader), "Synchronous: " << (durationSyncNs / (NB_BURSTS * BURST_SIZE))
+			<< "ns/call, deferred: " << (durationAsyncNs / (NB_BURSTS * BURST_SIZE)) << "ns/call");
+	ASSERT_EQ(getMessageList().size(), NB_BURSTS * BURST_SIZE * 2);
+}
@@ -0,0 +1,92 @@
+#include <cstdlib>
+#include <fstream>
+
+#include "Trader/tests/TestBase.hpp"
+#include "Trader/Generic/Writer/AsyncWriter.hpp"
+
+class AsyncWriterTest : public Trader::TestBase
+{
+public:
+	void SetUp()
+	{
+		Trader::TestBase::SetUp();
+		m_directory = createTemporaryDirectory("writer");
+	}
+
+	std::string getPath(const char* const pFileName) const
+	{
+		return m_directory + "/" + pFileName;
+	}
+
+	std::vector<std::string> read(const char* const pFileName) const
+	{
+		std::vector<std::string> lineList;
+		std::ifstream file(getPath(pFileName));
+		std::string line;
+		while (std::getline(file, line))
+		{
+			lineList.push_back(line);
+		}
+		return lineList;
+	}
+
+protected:
+	std::string m_directory;
+};
+
+// ---- testWriteCsv ----------------------------------------------------------
+
+TEST_F(AsyncWriterTest, testWriteCsv)
+{
+	Trader::AsyncWriter writer;
+	writer.writeCsv(getPath("a.csv"), 12, "abc", 0.5);
+	writer.write(getPath("a.csv"), "raw");
+	writer.flush();
+
+	const auto lineList = read("a.csv");
+	ASSERT_EQ(lineList.size(), 2u);
+	ASSERT_EQ(lineList[0], "12,abc,0.5");
+	ASSERT_EQ(lineList[1], "raw");
+}
+
+// ---- testConcurrentWrites --------------------------------------------------
+
+TEST_F(AsyncWriterTest, testConcurrentWrites)
+{
+	constexpr size_t NB_THREADS = 4;
+	constexpr size_t NB_LINES = 5000;
+
+	// A short period and more lines than the queue can hold, to exercise the back-pressure
+	Trader::AsyncWriter writer(/*batchPeriodMs*/1);
+	std::vector<std::thread> threadList;
+	for (size_t index = 0; index < NB_THREADS; ++index)
+	{
+		threadList.emplace_back([&, index]() {
+			for (size_t i = 0; i < NB_LINES; ++i)
+			{
+				writer.writeCsv(getPath((i % 2) ? "a.csv" : "b.csv"), index, i);
+			}
+		});
+	}
+	for (auto& thread : threadList)
+	{
+		thread.join();
+	}
+	writer.flush();
+
+	const auto lineListA = read("a.csv");
+	const auto lineListB = read("b.csv");
+	ASSERT_EQ(lineListA.size() + lineListB.size(), NB_THREADS * NB_LINES);
+
+	// Lines of a same producer keep their order
+	size_t previous = 0;
+	for (const auto& line : lineListA)
+	{
+		if (line.compare(0, 2, "0,") == 0)
+		{
+			const size_t current = std::strtoul(line.c_str() + 2, nullptr, 10);
+			ASSERT_GT(current, previous);
+			previous = current;
+		}
+	}
+}
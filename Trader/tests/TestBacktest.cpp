@@ -0,0 +1,125 @@
+#include <fstream>
+
+#include "Trader/tests/TestBase.hpp"
+#include "Trader/Backtest/Backtest.hpp"
+#include "Trader/Backtest/Sweep.hpp"
+
+class BacktestTest : public Trader::TestBase
+{
+public:
+	void SetUp()
+	{
+		Trader::TestBase::SetUp();
+		m_directory = createTemporaryDirectory("backtest");
+	}
+
+	void record(const char* const pFileName, const std::initializer_list<std::pair<uint64_t, double>>& rateList)
+	{
+		std::string filePath(m_directory);
+		IrStd::FileSystem::append(filePath, pFileName);
+		std::ofstream file(filePath);
+		for (const auto& rate : rateList)
+		{
+			file << rate.first << "," << rate.second << std::endl;
+		}
+	}
+
+protected:
+	std::string m_directory;
+};
+
+// ---- testTimeline ----------------------------------------------------------
+
+TEST_F(BacktestTest, testTimeline)
+{
+	record("pair-BTC-USD.csv", {{1000, 5000}, {3000, 5100}, {5000, 5050}});
+	record("pair-USD-BTC.csv", {{2000, 1. / 5010}, {4000, 1. / 5110}});
+	record("ignored.csv", {{1000, 1}});
+
+	Trader::RateHistory history(m_directory);
+	ASSERT_EQ(history.getPairs().size(), 1u);
+	ASSERT_TRUE(history.getPairs()[0].m_isRecorded);
+	ASSERT_TRUE(history.getPairs()[0].m_isInvertedRecorded);
+	ASSERT_EQ(history.getTicks().size(), 5u);
+	ASSERT_EQ(history.getFirstTimestamp(), IrStd::Type::Timestamp(1000));
+	ASSERT_EQ(history.getLastTimestamp(), IrStd::Type::Timestamp(5000));
+
+	for (size_t i = 1; i < history.getTicks().size(); ++i)
+	{
+		ASSERT_TRUE(history.getTicks()[i - 1].m_timestamp <= history.getTicks()[i].m_timestamp);
+	}
+}
+
+// ---- testDeterministic -----------------------------------------------------
+
+TEST_F(BacktestTest, testDeterministic)
+{
+	record("pair-BTC-USD.csv", {{1000, 5000}, {2000, 5100}, {3000, 5050}, {4000, 4990}});
+	record("pair-ETH-BTC.csv", {{1500, 0.07}, {2500, 0.071}, {3500, 0.069}});
+
+	auto pHistory = std::make_shared<const Trader::RateHistory>(m_directory);
+	Trader::Backtest backtest(pHistory);
+
+	const auto report1 = backtest.run<Trader::Dummy>();
+	const auto report2 = backtest.run<Trader::Dummy>();
+
+	ASSERT_EQ(report1.m_nbTicks, 7u);
+	// The first 3 ticks are replayed while connecting, the strategy processes each of the next ones
+	ASSERT_EQ(report1.m_nbProcess, 4u);
+	ASSERT_EQ(report1.m_nbTicks, report2.m_nbTicks);
+	ASSERT_EQ(report1.m_nbProcess, report2.m_nbProcess);
+	ASSERT_EQ(report1.m_initialEstimate, report2.m_initialEstimate);
+	ASSERT_EQ(report1.m_finalEstimate, report2.m_finalEstimate);
+
+	// Without any opportunity, the profit only comes from the rates. The initial balance is evenly
+	// distributed between USD, BTC and ETH at the rates known when connecting (BTC=5100 USD, ETH=0.07 BTC).
+	const auto report3 = backtest.run<Trader::Dummy>({{"buyMinSpreadPercent", 200.}});
+	const double valuePerCurrency = Trader::ExchangeBacktest::INITIAL_BALANCE_VALUE / 3;
+	const double expectedFinalEstimate = valuePerCurrency * (1. + 4990. / 5100. + (0.069 * 4990.) / (0.07 * 5100.));
+	ASSERT_EQ(report3.m_nbProcess, 4u);
+	ASSERT_NEAR(static_cast<double>(report3.m_initialEstimate), Trader::ExchangeBacktest::INITIAL_BALANCE_VALUE, 0.0001);
+	ASSERT_NEAR(static_cast<double>(report3.getProfit()),
+			expectedFinalEstimate - Trader::ExchangeBacktest::INITIAL_BALANCE_VALUE, 0.0001);
+}
+
+// ---- testNoRecord ----------------------------------------------------------
+
+TEST_F(BacktestTest, testNoRecord)
+{
+	record("pair-BTC-USD.csv", {{1000, 5000}, {2000, 5100}, {3000, 5050}});
+
+	auto pHistory = std::make_shared<const Trader::RateHistory>(m_directory);
+	Trader::Backtest backtest(pHistory);
+
+	Trader::Dummy strategy(IrStd::Type::Gson::Map{});
+	ASSERT_FALSE(strategy.getRecordDirectory().empty());
+	backtest.run(strategy);
+	ASSERT_TRUE(strategy.getRecordDirectory().empty());
+}
+
+// ---- testSweep -------------------------------------------------------------
+
+TEST_F(BacktestTest, testSweep)
+{
+	record("pair-BTC-USD.csv", {{1000, 5000}, {2000, 5100}, {3000, 5050}, {4000, 4990}});
+
+	auto pHistory = std::make_shared<const Trader::RateHistory>(m_directory);
+	Trader::Sweep sweep(pHistory, /*nbThreads*/4);
+	sweep.addParameter("sellProfitPercent", {0.5, 1., 2.});
+	sweep.addParameter("buyMinSpreadPercent", 0.1, 0.5, /*nbSteps*/2);
+
+	const auto resultList = sweep.runGrid<Trader::Dummy>();
+	ASSERT_EQ(resultList.size(), 6u);
+	for (size_t i = 0; i < resultList.size(); ++i)
+	{
+		ASSERT_EQ(resultList[i].m_parameterSet.size(), 2u);
+		ASSERT_EQ(resultList[i].m_report.m_nbTicks, 4u);
+		if (i)
+		{
+			ASSERT_TRUE(resultList[i - 1].m_report.getProfit() >= resultList[i].m_report.getProfit());
+		}
+	}
+
+	const auto randomList = sweep.runRandom<Trader::Dummy>(/*nbSamples*/5, /*seed*/42);
+	ASSERT_EQ(randomList.size(), 5u);
+}
@@ -0,0 +1,155 @@
+#include <atomic>
+#include <thread>
+
+#include "Trader/tests/TestBase.hpp"
+#include "Trader/Exchange/Balance/Balance.hpp"
+
+class BalanceTest : public Trader::TestBase
+{
+};
+
+// ---- testReadWrite ---------------------------------------------------------
+
+TEST_F(BalanceTest, testReadWrite)
+{
+	Trader::Balance balance;
+	ASSERT_TRUE(balance.empty());
+
+	balance.set(Trader::Currency::EUR, 100);
+	balance.add(Trader::Currency::EUR, 20);
+	balance.add(Trader::Currency::BTC, 1.5);
+	balance.reserve(Trader::Currency::EUR, 30);
+	ASSERT_FALSE(balance.empty());
+
+	ASSERT_EQ(static_cast<double>(balance.getWithReserve(Trader::Currency::EUR)), 120.);
+	ASSERT_EQ(static_cast<double>(balance.get(Trader::Currency::EUR)), 90.);
+	ASSERT_EQ(static_cast<double>(balance.get(Trader::Currency::BTC)), 1.5);
+	ASSERT_EQ(static_cast<double>(balance.get(Trader::Currency::USD)), 0.);
+
+	size_t nbCurrencies = 0;
+	balance.getCurrencies([&](const Trader::CurrencyPtr currency) {
+		ASSERT_TRUE(currency == Trader::Currency::EUR || currency == Trader::Currency::BTC);
+		++nbCurrencies;
+	});
+	ASSERT_EQ(nbCurrencies, 2u);
+
+	// Copy the funds only, the reserve is kept
+	Trader::Balance other;
+	other.set(Trader::Currency::USD, 10);
+	balance.setFunds(other);
+	ASSERT_EQ(static_cast<double>(balance.getWithReserve(Trader::Currency::EUR)), 0.);
+	ASSERT_EQ(static_cast<double>(balance.getWithReserve(Trader::Currency::USD)), 10.);
+	ASSERT_EQ(static_cast<double>(balance.get(Trader::Currency::EUR)), -30.);
+
+	// Moving carries the funds and the reserve
+	Trader::Balance moved(std::move(balance));
+	ASSERT_EQ(static_cast<double>(moved.get(Trader::Currency::USD)), 10.);
+	ASSERT_EQ(static_cast<double>(moved.get(Trader::Currency::EUR)), -30.);
+
+	moved.clear();
+	ASSERT_TRUE(moved.empty());
+}
+
+// ---- testVersion -----------------------------------------------------------
+
+TEST_F(BalanceTest, testVersion)
+{
+	Trader::Balance balance;
+	auto version = balance.getVersion();
+
+	balance.set(Trader::Currency::EUR, 100);
+	ASSERT_NE(balance.getVersion(), version);
+	version = balance.getVersion();
+
+	// The reserve alone changes the version
+	balance.reserve(Trader::Currency::EUR, 30);
+	ASSERT_NE(balance.getVersion(), version);
+	version = balance.getVersion();
+
+	// Reading does not
+	ASSERT_EQ(static_cast<double>(balance.get(Trader::Currency::EUR)), 70.);
+	ASSERT_EQ(balance.getVersion(), version);
+}
+
+// ---- testCompareFunds ------------------------------------------------------
+
+TEST_F(BalanceTest, testCompareFunds)
+{
+	Trader::Balance balance1;
+	balance1.set(Trader::Currency::EUR, 100);
+	balance1.set(Trader::Currency::BTC, 2);
+	Trader::Balance balance2;
+	balance2.set(Trader::Currency::EUR, 80);
+	balance2.set(Trader::Currency::BTC, 2);
+	balance2.set(Trader::Currency::USD, 5);
+
+	size_t nbDifferences = 0;
+	balance1.compareFunds(balance2, [&](const Trader::CurrencyPtr currency, const IrStd::Type::Decimal amount) {
+		if (currency == Trader::Currency::EUR)
+		{
+			ASSERT_EQ(static_cast<double>(amount), -20.);
+		}
+		else
+		{
+			ASSERT_TRUE(currency == Trader::Currency::USD);
+			ASSERT_EQ(static_cast<double>(amount), 5.);
+		}
+		++nbDifferences;
+	});
+	ASSERT_EQ(nbDifferences, 2u);
+}
+
+// ---- testConcurrentReadWrite -----------------------------------------------
+
+TEST_F(BalanceTest, testConcurrentReadWrite)
+{
+	constexpr size_t NB_UPDATES = 20000;
+	const Trader::CurrencyPtr currencyList[] = {Trader::Currency::EUR, Trader::Currency::USD, Trader::Currency::BTC};
+
+	Trader::Balance balance;
+	std::atomic<bool> isRunning(true);
+	std::atomic<size_t> nbInconsistentReads(0);
+	std::atomic<size_t> nbReads(0);
+
+	// Readers must never see a partially written balance, all funds are
+	// updated together to the same value.
+	std::thread reader([&]() {
+		const Trader::Balance empty;
+		while (isRunning)
+		{
+			bool isFirst = true;
+			double expected = 0;
+			empty.compareFunds(balance, [&](const Trader::CurrencyPtr, const IrStd::Type::Decimal amount) {
+				if (isFirst)
+				{
+					expected = static_cast<double>(amount);
+					isFirst = false;
+				}
+				else if (static_cast<double>(amount) != expected)
+				{
+					++nbInconsistentReads;
+				}
+			});
+			++nbReads;
+		}
+	});
+
+	for (size_t i = 1; i <= NB_UPDATES; ++i)
+	{
+		Trader::Balance update;
+		for (const auto currency : currencyList)
+		{
+			update.set(currency, static_cast<double>(i));
+		}
+		balance.setFunds(update);
+	}
+	isRunning = false;
+	reader.join();
+
+	ASSERT_EQ(nbInconsistentReads.load(), 0u);
+	ASSERT_GT(nbReads.load(), 0u);
+	for (const auto currency : currencyList)
+	{
+		ASSERT_EQ(static_cast<double>(balance.get(currency)), static_cast<double>(NB_UPDATES));
+	}
+}
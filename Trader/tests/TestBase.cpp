@@ -1,5 +1,17 @@
+#include <cstdio>
+#include <cstdlib>
+#include <ftw.h>
+
 #include "Trader/tests/TestBase.hpp"
 
+namespace
+{
+	int removeEntry(const char* const pPath, const struct stat* /*pStat*/, int /*type*/, struct FTW* /*pFtw*/)
+	{
+		return std::remove(pPath);
+	}
+}
+
 // ---- Trader::TestBase ------------------------------------------------------
 
 Trader::TestBase::TestBase()
@@ -10,6 +22,14 @@ Trader::TestBase::TestBase()
 {
 }
 
+Trader::TestBase::~TestBase()
+{
+	for (const auto& directory : m_temporaryDirectoryList)
+	{
+		::nftw(directory.c_str(), removeEntry, /*nbOpenFd*/16, FTW_DEPTH | FTW_PHYS);
+	}
+}
+
 std::shared_ptr<Trader::Transaction> Trader::TestBase::createPairTransaction(
 			CurrencyPtr currencyFrom,
 			CurrencyPtr currencyTo) const
@@ -31,3 +51,11 @@ Trader::ContextHandle Trader::TestBase::createOperationContext() const
 {
 	return Context::create<OperationContext>(m_strategy);
 }
+
+std::string Trader::TestBase::createTemporaryDirectory(const char* const pName)
+{
+	std::string directory = std::string("/tmp/tradertests-") + pName + "-XXXXXX";
+	IRSTD_THROW_ASSERT(::mkdtemp(&directory[0]), "Cannot create the temporary directory " << directory);
+	m_temporaryDirectoryList.push_back(directory);
+	return directory;
+}
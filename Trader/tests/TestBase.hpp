@@ -14,6 +14,7 @@ namespace Trader
 	{
 	public:
 		TestBase();
+		~TestBase();
 
 		/**
 		 * Creates a dummy transaction for test purpose
@@ -30,8 +31,15 @@ namespace Trader
 		 */
 		ContextHandle createOperationContext() const;
 
+		/**
+		 * Create an empty temporary directory, it is removed with its content
+		 * at the end of the test
+		 */
+		std::string createTemporaryDirectory(const char* const pName);
+
 	private:
 		ExchangeMock<ExchangeTest> m_exchange;
 		Dummy m_strategy;
+		std::vector<std::string> m_temporaryDirectoryList;
 	};
 }
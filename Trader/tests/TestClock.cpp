@@ -0,0 +1,76 @@
+#include <thread>
+
+#include "Trader/tests/TestBase.hpp"
+
+class ClockTest : public Trader::TestBase
+{
+};
+
+// ---- testVirtualClock ------------------------------------------------------
+
+TEST_F(ClockTest, testVirtualClock)
+{
+	Trader::VirtualClock clock(IrStd::Type::Timestamp(1000));
+	ASSERT_EQ(clock.now(), IrStd::Type::Timestamp(1000));
+
+	clock.advance(500);
+	ASSERT_EQ(clock.now(), IrStd::Type::Timestamp(1500));
+
+	clock.set(IrStd::Type::Timestamp(2000));
+	ASSERT_EQ(clock.now(), IrStd::Type::Timestamp(2000));
+
+	// Nobody is sleeping
+	ASSERT_FALSE(clock.advanceToNextEvent());
+	ASSERT_EQ(clock.now(), IrStd::Type::Timestamp(2000));
+}
+
+// ---- testVirtualClockNextEvent ---------------------------------------------
+
+TEST_F(ClockTest, testVirtualClockNextEvent)
+{
+	Trader::VirtualClock clock;
+
+	// A full day of waiting must complete immediately
+	std::thread thread([&]() {
+		clock.wait(24 * 60 * 60 * 1000);
+	});
+
+	while (!clock.getNbSleeping())
+	{
+		std::this_thread::yield();
+	}
+
+	ASSERT_TRUE(clock.advanceToNextEvent());
+	thread.join();
+
+	ASSERT_EQ(clock.now(), IrStd::Type::Timestamp(24 * 60 * 60 * 1000));
+	ASSERT_EQ(clock.getNbSleeping(), 0u);
+}
+
+// ---- testFastClock ---------------------------------------------------------
+
+TEST_F(ClockTest, testFastClock)
+{
+	Trader::FastClock clock;
+	Trader::WallClock wallClock;
+
+	const auto timestamp1 = clock.now();
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	const auto timestamp2 = clock.now();
+
+	ASSERT_TRUE(timestamp2 >= timestamp1 + 40);
+	// Must stay close to the system time
+	ASSERT_TRUE(timestamp2 + 100 > wallClock.now());
+	ASSERT_TRUE(timestamp2 < wallClock.now() + 100);
+
+	// Durations in microseconds
+	const auto& sharedClock = Trader::FastClock::getInstance();
+	const uint64_t durationStartUs = sharedClock.nowUs();
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	const uint64_t durationUs = sharedClock.nowUs() - durationStartUs;
+	ASSERT_GE(durationUs, 15000u);
+	ASSERT_LT(durationUs, 200000u);
+
+	// It is not the default clock, which dates the events
+	ASSERT_TRUE(dynamic_cast<const Trader::FastClock*>(Trader::Clock::getDefault().get()) == nullptr);
+}
@@ -0,0 +1,140 @@
+#include <vector>
+
+#include "Trader/tests/TestBase.hpp"
+#include "Trader/Generic/Event/Context.hpp"
+
+namespace
+{
+	class TestContext : public Trader::Context
+	{
+		TRADER_CONTEXT_TYPE(TestContext, Trader::Context)
+	public:
+		TestContext(size_t& nbInstances, const int value)
+				: m_nbInstances(nbInstances)
+				, m_value(value)
+		{
+			++m_nbInstances;
+		}
+
+		~TestContext()
+		{
+			--m_nbInstances;
+		}
+
+		int getValue() const noexcept
+		{
+			return m_value;
+		}
+
+	private:
+		size_t& m_nbInstances;
+		const int m_value;
+	};
+
+	class OtherContext : public Trader::Context
+	{
+		TRADER_CONTEXT_TYPE(OtherContext, Trader::Context)
+	};
+}
+
+class ContextTest : public Trader::TestBase
+{
+};
+
+// ---- testHandle ------------------------------------------------------------
+
+TEST_F(ContextTest, testHandle)
+{
+	size_t nbInstances = 0;
+	{
+		auto handle = Trader::Context::create<TestContext>(nbInstances, 42);
+		ASSERT_EQ(nbInstances, 1u);
+		{
+			// Copies share the same context
+			const Trader::ContextHandleImpl<TestContext> handleCopy(handle);
+			ASSERT_TRUE(handleCopy == handle);
+			ASSERT_EQ(handleCopy->getValue(), 42);
+			ASSERT_TRUE(handle->getType().isA(TestContext::getContextType()));
+			ASSERT_TRUE(handle->getType().isA(Trader::Context::getContextType()));
+			ASSERT_FALSE(handle->getType().isA(OtherContext::getContextType()));
+		}
+		ASSERT_EQ(nbInstances, 1u);
+
+		auto handleMoved = std::move(handle);
+		ASSERT_FALSE(handle);
+		ASSERT_TRUE(handleMoved);
+		ASSERT_EQ(nbInstances, 1u);
+	}
+	// The last handle released the context
+	ASSERT_EQ(nbInstances, 0u);
+}
+
+// ---- testPoolReuse ---------------------------------------------------------
+
+TEST_F(ContextTest, testPoolReuse)
+{
+	auto pPool = std::make_shared<Trader::ContextPool>();
+	size_t nbInstances = 0;
+
+	const void* pFirst;
+	{
+		auto handle = pPool->create<TestContext>(nbInstances, 1);
+		pFirst = handle.get();
+		ASSERT_EQ(pPool->getNbFreeBlocks(sizeof(TestContext)), 0u);
+	}
+	ASSERT_EQ(nbInstances, 0u);
+	ASSERT_EQ(pPool->getNbFreeBlocks(sizeof(TestContext)), 1u);
+
+	// The released block is reused by the next context of the same size
+	{
+		auto handle = pPool->create<TestContext>(nbInstances, 2);
+		ASSERT_EQ(static_cast<const void*>(handle.get()), pFirst);
+		ASSERT_EQ(handle.cast<TestContext>()->getValue(), 2);
+		ASSERT_EQ(pPool->getNbFreeBlocks(sizeof(TestContext)), 0u);
+	}
+	ASSERT_EQ(pPool->getNbFreeBlocks(sizeof(TestContext)), 1u);
+
+	// Contexts keep the pool alive
+	{
+		auto handle = pPool->create<TestContext>(nbInstances, 3);
+		std::weak_ptr<Trader::ContextPool> pWeakPool(pPool);
+		pPool.reset();
+		ASSERT_FALSE(pWeakPool.expired());
+		handle.reset();
+		ASSERT_TRUE(pWeakPool.expired());
+	}
+	ASSERT_EQ(nbInstances, 0u);
+}
+
+// ---- testPoolExhaustion ----------------------------------------------------
+
+TEST_F(ContextTest, testPoolExhaustion)
+{
+	auto pPool = std::make_shared<Trader::ContextPool>();
+	size_t nbInstances = 0;
+	const size_t nbContexts = Trader::ContextPool::MAX_FREE_BLOCKS + 10;
+
+	{
+		// Once no free block is left, blocks come from the allocator
+		std::vector<Trader::ContextHandle> handleList;
+		for (size_t i = 0; i < nbContexts; ++i)
+		{
+			handleList.push_back(pPool->create<TestContext>(nbInstances, static_cast<int>(i)));
+		}
+		ASSERT_EQ(nbInstances, nbContexts);
+		ASSERT_EQ(pPool->getNbFreeBlocks(sizeof(TestContext)), 0u);
+		for (size_t i = 0; i < nbContexts; ++i)
+		{
+			ASSERT_EQ(handleList[i].cast<TestContext>()->getValue(), static_cast<int>(i));
+			for (size_t j = 0; j < i; ++j)
+			{
+				ASSERT_TRUE(handleList[i] != handleList[j]);
+			}
+		}
+	}
+
+	// Only a limited number of blocks is kept when released
+	ASSERT_EQ(nbInstances, 0u);
+	ASSERT_EQ(pPool->getNbFreeBlocks(sizeof(TestContext)), Trader::ContextPool::MAX_FREE_BLOCKS);
+	ASSERT_EQ(pPool->getNbFreeBlocks(sizeof(OtherContext)), 0u);
+}
@@ -0,0 +1,62 @@
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include "Trader/tests/TestBase.hpp"
+#include "Trader/Server/Dispatcher.hpp"
+
+class DispatcherTest : public Trader::TestBase
+{
+};
+
+// ---- testExecute -----------------------------------------------------------
+
+TEST_F(DispatcherTest, testExecute)
+{
+	IrStd::ServerREST server(/*port*/0);
+	Trader::Dispatcher dispatcher(server);
+
+	bool isExecuted = false;
+	ASSERT_EQ(dispatcher.execute([&]() { isExecuted = true; }, /*timeoutMs*/1000), Trader::Dispatcher::Status::DONE);
+	ASSERT_TRUE(isExecuted);
+	ASSERT_FALSE(Trader::Dispatcher::isCancelled());
+
+	// Errors are forwarded to the server
+	ASSERT_THROW(dispatcher.execute([&]() { throw std::runtime_error("Error"); }, /*timeoutMs*/1000), std::runtime_error);
+	ASSERT_FALSE(Trader::Dispatcher::isCancelled());
+}
+
+// ---- testTimeout -----------------------------------------------------------
+
+TEST_F(DispatcherTest, testTimeout)
+{
+	IrStd::ServerREST server(/*port*/0);
+	Trader::Dispatcher dispatcher(server);
+
+	// The job is unwound at the next check
+	size_t nbIterations = 0;
+	ASSERT_EQ(dispatcher.execute([&]() {
+		while (true)
+		{
+			Trader::Dispatcher::checkCancelled();
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			++nbIterations;
+		}
+	}, /*timeoutMs*/50), Trader::Dispatcher::Status::TIMEOUT);
+	ASSERT_GT(nbIterations, 0u);
+
+	// A late job which completes is not discarded
+	ASSERT_EQ(dispatcher.execute([&]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	}, /*timeoutMs*/10), Trader::Dispatcher::Status::DONE);
+
+	// Only the cancellation is turned into a timeout, other errors are forwarded
+	ASSERT_THROW(dispatcher.execute([&]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		throw std::runtime_error("Error");
+	}, /*timeoutMs*/10), std::runtime_error);
+
+	// The deadline only applies to the request it belongs to
+	ASSERT_FALSE(Trader::Dispatcher::isCancelled());
+	ASSERT_NO_THROW(Trader::Dispatcher::checkCancelled());
+}
@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Trader/tests/TestBase.hpp"
+#include "Trader/Server/Downsampler.hpp"
+
+class DownsamplerTest : public Trader::TestBase
+{
+public:
+	typedef std::vector<std::pair<uint64_t, double>> Points;
+
+	/**
+	 * Generate a sine wave from the newest (\p nbPoints - 1) to the oldest (0)
+	 */
+	static Trader::Downsampler::Source generate(const size_t nbPoints)
+	{
+		return [nbPoints](const Trader::Downsampler::Callback& callback) {
+			for (size_t i = nbPoints; i-- > 0; )
+			{
+				callback(IrStd::Type::Timestamp(i), IrStd::Type::Decimal(std::sin(i * 0.01) * 100.));
+			}
+		};
+	}
+
+	static Points process(const Trader::Downsampler::Algorithm algorithm, const size_t nbPoints, const size_t maxPoints)
+	{
+		Points points;
+		Trader::Downsampler::process(algorithm, generate(nbPoints), IrStd::Type::Timestamp(nbPoints - 1),
+				IrStd::Type::Timestamp(0), maxPoints, [&](const IrStd::Type::Timestamp timestamp, const IrStd::Type::Decimal rate) {
+			points.push_back(std::make_pair(static_cast<uint64_t>(timestamp), static_cast<double>(rate)));
+		});
+		return points;
+	}
+
+	static void checkOrder(const Points& points)
+	{
+		for (size_t i = 1; i < points.size(); ++i)
+		{
+			ASSERT_LT(points[i].first, points[i - 1].first);
+		}
+	}
+};
+
+// ---- testLttb --------------------------------------------------------------
+
+TEST_F(DownsamplerTest, testLttb)
+{
+	// Nothing to reduce
+	ASSERT_EQ(process(Trader::Downsampler::Algorithm::LTTB, 50, 100).size(), 50u);
+	ASSERT_EQ(process(Trader::Downsampler::Algorithm::LTTB, 0, 100).size(), 0u);
+
+	const auto points = process(Trader::Downsampler::Algorithm::LTTB, 100000, 100);
+	ASSERT_LE(points.size(), 100u);
+	ASSERT_GE(points.size(), 90u);
+	checkOrder(points);
+	ASSERT_EQ(points.front().first, 99999u);
+	ASSERT_EQ(points.back().first, 0u);
+
+	// The extremes of the wave are preserved
+	double min = 0;
+	double max = 0;
+	for (const auto& point : points)
+	{
+		min = std::min(min, point.second);
+		max = std::max(max, point.second);
+	}
+	ASSERT_LT(min, -99.);
+	ASSERT_GT(max, 99.);
+}
+
+// ---- testMinMax ------------------------------------------------------------
+
+TEST_F(DownsamplerTest, testMinMax)
+{
+	const auto points = process(Trader::Downsampler::Algorithm::MIN_MAX, 100000, 100);
+	ASSERT_LE(points.size(), 100u);
+	checkOrder(points);
+
+	double min = 0;
+	double max = 0;
+	for (const auto& point : points)
+	{
+		min = std::min(min, point.second);
+		max = std::max(max, point.second);
+	}
+	// The extremes of the wave are exactly preserved
+	double expectedMin = 0;
+	double expectedMax = 0;
+	generate(100000)([&](const IrStd::Type::Timestamp, const IrStd::Type::Decimal rate) {
+		expectedMin = std::min(expectedMin, static_cast<double>(rate));
+		expectedMax = std::max(expectedMax, static_cast<double>(rate));
+	});
+	ASSERT_EQ(min, expectedMin);
+	ASSERT_EQ(max, expectedMax);
+}
+
+// ---- testLast --------------------------------------------------------------
+
+TEST_F(DownsamplerTest, testLast)
+{
+	const auto points = process(Trader::Downsampler::Algorithm::LAST, 1000, 10);
+	ASSERT_EQ(points.size(), 10u);
+	checkOrder(points);
+	for (size_t i = 0; i < points.size(); ++i)
+	{
+		ASSERT_EQ(points[i].first, 999u - i * 100);
+	}
+
+	// Limits
+	ASSERT_EQ(process(Trader::Downsampler::Algorithm::LAST, 1000, 0).size(), Trader::Downsampler::MIN_POINTS);
+	ASSERT_EQ(Trader::Downsampler::fromString("minmax"), Trader::Downsampler::Algorithm::MIN_MAX);
+	ASSERT_THROW(Trader::Downsampler::fromString("unknown"), IrStd::Exception);
+}
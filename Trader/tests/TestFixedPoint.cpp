@@ -0,0 +1,232 @@
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "Trader/tests/TestBase.hpp"
+#include "Trader/Generic/FixedPoint/FixedPoint.hpp"
+
+IRSTD_TOPIC_USE(Trader);
+
+class FixedPointTest : public Trader::TestBase
+{
+public:
+	static std::string format(const double value, const size_t scale,
+			const Trader::FixedPoint::Rounding rounding = Trader::FixedPoint::Rounding::ROUND)
+	{
+		return Trader::FixedPoint(value, scale, rounding).toString();
+	}
+
+	static bool parse(const char* const pStr, Trader::FixedPoint& number)
+	{
+		return Trader::FixedPoint::fromString(pStr, std::strlen(pStr), number);
+	}
+};
+
+// ---- testConversion --------------------------------------------------------
+
+TEST_F(FixedPointTest, testConversion)
+{
+	ASSERT_EQ(format(0, 0), "0");
+	ASSERT_EQ(format(0, 3), "0.000");
+	ASSERT_EQ(format(1.5, 2), "1.50");
+	ASSERT_EQ(format(0.05, 2), "0.05");
+	ASSERT_EQ(format(-0.05, 2), "-0.05");
+	ASSERT_EQ(format(1234.5678, 2), "1234.57");
+	ASSERT_EQ(format(-1234.5678, 2), "-1234.57");
+	ASSERT_EQ(format(0.000012345, 8), "0.00001235");
+	ASSERT_EQ(format(42, 0), "42");
+
+	// Representation errors of the doubles are ignored
+	ASSERT_EQ(format(0.29, 2, Trader::FixedPoint::Rounding::FLOOR), "0.29");
+	ASSERT_EQ(format(1.15, 2, Trader::FixedPoint::Rounding::CEIL), "1.15");
+	ASSERT_EQ(format(0.1 + 0.2, 1, Trader::FixedPoint::Rounding::CEIL), "0.3");
+
+	// Large scaled values are not snapped to the nearest integer
+	ASSERT_EQ(format(123456.789999999, 8, Trader::FixedPoint::Rounding::FLOOR), "123456.78999999");
+	ASSERT_EQ(format(123456.780000001, 8, Trader::FixedPoint::Rounding::CEIL), "123456.78000001");
+	ASSERT_EQ(format(-123456.789999999, 8, Trader::FixedPoint::Rounding::CEIL), "-123456.78999999");
+	ASSERT_EQ(format(9876543.2100000009, 8, Trader::FixedPoint::Rounding::FLOOR), "9876543.21000000");
+	ASSERT_EQ(format(9876543.2099999991, 8, Trader::FixedPoint::Rounding::CEIL), "9876543.21000000");
+
+	// Default scale of the transactions
+	ASSERT_EQ(format(0.5, 14, Trader::FixedPoint::Rounding::FLOOR), "0.50000000000000");
+	ASSERT_EQ(format(0.29, 14, Trader::FixedPoint::Rounding::FLOOR), "0.29000000000000");
+	ASSERT_EQ(format(1.15, 14, Trader::FixedPoint::Rounding::CEIL), "1.15000000000000");
+	ASSERT_EQ(format(0.123456789012345, 14, Trader::FixedPoint::Rounding::FLOOR), "0.12345678901234");
+	ASSERT_EQ(format(0.123456789012345, 14, Trader::FixedPoint::Rounding::CEIL), "0.12345678901235");
+	ASSERT_EQ(format(12.3456789012349, 14, Trader::FixedPoint::Rounding::FLOOR), "12.34567890123490");
+	ASSERT_EQ(format(12.3456789012349, 12, Trader::FixedPoint::Rounding::FLOOR), "12.345678901234");
+	ASSERT_EQ(format(12.3456789012341, 12, Trader::FixedPoint::Rounding::CEIL), "12.345678901235");
+
+	// Rounding modes
+	ASSERT_EQ(format(1.256, 2, Trader::FixedPoint::Rounding::FLOOR), "1.25");
+	ASSERT_EQ(format(1.251, 2, Trader::FixedPoint::Rounding::CEIL), "1.26");
+	ASSERT_EQ(format(-1.251, 2, Trader::FixedPoint::Rounding::FLOOR), "-1.26");
+	ASSERT_EQ(format(-1.256, 2, Trader::FixedPoint::Rounding::CEIL), "-1.25");
+
+	// Back to the closest double
+	ASSERT_EQ(static_cast<double>(Trader::FixedPoint(0.1 + 0.2, 2).toDecimal()), 0.3);
+	ASSERT_EQ(static_cast<double>(Trader::FixedPoint(1234.5678, 2).toDecimal()), 1234.57);
+
+	// Large numbers get fewer decimal places
+	{
+		const Trader::FixedPoint number(123456789., 14);
+		ASSERT_EQ(number.getScale(), 10u);
+		ASSERT_EQ(number.toString(), "123456789.0000000000");
+	}
+
+	ASSERT_THROW(Trader::FixedPoint(1., Trader::FixedPoint::MAX_SCALE + 1), IrStd::Exception);
+	ASSERT_THROW(Trader::FixedPoint(std::numeric_limits<double>::infinity(), 2), IrStd::Exception);
+	ASSERT_THROW(Trader::FixedPoint(1e19, 0), IrStd::Exception);
+
+	// Same conversion without exception
+	{
+		Trader::FixedPoint number;
+		ASSERT_TRUE(Trader::FixedPoint::fromDecimal(0.29, 2, number, Trader::FixedPoint::Rounding::FLOOR));
+		ASSERT_EQ(number.toString(), "0.29");
+		ASSERT_TRUE(Trader::FixedPoint::fromDecimal(123456789., 14, number));
+		ASSERT_EQ(number.getScale(), 10u);
+		ASSERT_FALSE(Trader::FixedPoint::fromDecimal(1., Trader::FixedPoint::MAX_SCALE + 1, number));
+		ASSERT_FALSE(Trader::FixedPoint::fromDecimal(std::numeric_limits<double>::quiet_NaN(), 2, number));
+		ASSERT_FALSE(Trader::FixedPoint::fromDecimal(1e19, 0, number));
+		ASSERT_EQ(number.getMantissa(), 1234567890000000000LL);
+	}
+}
+
+// ---- testArithmetic --------------------------------------------------------
+
+TEST_F(FixedPointTest, testArithmetic)
+{
+	const auto a = Trader::FixedPoint::fromMantissa(12345, 3);
+	const auto b = Trader::FixedPoint::fromMantissa(5, 1);
+
+	ASSERT_EQ((a + b).toString(), "12.845");
+	ASSERT_EQ((b - a).toString(), "-11.845");
+	ASSERT_EQ((-a).toString(), "-12.345");
+
+	ASSERT_TRUE(Trader::FixedPoint::fromMantissa(500, 3) == b);
+	ASSERT_TRUE(a > b);
+	ASSERT_TRUE(b < a);
+	ASSERT_TRUE(a >= a);
+	ASSERT_TRUE(a != b);
+
+	// Alignment overflowing, the number with the fewest decimal places is the largest
+	const auto large = Trader::FixedPoint::fromMantissa(std::numeric_limits<int64_t>::max() / 10, 0);
+	const auto small = Trader::FixedPoint::fromMantissa(1, 18);
+	ASSERT_TRUE(large > small);
+	ASSERT_TRUE(-large < small);
+	ASSERT_THROW(large + small, IrStd::Exception);
+
+	ASSERT_EQ(a.rescale(2).toString(), "12.35");
+	ASSERT_EQ(a.rescale(1, Trader::FixedPoint::Rounding::FLOOR).toString(), "12.3");
+	ASSERT_EQ((-a).rescale(1, Trader::FixedPoint::Rounding::FLOOR).toString(), "-12.4");
+	ASSERT_EQ(a.rescale(0, Trader::FixedPoint::Rounding::CEIL).toString(), "13");
+	ASSERT_EQ(a.rescale(5).toString(), "12.34500");
+	ASSERT_EQ(a.rescale(5).normalize().toString(), "12.345");
+	ASSERT_EQ(Trader::FixedPoint(1200., 4).normalize().toString(), "1200");
+
+	// Extremes
+	ASSERT_EQ(Trader::FixedPoint::fromMantissa(std::numeric_limits<int64_t>::min(), 18).toString(), "-9.223372036854775808");
+	ASSERT_EQ(Trader::FixedPoint::fromMantissa(std::numeric_limits<int64_t>::max(), 0).toString(), "9223372036854775807");
+}
+
+// ---- testParse -------------------------------------------------------------
+
+TEST_F(FixedPointTest, testParse)
+{
+	Trader::FixedPoint number;
+
+	ASSERT_TRUE(parse("0", number));
+	ASSERT_EQ(number.getMantissa(), 0);
+	ASSERT_EQ(number.getScale(), 0u);
+
+	ASSERT_TRUE(parse("6543.21", number));
+	ASSERT_EQ(number.getMantissa(), 654321);
+	ASSERT_EQ(number.getScale(), 2u);
+
+	// Chunks of 8 digits, before and after the decimal point
+	ASSERT_TRUE(parse("12345678.12345678", number));
+	ASSERT_EQ(number.getMantissa(), 1234567812345678);
+	ASSERT_EQ(number.getScale(), 8u);
+	ASSERT_TRUE(parse("-0.000123456789", number));
+	ASSERT_EQ(number.getMantissa(), -123456789);
+	ASSERT_EQ(number.getScale(), 12u);
+	ASSERT_TRUE(parse("999999999999999999", number));
+	ASSERT_EQ(number.getMantissa(), 999999999999999999);
+	ASSERT_TRUE(parse(".5", number));
+	ASSERT_EQ(number.toString(), "0.5");
+
+	// Round trip
+	ASSERT_TRUE(parse("0.00012000", number));
+	ASSERT_EQ(number.toString(), "0.00012000");
+	ASSERT_EQ(static_cast<double>(number.toDecimal()), 0.00012);
+
+	// Not supported
+	ASSERT_FALSE(parse("", number));
+	ASSERT_FALSE(parse("-", number));
+	ASSERT_FALSE(parse("1e5", number));
+	ASSERT_FALSE(parse("12a45678.0", number));
+	ASSERT_FALSE(parse("1.2.3", number));
+	ASSERT_FALSE(parse("1234567890.123456789", number));
+
+	// Fallback to the generic parser
+	ASSERT_EQ(static_cast<double>(Trader::FixedPoint::parseDecimal("6543.21")), 6543.21);
+	ASSERT_EQ(static_cast<double>(Trader::FixedPoint::parseDecimal("1e5")), 100000.);
+}
+
+// ---- testBenchmark ---------------------------------------------------------
+
+TEST_F(FixedPointTest, testBenchmark)
+{
+	constexpr size_t NB_NUMBERS = 100000;
+	constexpr size_t DECIMAL_PLACE = 5;
+
+	std::vector<std::string> stringList;
+	for (size_t i = 0; i < NB_NUMBERS; ++i)
+	{
+		stringList.push_back(format(6500. + i * 0.01234, DECIMAL_PLACE));
+	}
+
+	// Parsing
+	double referenceSum = 0;
+	const auto start = std::chrono::steady_clock::now();
+	for (const auto& str : stringList)
+	{
+		referenceSum += static_cast<double>(IrStd::Type::Decimal::fromString(str.c_str()));
+	}
+	const auto middle = std::chrono::steady_clock::now();
+	double sum = 0;
+	for (const auto& str : stringList)
+	{
+		sum += static_cast<double>(Trader::FixedPoint::parseDecimal(str.c_str()));
+	}
+	const auto end = std::chrono::steady_clock::now();
+	ASSERT_NEAR(sum, referenceSum, referenceSum * 1e-12);
+
+	// Formatting
+	size_t referenceLength = 0;
+	const auto startFormat = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < NB_NUMBERS; ++i)
+	{
+		referenceLength += std::strlen(IrStd::Type::ShortString(6500. + i * 0.01234, DECIMAL_PLACE).c_str());
+	}
+	const auto middleFormat = std::chrono::steady_clock::now();
+	size_t length = 0;
+	for (size_t i = 0; i < NB_NUMBERS; ++i)
+	{
+		char buffer[Trader::FixedPoint::MAX_STRING_SIZE];
+		length += Trader::FixedPoint(6500. + i * 0.01234, DECIMAL_PLACE).toString(buffer);
+	}
+	const auto endFormat = std::chrono::steady_clock::now();
+	ASSERT_GT(length, 0u);
+	ASSERT_GT(referenceLength, 0u);
+
+	typedef std::chrono::duration<double, std::nano> Nanoseconds;
+	IRSTD_LOG_INFO(IRSTD_TOPIC(Trader), "Per number, parsing: " << Nanoseconds(middle - start).count() / NB_NUMBERS
+			<< "ns generic, " << Nanoseconds(end - middle).count() / NB_NUMBERS
+			<< "ns fixed-point; formatting: " << Nanoseconds(middleFormat - startFormat).count() / NB_NUMBERS
+			<< "ns generic, " << Nanoseconds(endFormat - middleFormat).count() / NB_NUMBERS
+			<< "ns fixed-point");
+}
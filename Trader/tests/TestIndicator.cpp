@@ -0,0 +1,122 @@
+#include <cmath>
+
+#include "Trader/tests/TestBase.hpp"
+#include "Trader/Strategy/Indicator/Indicator.hpp"
+
+class IndicatorTest : public Trader::TestBase
+{
+public:
+	/**
+	 * Create a matrix of 3 series over 4 samples
+	 */
+	IndicatorTest()
+			: m_matrix(3, 4)
+	{
+		const std::vector<std::vector<double>> rateList{
+			{1, 2, 3, 4},
+			{2, 2, 2, 2},
+			{3, 5, 1, 7}
+		};
+		for (size_t i = 0; i < rateList.size(); ++i)
+		{
+			Trader::RateSeries series;
+			for (size_t sample = 0; sample < rateList[i].size(); ++sample)
+			{
+				series.push(IrStd::Type::Timestamp(1000 * (sample + 1)), rateList[i][sample]);
+			}
+			m_matrix.set(i, series);
+		}
+	}
+
+protected:
+	Trader::RateMatrix m_matrix;
+};
+
+// ---- testRateSeries --------------------------------------------------------
+
+TEST_F(IndicatorTest, testRateSeries)
+{
+	auto pTransaction = createPairTransaction(Trader::Currency::EUR, Trader::Currency::USD);
+	pTransaction->setRate(1., IrStd::Type::Timestamp(1000));
+	pTransaction->setRate(2., IrStd::Type::Timestamp(2000));
+	pTransaction->setRate(3., IrStd::Type::Timestamp(3000));
+
+	// Oldest first, the current rate included
+	Trader::RateSeries series;
+	ASSERT_EQ(series.load(*pTransaction, 2), 2u);
+	ASSERT_EQ(series.getRates()[0], 2.);
+	ASSERT_EQ(series.getRates()[1], 3.);
+	ASSERT_EQ(series.getTimestamps()[1], 3000u);
+
+	ASSERT_EQ(series.load(*pTransaction, 10), 3u);
+
+	// Too short for the matrix
+	Trader::RateMatrix matrix(2, 4);
+	ASSERT_FALSE(matrix.set(0, series));
+	ASSERT_FALSE(matrix.isValid(0));
+	series.push(IrStd::Type::Timestamp(4000), 4.);
+	ASSERT_TRUE(matrix.set(1, series));
+	ASSERT_TRUE(matrix.isValid(1));
+	ASSERT_EQ(matrix.getSample(3)[1], 4.);
+}
+
+// ---- testAverage -----------------------------------------------------------
+
+TEST_F(IndicatorTest, testAverage)
+{
+	std::vector<double> average;
+	Trader::Indicator::sma(m_matrix, 4, average);
+	ASSERT_EQ(average.size(), 3u);
+	ASSERT_DOUBLE_EQ(average[0], 2.5);
+	ASSERT_DOUBLE_EQ(average[1], 2.);
+	ASSERT_DOUBLE_EQ(average[2], 4.);
+
+	Trader::Indicator::sma(m_matrix, 2, average, /*lag*/1);
+	ASSERT_DOUBLE_EQ(average[0], 2.5);
+	ASSERT_DOUBLE_EQ(average[2], 3.);
+
+	// Smoothing factor of 0.5
+	Trader::Indicator::ema(m_matrix, 3, average);
+	ASSERT_DOUBLE_EQ(average[0], 3.125);
+	ASSERT_DOUBLE_EQ(average[1], 2.);
+	ASSERT_DOUBLE_EQ(average[2], 4.75);
+}
+
+// ---- testDeviation ---------------------------------------------------------
+
+TEST_F(IndicatorTest, testDeviation)
+{
+	std::vector<double> deviation;
+	Trader::Indicator::stddev(m_matrix, 4, deviation);
+	ASSERT_DOUBLE_EQ(deviation[0], std::sqrt(1.25));
+	ASSERT_DOUBLE_EQ(deviation[1], 0.);
+	ASSERT_DOUBLE_EQ(deviation[2], std::sqrt(5.));
+
+	std::vector<double> score;
+	Trader::Indicator::zScore(m_matrix, 4, score);
+	ASSERT_DOUBLE_EQ(score[0], 1.5 / std::sqrt(1.25));
+	ASSERT_DOUBLE_EQ(score[1], 0.);
+	ASSERT_DOUBLE_EQ(score[2], 3. / std::sqrt(5.));
+
+	std::vector<double> lower, middle, upper;
+	Trader::Indicator::bollinger(m_matrix, 4, 2., lower, middle, upper);
+	ASSERT_DOUBLE_EQ(middle[2], 4.);
+	ASSERT_DOUBLE_EQ(lower[2], 4. - 2. * std::sqrt(5.));
+	ASSERT_DOUBLE_EQ(upper[2], 4. + 2. * std::sqrt(5.));
+	ASSERT_DOUBLE_EQ(lower[1], 2.);
+}
+
+// ---- testMinMax ------------------------------------------------------------
+
+TEST_F(IndicatorTest, testMinMax)
+{
+	std::vector<double> min, max;
+	Trader::Indicator::minMax(m_matrix, 3, min, max, /*lag*/1);
+	ASSERT_DOUBLE_EQ(min[0], 1.);
+	ASSERT_DOUBLE_EQ(max[0], 3.);
+	ASSERT_DOUBLE_EQ(min[2], 1.);
+	ASSERT_DOUBLE_EQ(max[2], 5.);
+
+	// The window must fit in the matrix
+	ASSERT_THROW(Trader::Indicator::minMax(m_matrix, 4, min, max, /*lag*/1), IrStd::Exception);
+}
@@ -0,0 +1,146 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "Trader/tests/TestBase.hpp"
+#include "Trader/Generic/Journal/Journal.hpp"
+
+class JournalTest : public Trader::TestBase
+{
+public:
+	void SetUp()
+	{
+		Trader::TestBase::SetUp();
+		m_directory = createTemporaryDirectory("journal");
+		m_path = m_directory + "/journal.bin";
+	}
+
+	std::vector<uint64_t> replay(Trader::Journal& journal)
+	{
+		std::vector<uint64_t> valueList;
+		journal.replay([&](const Trader::Journal::RecordType type, Trader::Journal::Decoder& decoder) {
+			EXPECT_EQ(type, 1u);
+			valueList.push_back(decoder.getU64());
+		});
+		return valueList;
+	}
+
+	void append(Trader::Journal& journal, const uint64_t value)
+	{
+		Trader::Journal::Encoder encoder;
+		encoder.putU64(value);
+		journal.append(/*type*/1, encoder);
+	}
+
+protected:
+	std::string m_directory;
+	std::string m_path;
+};
+
+// ---- testEncoder -----------------------------------------------------------
+
+TEST_F(JournalTest, testEncoder)
+{
+	Trader::Journal::Encoder encoder;
+	encoder.putU8(42);
+	encoder.putU64(1234567890123ull);
+	encoder.putDouble(0.125);
+	encoder.putDecimal(IrStd::Type::Decimal(0.1) / 3);
+	encoder.putString("hello");
+
+	Trader::Journal::Decoder decoder(encoder.get());
+	ASSERT_EQ(decoder.getU8(), 42u);
+	ASSERT_EQ(decoder.getU64(), 1234567890123ull);
+	ASSERT_EQ(decoder.getDouble(), 0.125);
+	ASSERT_EQ(decoder.getDecimal(), IrStd::Type::Decimal(0.1) / 3);
+	ASSERT_EQ(decoder.getString(), "hello");
+	ASSERT_THROW(decoder.getU8(), IrStd::Exception);
+}
+
+// ---- testReplay ------------------------------------------------------------
+
+TEST_F(JournalTest, testReplay)
+{
+	{
+		Trader::Journal journal(m_path);
+		for (uint64_t value = 0; value < 1000; ++value)
+		{
+			append(journal, value);
+		}
+		journal.sync();
+	}
+
+	Trader::Journal journal(m_path);
+	const auto valueList = replay(journal);
+	ASSERT_EQ(valueList.size(), 1000u);
+	for (uint64_t value = 0; value < 1000; ++value)
+	{
+		ASSERT_EQ(valueList[value], value);
+	}
+}
+
+// ---- testTornRecord --------------------------------------------------------
+
+TEST_F(JournalTest, testTornRecord)
+{
+	{
+		Trader::Journal journal(m_path);
+		append(journal, 1);
+		append(journal, 2);
+		journal.sync();
+	}
+
+	// Simulate a crash in the middle of a write
+	{
+		const int fd = ::open(m_path.c_str(), O_WRONLY | O_APPEND);
+		ASSERT_TRUE(fd >= 0);
+		const char partial[] = {8, 0, 0};
+		ASSERT_EQ(::write(fd, partial, sizeof(partial)), static_cast<ssize_t>(sizeof(partial)));
+		::close(fd);
+	}
+
+	{
+		Trader::Journal journal(m_path);
+		ASSERT_EQ(replay(journal), (std::vector<uint64_t>{1, 2}));
+		// Records after the torn one are readable
+		append(journal, 3);
+		journal.sync();
+	}
+
+	Trader::Journal journal(m_path);
+	ASSERT_EQ(replay(journal), (std::vector<uint64_t>{1, 2, 3}));
+}
+
+// ---- testCheckpoint --------------------------------------------------------
+
+TEST_F(JournalTest, testCheckpoint)
+{
+	Trader::Journal journal(m_path);
+	for (uint64_t value = 0; value < 100; ++value)
+	{
+		append(journal, value);
+	}
+	journal.sync();
+
+	Trader::Journal::Batch snapshot;
+	{
+		Trader::Journal::Encoder encoder;
+		encoder.putU64(99);
+		snapshot.add(/*type*/1, encoder);
+	}
+	journal.checkpoint(snapshot);
+	append(journal, 100);
+	journal.sync();
+
+	Trader::Journal journalReopen(m_path);
+	ASSERT_EQ(replay(journalReopen), (std::vector<uint64_t>{99, 100}));
+}
+
+// ---- testCommitError -------------------------------------------------------
+
+TEST_F(JournalTest, testCommitError)
+{
+	// All the writes to this device fail with ENOSPC
+	Trader::Journal journal("/dev/full");
+	append(journal, 1);
+	ASSERT_THROW(journal.sync(), IrStd::Exception);
+}
@@ -0,0 +1,91 @@
+#include <chrono>
+#include <limits>
+#include <sstream>
+
+#include "Trader/tests/TestBase.hpp"
+#include "Trader/Generic/Json/JsonWriter.hpp"
+
+IRSTD_TOPIC_USE(Trader);
+
+class JsonWriterTest : public Trader::TestBase
+{
+};
+
+// ---- testStructure ---------------------------------------------------------
+
+TEST_F(JsonWriterTest, testStructure)
+{
+	std::string buffer("previous content");
+	Trader::JsonWriter json(buffer);
+	json.beginObject()
+			.key("list").beginArray()
+					.beginObject().member("t", static_cast<uint64_t>(12)).member("r", 0.5).endObject()
+					.beginObject().member("t", static_cast<uint64_t>(13)).member("r", 1.25).endObject()
+					.value(static_cast<int64_t>(-7))
+					.null()
+			.endArray()
+			.key("empty").beginObject().endObject()
+			.member("flag", true)
+			.member("name", "a\"b")
+			.endObject();
+
+	ASSERT_EQ(json.get(), "{\"list\":[{\"t\":12,\"r\":0.5},{\"t\":13,\"r\":1.25},-7,null],"
+			"\"empty\":{},\"flag\":true,\"name\":\"a\\\"b\"}");
+}
+
+// ---- testNumbers -----------------------------------------------------------
+
+TEST_F(JsonWriterTest, testNumbers)
+{
+	std::string buffer;
+	Trader::JsonWriter::appendNumber(buffer, static_cast<uint64_t>(0));
+	ASSERT_EQ(buffer, "0");
+	buffer.clear();
+	Trader::JsonWriter::appendNumber(buffer, std::numeric_limits<uint64_t>::max());
+	ASSERT_EQ(buffer, "18446744073709551615");
+	buffer.clear();
+	Trader::JsonWriter::appendNumber(buffer, 6512.123456789);
+	ASSERT_EQ(buffer, "6512.12345679");
+	buffer.clear();
+	Trader::JsonWriter::appendNumber(buffer, std::numeric_limits<double>::quiet_NaN());
+	ASSERT_EQ(buffer, "null");
+
+	Trader::JsonWriter json(buffer);
+	json.value(std::numeric_limits<int64_t>::min());
+	ASSERT_EQ(json.get(), "-9223372036854775808");
+}
+
+// ---- testBenchmark ---------------------------------------------------------
+
+TEST_F(JsonWriterTest, testBenchmark)
+{
+	constexpr size_t NB_POINTS = 100000;
+
+	// Reference, one temporary string per point as a document would do
+	const auto start = std::chrono::steady_clock::now();
+	std::string reference("{\"list\":[");
+	for (size_t i = 0; i < NB_POINTS; ++i)
+	{
+		std::ostringstream stream;
+		stream.precision(12);
+		stream << ((i) ? "," : "") << "{\"t\":" << (1500000000000ull + i) << ",\"r\":" << (6500. + i * 0.01) << "}";
+		reference.append(stream.str());
+	}
+	reference.append("]}");
+	const auto middle = std::chrono::steady_clock::now();
+
+	Trader::JsonWriter json(Trader::JsonWriter::getThreadBuffer());
+	json.beginObject().key("list").beginArray();
+	for (size_t i = 0; i < NB_POINTS; ++i)
+	{
+		json.beginObject().member("t", static_cast<uint64_t>(1500000000000ull + i)).member("r", 6500. + i * 0.01).endObject();
+	}
+	json.endArray().endObject();
+	const auto end = std::chrono::steady_clock::now();
+
+	ASSERT_EQ(json.get(), reference);
+	typedef std::chrono::duration<double, std::nano> Nanoseconds;
+	IRSTD_LOG_INFO(IRSTD_TOPIC(Trader), "Serializing " << NB_POINTS << " points, per point: "
+			<< Nanoseconds(middle - start).count() / NB_POINTS << "ns with temporaries, "
+			<< Nanoseconds(end - middle).count() / NB_POINTS << "ns streaming");
+}
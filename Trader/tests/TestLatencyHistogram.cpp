@@ -0,0 +1,51 @@
+#include "Trader/tests/TestBase.hpp"
+#include "Trader/Generic/Histogram/LatencyHistogram.hpp"
+
+class LatencyHistogramTest : public Trader::TestBase
+{
+};
+
+// ---- testPercentile --------------------------------------------------------
+
+TEST_F(LatencyHistogramTest, testPercentile)
+{
+	Trader::LatencyHistogram histogram;
+	ASSERT_EQ(histogram.getPercentile(50), 0u);
+
+	for (uint64_t value = 1; value <= 1000; ++value)
+	{
+		histogram.record(value);
+	}
+	ASSERT_EQ(histogram.getCount(), 1000u);
+	ASSERT_EQ(histogram.getMax(), 1000u);
+	ASSERT_EQ(histogram.getMean(), 500u);
+
+	// Within the precision of the buckets
+	ASSERT_GE(histogram.getPercentile(50), 500u);
+	ASSERT_LE(histogram.getPercentile(50), 500u * 1.125);
+	ASSERT_GE(histogram.getPercentile(90), 900u);
+	ASSERT_LE(histogram.getPercentile(90), 900u * 1.125);
+	ASSERT_EQ(histogram.getPercentile(100), 1000u);
+
+	histogram.reset();
+	ASSERT_EQ(histogram.getCount(), 0u);
+	ASSERT_EQ(histogram.getMax(), 0u);
+}
+
+// ---- testOutlier -----------------------------------------------------------
+
+TEST_F(LatencyHistogramTest, testOutlier)
+{
+	Trader::LatencyHistogram histogram;
+	for (size_t i = 0; i < 99; ++i)
+	{
+		histogram.record(3);
+	}
+	histogram.record(500000);
+
+	// Small values are exact, the outlier only shows on the tail
+	ASSERT_EQ(histogram.getPercentile(50), 3u);
+	ASSERT_EQ(histogram.getPercentile(99), 3u);
+	ASSERT_EQ(histogram.getPercentile(100), 500000u);
+	ASSERT_EQ(histogram.getMax(), 500000u);
+}
@@ -0,0 +1,133 @@
+#include "Trader/tests/TestBase.hpp"
+#include "Trader/Exchange/Order/MatchingEngine.hpp"
+
+class MatchingEngineTest : public Trader::TestBase
+{
+public:
+	MatchingEngineTest()
+			: m_engine(Trader::ConfigurationMock({
+				{"latencyDistribution", IrStd::Type::toIntegral(Trader::ConfigurationMock::LatencyDistribution::CONSTANT)},
+				{"latencyMeanMs", 0},
+				{"failurePercent", 0},
+				{"queueAheadValue", 0},
+				{"liquidityPerUpdateValue", 10},
+				{"feeMakerPercent", 0},
+				{"feeTakerPercent", 0},
+				{"seed", 1}
+			}), [](const Trader::CurrencyPtr, const IrStd::Type::Decimal value) {
+				return value;
+			})
+			, m_pTransaction(createPairTransaction(Trader::Currency::USD, Trader::Currency::EUR))
+			, m_timestamp(1000)
+	{
+		setRate(1.);
+	}
+
+	void setRate(const IrStd::Type::Decimal rate)
+	{
+		m_timestamp = m_timestamp + 1000;
+		m_pTransaction->setRate(rate, m_timestamp);
+	}
+
+	Trader::Id add(const IrStd::Type::Decimal rate, const IrStd::Type::Decimal amount)
+	{
+		const Trader::Id id = Trader::Id::unique();
+		m_engine.add(Trader::TrackOrder(id, m_pTransaction, rate, amount, m_timestamp), m_timestamp);
+		return id;
+	}
+
+	void match()
+	{
+		m_fillList.clear();
+		m_engine.match(m_timestamp, [&](const Trader::TrackOrder& track, const IrStd::Type::Decimal amount,
+				const IrStd::Type::Decimal /*finalAmount*/) {
+			m_fillList.push_back({track.getId(), amount});
+			return true;
+		});
+	}
+
+protected:
+	Trader::MatchingEngine m_engine;
+	std::shared_ptr<Trader::Transaction> m_pTransaction;
+	IrStd::Type::Timestamp m_timestamp;
+	std::vector<std::pair<Trader::Id, IrStd::Type::Decimal>> m_fillList;
+};
+
+// ---- testPriceTimePriority -------------------------------------------------
+
+TEST_F(MatchingEngineTest, testPriceTimePriority)
+{
+	const auto id1 = add(1.2, 6);
+	const auto id2 = add(1.1, 6);
+	const auto id3 = add(1.2, 6);
+
+	// Nothing crosses
+	match();
+	ASSERT_EQ(m_fillList.size(), 0u);
+
+	// Best price first, then partial fill of the oldest order at the same price
+	setRate(1.2);
+	match();
+	ASSERT_EQ(m_fillList.size(), 2u);
+	ASSERT_EQ(m_fillList[0].first, id2);
+	ASSERT_EQ(m_fillList[0].second, IrStd::Type::Decimal(6));
+	ASSERT_EQ(m_fillList[1].first, id1);
+	ASSERT_EQ(m_fillList[1].second, IrStd::Type::Decimal(4));
+	ASSERT_EQ(m_engine.size(), 2u);
+
+	match();
+	ASSERT_EQ(m_fillList.size(), 2u);
+	ASSERT_EQ(m_fillList[0].first, id1);
+	ASSERT_EQ(m_fillList[0].second, IrStd::Type::Decimal(2));
+	ASSERT_EQ(m_fillList[1].first, id3);
+	ASSERT_EQ(m_fillList[1].second, IrStd::Type::Decimal(6));
+	ASSERT_EQ(m_engine.size(), 0u);
+
+	ASSERT_EQ(m_engine.getStatistics().m_nbFilledOrders, 3u);
+	ASSERT_EQ(m_engine.getStatistics().m_nbPartialFills, 1u);
+}
+
+// ---- testQueuePosition -----------------------------------------------------
+
+TEST_F(MatchingEngineTest, testQueuePosition)
+{
+	m_engine.setConfiguration(Trader::ConfigurationMock({
+		{"latencyDistribution", IrStd::Type::toIntegral(Trader::ConfigurationMock::LatencyDistribution::CONSTANT)},
+		{"latencyMeanMs", 0},
+		{"queueAheadValue", 15},
+		{"liquidityPerUpdateValue", 10}
+	}));
+
+	const auto id = add(1.2, 8);
+	match();
+
+	// The rate touches the order, the queue ahead must be traded first
+	setRate(1.2);
+	match();
+	ASSERT_EQ(m_fillList.size(), 0u);
+	match();
+	ASSERT_EQ(m_fillList.size(), 1u);
+	ASSERT_EQ(m_fillList[0].first, id);
+	ASSERT_EQ(m_fillList[0].second, IrStd::Type::Decimal(5));
+
+	// Trading through the price level fills the rest
+	setRate(1.3);
+	match();
+	ASSERT_EQ(m_fillList.size(), 1u);
+	ASSERT_EQ(m_fillList[0].second, IrStd::Type::Decimal(3));
+	ASSERT_EQ(m_engine.size(), 0u);
+}
+
+// ---- testCancel ------------------------------------------------------------
+
+TEST_F(MatchingEngineTest, testCancel)
+{
+	const auto id = add(1.2, 6);
+	ASSERT_TRUE(m_engine.cancel(id));
+	ASSERT_FALSE(m_engine.cancel(id));
+
+	setRate(1.2);
+	match();
+	ASSERT_EQ(m_fillList.size(), 0u);
+	ASSERT_EQ(m_engine.getStatistics().m_nbCancels, 1u);
+}
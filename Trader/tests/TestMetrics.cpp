@@ -0,0 +1,90 @@
+#include "Trader/tests/TestBase.hpp"
+#include "Trader/Generic/Metrics/Metrics.hpp"
+
+class MetricsTest : public Trader::TestBase
+{
+};
+
+// ---- testText --------------------------------------------------------------
+
+TEST_F(MetricsTest, testText)
+{
+	Trader::Metrics metrics;
+	Trader::Metrics::Counter counter1;
+	Trader::Metrics::Counter counter2;
+	Trader::Metrics::Gauge gauge;
+
+	const auto registration1 = metrics.add("b_total", "Counter", {{"id", "x\"y"}}, counter1);
+	const auto registration2 = metrics.add("a", "Gauge", {}, gauge);
+	const auto registration3 = metrics.add("b_total", "Counter", {{"id", "z"}, {"type", "t"}}, counter2);
+	const auto registration4 = metrics.add("c", "Computed", {}, []() { return 0.25; });
+
+	counter1.inc();
+	counter2.inc(3);
+	gauge.add(5);
+	gauge.add(-7);
+
+	std::string text;
+	metrics.toText(text);
+	ASSERT_EQ(text,
+			"# HELP a Gauge\n"
+			"# TYPE a gauge\n"
+			"a -2\n"
+			"# HELP b_total Counter\n"
+			"# TYPE b_total counter\n"
+			"b_total{id=\"x\\\"y\"} 1\n"
+			"b_total{id=\"z\",type=\"t\"} 3\n"
+			"# HELP c Computed\n"
+			"# TYPE c gauge\n"
+			"c 0.25\n");
+}
+
+// ---- testSummary -----------------------------------------------------------
+
+TEST_F(MetricsTest, testSummary)
+{
+	Trader::Metrics metrics;
+	Trader::LatencyHistogram latency;
+	Trader::Metrics::Counter nbErrors;
+	const auto registration = metrics.add("latency_seconds", "Latency", {{"id", "0"}}, latency);
+
+	latency.record(2);
+	latency.record(4);
+	try
+	{
+		Trader::Metrics::Timer timer(latency, nbErrors);
+		throw IrStd::Exception();
+	}
+	catch (const IrStd::Exception&)
+	{
+	}
+	{
+		Trader::Metrics::Timer timer(latency, nbErrors);
+	}
+	ASSERT_EQ(latency.getCount(), 4u);
+	ASSERT_EQ(nbErrors.get(), 1u);
+
+	std::string text;
+	metrics.toText(text);
+	ASSERT_NE(text.find("# TYPE latency_seconds summary\n"), std::string::npos);
+	ASSERT_NE(text.find("latency_seconds{id=\"0\",quantile=\"0.99\"} "), std::string::npos);
+	ASSERT_NE(text.find("latency_seconds_count{id=\"0\"} 4\n"), std::string::npos);
+}
+
+// ---- testRegistration ------------------------------------------------------
+
+TEST_F(MetricsTest, testRegistration)
+{
+	Trader::Metrics metrics;
+	Trader::Metrics::Counter counter;
+	std::string text;
+	{
+		auto registration = metrics.add("a", "Counter", {}, counter);
+		Trader::Metrics::Registration moved(std::move(registration));
+		metrics.toText(text);
+		ASSERT_FALSE(text.empty());
+	}
+	text.clear();
+	metrics.toText(text);
+	ASSERT_EQ(text, "");
+}
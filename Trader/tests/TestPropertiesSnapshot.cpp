@@ -0,0 +1,81 @@
+#include "Trader/tests/TestBase.hpp"
+#include "Trader/Exchange/Transaction/PropertiesSnapshot.hpp"
+
+class PropertiesSnapshotTest : public Trader::TestBase
+{
+public:
+	void SetUp()
+	{
+		Trader::TestBase::SetUp();
+		m_path = createTemporaryDirectory("properties") + "/properties.bin";
+	}
+
+	static void createMap(Trader::PairTransactionMap& map)
+	{
+		{
+			Trader::PairTransactionImpl transaction(Trader::Currency::EUR, Trader::Currency::USD);
+			transaction.setFeePercent(0.2);
+			transaction.setDecimalPlace(5);
+			transaction.setOrderDecimalPlace(3);
+			map.registerPair<Trader::PairTransactionImpl>(transaction);
+		}
+		{
+			Trader::PairTransactionImpl transaction(Trader::Currency::BTC, Trader::Currency::EUR);
+			transaction.setFeeFixed(0.001);
+			Trader::Boundaries boundaries;
+			boundaries.setInitialAmount(0.01, 100);
+			transaction.setBoundaries(boundaries);
+			map.registerPair<Trader::PairTransactionImpl>(transaction);
+			auto pInvertTransaction = map.registerInvertPair<Trader::InvertPairTransactionImpl>(transaction);
+			pInvertTransaction->setDecimalPlace(2);
+		}
+	}
+
+protected:
+	std::string m_path;
+};
+
+// ---- testSaveLoad ----------------------------------------------------------
+
+TEST_F(PropertiesSnapshotTest, testSaveLoad)
+{
+	Trader::PairTransactionMap map;
+	createMap(map);
+	Trader::PropertiesSnapshot::save(m_path, Trader::Id("test"), map, "state");
+
+	Trader::PairTransactionMap loadedMap;
+	std::string state;
+	ASSERT_TRUE(Trader::PropertiesSnapshot::load(m_path, Trader::Id("test"), loadedMap, state));
+	ASSERT_TRUE(map == loadedMap);
+	ASSERT_EQ(state, "state");
+
+	// The inverted pair and the boundaries are restored
+	const auto pInvertTransaction = loadedMap.getTransaction(Trader::Currency::EUR, Trader::Currency::BTC);
+	ASSERT_TRUE(pInvertTransaction != nullptr);
+	ASSERT_TRUE(pInvertTransaction->isInvertedTransaction());
+	ASSERT_EQ(pInvertTransaction->getDecimalPlace(), 2u);
+	const auto pTransaction = loadedMap.getTransaction(Trader::Currency::BTC, Trader::Currency::EUR);
+	ASSERT_TRUE(pTransaction->getBoundaries().checkInitialAmount(50.));
+	ASSERT_FALSE(pTransaction->getBoundaries().checkInitialAmount(200.));
+}
+
+// ---- testInvalid -----------------------------------------------------------
+
+TEST_F(PropertiesSnapshotTest, testInvalid)
+{
+	Trader::PairTransactionMap map;
+	std::string state("untouched");
+
+	// No snapshot
+	ASSERT_FALSE(Trader::PropertiesSnapshot::load(m_path, Trader::Id("test"), map, state));
+
+	// Snapshot of another exchange
+	{
+		Trader::PairTransactionMap savedMap;
+		createMap(savedMap);
+		Trader::PropertiesSnapshot::save(m_path, Trader::Id("other"), savedMap, "state");
+	}
+	ASSERT_FALSE(Trader::PropertiesSnapshot::load(m_path, Trader::Id("test"), map, state));
+	ASSERT_TRUE(map == Trader::PairTransactionMap());
+	ASSERT_EQ(state, "untouched");
+}
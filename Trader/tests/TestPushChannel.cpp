@@ -0,0 +1,86 @@
+#include <limits>
+
+#include "Trader/tests/TestBase.hpp"
+#include "Trader/Server/PushChannel.hpp"
+
+class PushChannelTest : public Trader::TestBase
+{
+};
+
+// ---- testPoll --------------------------------------------------------------
+
+TEST_F(PushChannelTest, testPoll)
+{
+	Trader::PushChannel channel;
+	ASSERT_EQ(channel.poll(0, {"rates"}), "{\"cursor\":0,\"reset\":false,\"topics\":{}}");
+
+	channel.publish("rates", {{"BTC/USD", "1"}, {"ETH/USD", "2"}});
+	channel.publish("balance", {{"USD", "10"}});
+	ASSERT_EQ(channel.getSequence(), 2u);
+	ASSERT_EQ(channel.poll(0, {"rates"}), "{\"cursor\":2,\"reset\":false,\"topics\":"
+			"{\"rates\":{\"BTC/USD\":1,\"ETH/USD\":2}}}");
+	ASSERT_EQ(channel.poll(1, {"rates", "balance"}), "{\"cursor\":2,\"reset\":false,\"topics\":"
+			"{\"balance\":{\"USD\":10}}}");
+	ASSERT_EQ(channel.poll(2, {"rates", "balance"}), "{\"cursor\":2,\"reset\":false,\"topics\":{}}");
+
+	// Tells when a poll would be held
+	ASSERT_TRUE(channel.isModified(0, {"rates"}));
+	ASSERT_FALSE(channel.isModified(1, {"rates"}));
+	ASSERT_TRUE(channel.isModified(1, {"rates", "balance"}));
+	ASSERT_FALSE(channel.isModified(2, {"rates", "balance", "unknown"}));
+}
+
+// ---- testDelta -------------------------------------------------------------
+
+TEST_F(PushChannelTest, testDelta)
+{
+	Trader::PushChannel channel;
+	channel.publish("rates", {{"BTC/USD", "1"}, {"ETH/USD", "2"}});
+
+	// Publishing the same content does not create a new sequence
+	channel.publish("rates", {{"BTC/USD", "1"}, {"ETH/USD", "2"}});
+	ASSERT_EQ(channel.getSequence(), 1u);
+
+	// Only modified and deleted entries are sent
+	channel.publish("rates", {{"BTC/USD", "3"}, {"LTC/USD", "4"}});
+	ASSERT_EQ(channel.poll(1, {"rates"}), "{\"cursor\":2,\"reset\":false,\"topics\":"
+			"{\"rates\":{\"BTC/USD\":3,\"ETH/USD\":null,\"LTC/USD\":4}}}");
+
+	// Intermediate values are coalesced
+	channel.publish("rates", {{"BTC/USD", "5"}, {"LTC/USD", "4"}});
+	channel.publish("rates", {{"BTC/USD", "6"}, {"LTC/USD", "4"}});
+	ASSERT_EQ(channel.poll(2, {"rates"}), "{\"cursor\":4,\"reset\":false,\"topics\":"
+			"{\"rates\":{\"BTC/USD\":6}}}");
+}
+
+// ---- testReset -------------------------------------------------------------
+
+TEST_F(PushChannelTest, testReset)
+{
+	Trader::PushChannel channel;
+	channel.publish("rates", {{"BTC/USD", "1"}, {"ETH/USD", "2"}});
+	channel.publish("rates", {{"BTC/USD", "1"}});
+
+	// A cursor from the future means the server restarted
+	ASSERT_EQ(channel.poll(10, {"rates"}), "{\"cursor\":2,\"reset\":true,\"topics\":"
+			"{\"rates\":{\"BTC/USD\":1}}}");
+	ASSERT_TRUE(channel.isModified(10, {"rates"}));
+
+	// Deleted entries are forgotten after a while
+	for (uint64_t i = 0; i < Trader::PushChannel::DELETED_HISTORY + 1; ++i)
+	{
+		channel.publish("rates", {{"BTC/USD", std::to_string(i)}});
+	}
+	ASSERT_NE(channel.poll(1, {"rates"}).find("\"reset\":true"), std::string::npos);
+	ASSERT_NE(channel.poll(channel.getSequence() - 1, {"rates"}).find("\"reset\":false"), std::string::npos);
+}
+
+// ---- testJson --------------------------------------------------------------
+
+TEST_F(PushChannelTest, testJson)
+{
+	ASSERT_EQ(Trader::PushChannel::toJson("a\"b\\c\n"), "\"a\\\"b\\\\c\\n\"");
+	ASSERT_EQ(Trader::PushChannel::toJson(std::string("\x01", 1)), "\"\\u0001\"");
+	ASSERT_EQ(Trader::PushChannel::toJson(0.5), "0.5");
+	ASSERT_EQ(Trader::PushChannel::toJson(std::numeric_limits<double>::infinity()), "null");
+}
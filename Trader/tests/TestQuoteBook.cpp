@@ -0,0 +1,137 @@
+#include "Trader/tests/TestBase.hpp"
+#include "Trader/Manager/QuoteBook.hpp"
+
+class QuoteBookTest : public Trader::TestBase
+{
+public:
+	static void createMap(Trader::PairTransactionMap& map)
+	{
+		map.registerPair<Trader::PairTransactionImpl>(Trader::PairTransactionImpl(Trader::Currency::EUR, Trader::Currency::USD));
+		map.registerPair<Trader::PairTransactionImpl>(Trader::PairTransactionImpl(Trader::Currency::USD, Trader::Currency::EUR));
+	}
+
+	static void setRate(Trader::PairTransactionMap& map, const Trader::CurrencyPtr initialCurrency,
+			const Trader::CurrencyPtr finalCurrency, const double rate, const Trader::Clock& clock)
+	{
+		map.getTransactionForWrite(initialCurrency, finalCurrency)->setRate(rate, clock.now());
+	}
+};
+
+// ---- testBest --------------------------------------------------------------
+
+TEST_F(QuoteBookTest, testBest)
+{
+	auto pClock = std::make_shared<Trader::VirtualClock>(IrStd::Type::Timestamp(100000));
+	Trader::QuoteBook book;
+	book.setClock(pClock);
+
+	Trader::PairTransactionMap map0;
+	createMap(map0);
+	setRate(map0, Trader::Currency::EUR, Trader::Currency::USD, 1.10, *pClock);
+	setRate(map0, Trader::Currency::USD, Trader::Currency::EUR, 0.90, *pClock);
+	Trader::PairTransactionMap map1;
+	createMap(map1);
+	setRate(map1, Trader::Currency::EUR, Trader::Currency::USD, 1.12, *pClock);
+	setRate(map1, Trader::Currency::USD, Trader::Currency::EUR, 0.89, *pClock);
+
+	Trader::QuoteBook::Quote quote{IrStd::Type::Decimal(0.), 0, IrStd::Type::Timestamp(0)};
+	ASSERT_FALSE(book.getBestBid(Trader::Currency::EUR, Trader::Currency::USD, quote));
+
+	book.update(0, map0);
+	ASSERT_TRUE(book.getBestBid(Trader::Currency::EUR, Trader::Currency::USD, quote));
+	ASSERT_EQ(static_cast<double>(quote.m_rate), 1.10);
+	ASSERT_EQ(quote.m_exchangeIndex, 0u);
+
+	book.update(1, map1);
+	ASSERT_TRUE(book.getBestBid(Trader::Currency::EUR, Trader::Currency::USD, quote));
+	ASSERT_EQ(static_cast<double>(quote.m_rate), 1.12);
+	ASSERT_EQ(quote.m_exchangeIndex, 1u);
+
+	// The lowest price asked comes from the highest rate of the inverted pair
+	ASSERT_TRUE(book.getBestAsk(Trader::Currency::EUR, Trader::Currency::USD, quote));
+	ASSERT_NEAR(static_cast<double>(quote.m_rate), 1. / 0.90, 1e-12);
+	ASSERT_EQ(quote.m_exchangeIndex, 0u);
+
+	// Unknown pair
+	ASSERT_FALSE(book.getBest(Trader::Currency::BTC, Trader::Currency::EUR, quote));
+}
+
+// ---- testStale -------------------------------------------------------------
+
+TEST_F(QuoteBookTest, testStale)
+{
+	auto pClock = std::make_shared<Trader::VirtualClock>(IrStd::Type::Timestamp(100000));
+	Trader::QuoteBook book(/*maxAgeMs*/1000);
+	book.setClock(pClock);
+
+	Trader::PairTransactionMap map0;
+	createMap(map0);
+	setRate(map0, Trader::Currency::EUR, Trader::Currency::USD, 1.10, *pClock);
+	Trader::PairTransactionMap map1;
+	createMap(map1);
+	setRate(map1, Trader::Currency::EUR, Trader::Currency::USD, 1.12, *pClock);
+
+	book.update(0, map0);
+	book.update(1, map1);
+
+	Trader::QuoteBook::Quote quote{IrStd::Type::Decimal(0.), 0, IrStd::Type::Timestamp(0)};
+	ASSERT_TRUE(book.getBest(Trader::Currency::EUR, Trader::Currency::USD, quote));
+	ASSERT_EQ(quote.m_exchangeIndex, 1u);
+
+	// Only the first exchange receives new rates
+	pClock->advance(500);
+	setRate(map0, Trader::Currency::EUR, Trader::Currency::USD, 1.11, *pClock);
+	book.update(0, map0);
+	ASSERT_TRUE(book.getBest(Trader::Currency::EUR, Trader::Currency::USD, quote));
+	ASSERT_EQ(quote.m_exchangeIndex, 1u);
+
+	// The best quote is stale, it is not returned even before the next update
+	pClock->advance(600);
+	ASSERT_FALSE(book.getBest(Trader::Currency::EUR, Trader::Currency::USD, quote));
+
+	// It is then replaced by the quote of the other exchange
+	book.update(1, map1);
+	ASSERT_TRUE(book.getBest(Trader::Currency::EUR, Trader::Currency::USD, quote));
+	ASSERT_EQ(static_cast<double>(quote.m_rate), 1.11);
+	ASSERT_EQ(quote.m_exchangeIndex, 0u);
+
+	// All quotes are stale
+	pClock->advance(1000);
+	book.update(0, map0);
+	ASSERT_FALSE(book.getBest(Trader::Currency::EUR, Trader::Currency::USD, quote));
+}
+
+// ---- testPartialUpdate -----------------------------------------------------
+
+TEST_F(QuoteBookTest, testPartialUpdate)
+{
+	auto pClock = std::make_shared<Trader::VirtualClock>(IrStd::Type::Timestamp(100000));
+	Trader::QuoteBook book(/*maxAgeMs*/1000);
+	book.setClock(pClock);
+
+	Trader::PairTransactionMap map0;
+	createMap(map0);
+	setRate(map0, Trader::Currency::EUR, Trader::Currency::USD, 1.10, *pClock);
+	setRate(map0, Trader::Currency::USD, Trader::Currency::EUR, 0.90, *pClock);
+	Trader::PairTransactionMap map1;
+	map1.registerPair<Trader::PairTransactionImpl>(Trader::PairTransactionImpl(Trader::Currency::BTC, Trader::Currency::EUR));
+	setRate(map1, Trader::Currency::BTC, Trader::Currency::EUR, 6000., *pClock);
+
+	book.update(0, map0);
+	book.update(1, map1);
+
+	// Each exchange only provides the pairs it trades
+	Trader::QuoteBook::Quote quote{IrStd::Type::Decimal(0.), 0, IrStd::Type::Timestamp(0)};
+	ASSERT_TRUE(book.getBest(Trader::Currency::EUR, Trader::Currency::USD, quote));
+	ASSERT_EQ(quote.m_exchangeIndex, 0u);
+	ASSERT_TRUE(book.getBest(Trader::Currency::BTC, Trader::Currency::EUR, quote));
+	ASSERT_EQ(quote.m_exchangeIndex, 1u);
+
+	// The quotes of the first exchange become stale while the second one keeps updating
+	pClock->advance(1500);
+	setRate(map1, Trader::Currency::BTC, Trader::Currency::EUR, 6100., *pClock);
+	book.update(1, map1);
+	ASSERT_FALSE(book.getBest(Trader::Currency::EUR, Trader::Currency::USD, quote));
+	ASSERT_TRUE(book.getBest(Trader::Currency::BTC, Trader::Currency::EUR, quote));
+	ASSERT_EQ(static_cast<double>(quote.m_rate), 6100.);
+}
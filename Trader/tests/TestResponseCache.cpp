@@ -0,0 +1,66 @@
+#include "Trader/tests/TestBase.hpp"
+#include "Trader/Server/ResponseCache.hpp"
+
+class ResponseCacheTest : public Trader::TestBase
+{
+};
+
+// ---- testVersion -----------------------------------------------------------
+
+TEST_F(ResponseCacheTest, testVersion)
+{
+	ASSERT_EQ(Trader::ResponseCache::makeVersion({}), "");
+	ASSERT_EQ(Trader::ResponseCache::makeVersion({255}), "ff");
+	ASSERT_EQ(Trader::ResponseCache::makeVersion({1, 0, 16}), "1-0-10");
+}
+
+// ---- testCache -------------------------------------------------------------
+
+TEST_F(ResponseCacheTest, testCache)
+{
+	Trader::ResponseCache cache;
+	size_t value = 1;
+	const auto build = [&](Trader::JsonWriter& json) {
+		json.beginObject().member("value", static_cast<uint64_t>(value)).endObject();
+	};
+
+	const auto pEntry1 = cache.get("a", "1", build);
+	ASSERT_EQ(pEntry1->m_body, "{\"value\":1}");
+	ASSERT_EQ(pEntry1->m_etag, "\"1\"");
+	ASSERT_TRUE(pEntry1->m_bodyGzip.empty());
+	ASSERT_EQ(cache.getNbBuilds(), 1u);
+
+	// Same version, the data is not built again even if it changed
+	value = 2;
+	const auto pEntry2 = cache.get("a", "1", build);
+	ASSERT_EQ(pEntry2, pEntry1);
+	ASSERT_EQ(cache.getNbBuilds(), 1u);
+
+	// New version
+	const auto pEntry3 = cache.get("a", "2", build);
+	ASSERT_EQ(pEntry3->m_body, "{\"value\":2}");
+	ASSERT_EQ(cache.getNbBuilds(), 2u);
+
+	// Keys are independent
+	cache.get("b", "2", build);
+	ASSERT_EQ(cache.getNbBuilds(), 3u);
+	cache.get("a", "2", build);
+	ASSERT_EQ(cache.getNbBuilds(), 3u);
+}
+
+// ---- testGzip --------------------------------------------------------------
+
+TEST_F(ResponseCacheTest, testGzip)
+{
+	Trader::ResponseCache cache;
+	const auto pEntry = cache.get("list", "1", [](Trader::JsonWriter& json) {
+		json.beginArray();
+		for (uint64_t i = 0; i < 1000; ++i)
+		{
+			json.value(i);
+		}
+		json.endArray();
+	});
+	ASSERT_FALSE(pEntry->m_bodyGzip.empty());
+	ASSERT_LT(pEntry->m_bodyGzip.size(), pEntry->m_body.size());
+}
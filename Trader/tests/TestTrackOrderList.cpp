@@ -387,3 +387,112 @@ TEST_F(TrackOrderListTest, testCompleteOrder)
 		ASSERT_TRUE(completeAmount == 30);
 	}
 }
+
+// ---- testReserveLedger -----------------------------------------------------
+
+TEST_F(TrackOrderListTest, testReserveLedger)
+{
+	Trader::TrackOrder order{Trader::Id{"test-0"}, getTransactionUSDEUR(), 0.5, 100};
+
+	m_trackOrderList.updateBalance(createBalance({
+			{Trader::Currency::USD, 100},
+			{Trader::Currency::EUR, 0}}));
+
+	// Add orders
+	{
+		m_trackOrderList.add(Trader::TrackOrder{Trader::Id{"test-1"}, getTransactionUSDEUR(), 0.5, 10});
+		m_trackOrderList.add(Trader::TrackOrder{Trader::Id{"test-2"}, getTransactionEURUSD(), 2, 5});
+		ASSERT_TRUE(m_trackOrderList.getReserve(Trader::Currency::USD) == 10);
+		ASSERT_TRUE(m_trackOrderList.getReserve(Trader::Currency::EUR) == 5);
+		ASSERT_TRUE(m_trackOrderList.getReserve(Trader::Currency::BTC) == 0);
+	}
+
+	// Start from fresh
+	{
+		m_trackOrderList.initialize(/*keepOrders*/false);
+		ASSERT_TRUE(m_trackOrderList.getReserve(Trader::Currency::USD) == 0);
+		ASSERT_TRUE(m_trackOrderList.getReserve(Trader::Currency::EUR) == 0);
+	}
+
+	// Order from the server
+	{
+		m_trackOrderList.update({order});
+		ASSERT_TRUE(m_trackOrderList.getReserve(Trader::Currency::USD) == 100);
+	}
+
+	// Partial complete
+	{
+		order.setAmount(30);
+		m_trackOrderList.update({order});
+		ASSERT_TRUE(m_trackOrderList.getReserve(Trader::Currency::USD) == 30);
+	}
+
+	// Full complete
+	{
+		m_trackOrderList.updateBalance(createBalance({
+				{Trader::Currency::USD, 0},
+				{Trader::Currency::EUR, 50}}));
+		m_trackOrderList.update({});
+		ASSERT_TRUE(m_trackOrderList.getReserve(Trader::Currency::USD) == 0);
+
+		size_t nbCurrencies = 0;
+		m_trackOrderList.eachReserve([&](const Trader::CurrencyPtr, const IrStd::Type::Decimal) {
+			nbCurrencies++;
+		});
+		ASSERT_TRUE(nbCurrencies == 0);
+	}
+}
+
+// ---- testJournalRestore ----------------------------------------------------
+
+TEST_F(TrackOrderListTest, testJournalRestore)
+{
+	const std::string path = createTemporaryDirectory("trackorder") + "/journal.bin";
+
+	const auto getTransaction = [&](const Trader::CurrencyPtr initialCurrency, const Trader::CurrencyPtr finalCurrency) {
+		std::shared_ptr<Trader::Transaction> pTransaction;
+		for (const auto& pCandidate : {getTransactionUSDEUR(), getTransactionEURBTC(), getTransactionEURUSD()})
+		{
+			if (pCandidate->getInitialCurrency() == initialCurrency && pCandidate->getFinalCurrency() == finalCurrency)
+			{
+				pTransaction = pCandidate;
+			}
+		}
+		return pTransaction;
+	};
+
+	Trader::Order chainedOrder{getTransactionUSDEUR(), 0.5};
+	chainedOrder.addNext(Trader::Order{getTransactionEURBTC()});
+
+	// Record the orders
+	{
+		auto pJournal = std::make_shared<Trader::Journal>(path);
+		ASSERT_EQ(m_trackOrderList.restore(pJournal, getTransaction).size(), 0u);
+
+		m_trackOrderList.add(Trader::TrackOrder{Trader::Id{"test-1"}, chainedOrder, 10});
+		m_trackOrderList.add(Trader::TrackOrder{Trader::Id{"test-2"}, getTransactionEURUSD(), 2, 5});
+		m_trackOrderList.add(Trader::TrackOrder{Trader::Id{"test-3"}, getTransactionEURUSD(), 2, 5});
+		m_trackOrderList.match(Trader::Id{"test-1"}, {Trader::Id{"server-1"}});
+		m_trackOrderList.update({Trader::TrackOrder{Trader::Id{"server-1"}, getTransactionUSDEUR(), 0.5, 10}});
+		m_trackOrderList.remove(Trader::TrackOrderList::RemoveCause::CANCEL, Trader::Id{"test-3"}, "test");
+		pJournal->sync();
+		m_trackOrderList.setJournal(nullptr);
+	}
+
+	// Restart from fresh
+	m_trackOrderList.initialize(/*keepOrders*/false);
+	ASSERT_EQ(getNumberOrders(), 0u);
+
+	{
+		auto pJournal = std::make_shared<Trader::Journal>(path);
+		const auto restoredList = m_trackOrderList.restore(pJournal, getTransaction);
+		ASSERT_EQ(restoredList.size(), 3u);
+		m_trackOrderList.setJournal(nullptr);
+	}
+
+	ASSERT_EQ(checkOrder(Trader::TrackOrder{Trader::Id{"server-1"}, chainedOrder, 10}, IS_MATCHED | IGNORE_CONTEXT), 1u);
+	ASSERT_EQ(checkOrder(Trader::TrackOrder{Trader::Id{"test-2"}, getTransactionEURUSD(), 2, 5}, IS_PLACEHOLDER), 1u);
+	ASSERT_EQ(checkOrder(Trader::TrackOrder{Trader::Id{"test-3"}, getTransactionEURUSD(), 2, 5}, IS_CANCEL), 1u);
+	ASSERT_TRUE(m_trackOrderList.getReserve(Trader::Currency::USD) == 10);
+	ASSERT_TRUE(m_trackOrderList.getReserve(Trader::Currency::EUR) == 10);
+}
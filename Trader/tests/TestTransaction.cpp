@@ -1,4 +1,8 @@
+#include <limits>
+#include <thread>
+
 #include "Trader/tests/TestBase.hpp"
+#include "Trader/Generic/Event/CountDown.hpp"
 
 class TransactionTest : public Trader::TestBase
 {
@@ -105,3 +109,62 @@ TEST_F(TransactionTest, testComparison)
 		ASSERT_TRUE(*pPairTransaction1 == *pPairTransaction2);
 	}
 }
+
+// ---- testFirstRateCountDown ------------------------------------------------
+
+TEST_F(TransactionTest, testFirstRateCountDown)
+{
+	auto pTransaction1 = createPairTransaction(Trader::Currency::EUR, Trader::Currency::USD);
+	auto pTransaction2 = createPairTransaction(Trader::Currency::BTC, Trader::Currency::USD);
+	pTransaction2->setRate(1000.);
+
+	Trader::CountDown countDown;
+	countDown.reset(2);
+	pTransaction1->setFirstRateCountDown(&countDown);
+	// Already has a rate
+	pTransaction2->setFirstRateCountDown(&countDown);
+	ASSERT_EQ(countDown.getCount(), 1u);
+	ASSERT_FALSE(countDown.wait(/*timeoutMs*/1));
+
+	std::thread thread([&]() {
+		pTransaction1->setRate(1.);
+		pTransaction1->setRate(2.);
+	});
+	ASSERT_TRUE(countDown.wait(/*timeoutMs*/10000));
+	thread.join();
+	ASSERT_EQ(countDown.getCount(), 0u);
+
+	// Only the first rate signals
+	countDown.reset(1);
+	pTransaction1->setRate(3.);
+	ASSERT_EQ(countDown.getCount(), 1u);
+}
+
+// ---- testBoundaries --------------------------------------------------------
+
+TEST_F(TransactionTest, testBoundaries)
+{
+	Trader::Boundaries boundaries;
+	boundaries.setInitialAmount(0.01, 100);
+	boundaries.setRate(0.5);
+
+	ASSERT_TRUE(boundaries.checkInitialAmount(0.01));
+	ASSERT_TRUE(boundaries.checkInitialAmount(100.));
+	ASSERT_FALSE(boundaries.checkInitialAmount(0.0099));
+	ASSERT_FALSE(boundaries.checkInitialAmount(100.01));
+	ASSERT_FALSE(boundaries.checkInitialAmount(-1.));
+	ASSERT_FALSE(boundaries.checkInitialAmount(std::numeric_limits<double>::infinity()));
+
+	// Numbers rounded for an order are compared as integers, whatever their scale
+	ASSERT_TRUE(boundaries.checkInitialAmount(Trader::FixedPoint::fromMantissa(1, 2)));
+	ASSERT_FALSE(boundaries.checkInitialAmount(Trader::FixedPoint::fromMantissa(9, 3)));
+	ASSERT_TRUE(boundaries.checkInitialAmount(Trader::FixedPoint::fromMantissa(100000, 3)));
+	ASSERT_FALSE(boundaries.checkInitialAmount(Trader::FixedPoint::fromMantissa(10001, 2)));
+	ASSERT_TRUE(boundaries.checkRate(Trader::FixedPoint::fromMantissa(5, 1)));
+	ASSERT_FALSE(boundaries.checkRate(Trader::FixedPoint::fromMantissa(4999, 4)));
+
+	// The inverted rate boundaries are the inverse of the original ones
+	const auto invert = boundaries.getInvert();
+	ASSERT_TRUE(invert.checkRate(2.));
+	ASSERT_FALSE(invert.checkRate(2.01));
+}
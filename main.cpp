@@ -17,6 +17,8 @@ int mainIrStd()
 {
 #if defined(TRADER_HTTP_PORT) && defined(TRADER_REGISTER_TASKS)
 	IrStd::Logger::getDefault().addTopic(IRSTD_TOPIC(Trader), IrStd::Logger::Level::Info);
+	// Calibrate the clock of the latency measurements and timeouts before the hot paths need it
+	Trader::FastClock::getInstance();
 	{
 		Trader::Manager trader(TRADER_HTTP_PORT);
 		TRADER_REGISTER_TASKS(trader);
@@ -7,6 +7,12 @@ function Trader(view) {
 Trader.selectedView = {};
 Trader.monitorList = [];
 
+/**
+ * The push endpoint is served on the port of the page + this offset
+ */
+Trader.pushPortOffset = 2;
+Trader.push = {cursor: 0, topics: "", state: {}};
+
 /**
  * Add a pair to be monitored
  */
@@ -38,8 +44,105 @@ Trader.prototype.initialize = function () {
 	this.repeat(1, function(counterS) {
 		return this.stateMachine(counterS);
 	}, 0);
+	this.pushLoop();
 }
 
+/**
+ * Topics pushed by the server for the current view
+ */
+Trader.prototype.getPushTopics = function () {
+	switch (Trader.selectedView.type) {
+	case "dashboard":
+		return ["traces"];
+	case "exchange":
+		var index = Trader.selectedView.index;
+		return [index + ".rates", index + ".balance", index + ".orders"];
+	}
+	return [];
+};
+
+/**
+ * Long-poll the push endpoint, the server holds the request until the
+ * subscribed topics change
+ */
+Trader.prototype.pushLoop = function () {
+	var obj = this;
+	var topics = this.getPushTopics().join(",");
+
+	// Start over when the subscription changes
+	if (topics != Trader.push.topics) {
+		Trader.push = {cursor: 0, topics: topics, state: {}};
+	}
+	if (!topics) {
+		setTimeout(function() {
+			obj.pushLoop();
+		}, 1000);
+		return;
+	}
+
+	var port = Number(location.port || ((location.protocol == "https:") ? 443 : 80)) + Trader.pushPortOffset;
+	var endpoint = location.protocol + "//" + location.hostname + ":" + port
+			+ "/api/v1/push/" + Trader.push.cursor + "/" + topics;
+	$.getJSON(endpoint, function(data) {
+		// Ignore the response of a previous subscription
+		if (topics == Trader.push.topics) {
+			obj.applyPush(data);
+		}
+		obj.pushLoop();
+	}).fail(function() {
+		setTimeout(function() {
+			obj.pushLoop();
+		}, 1000);
+	});
+};
+
+/**
+ * Merge the changes received into the local copy of the topics and update the view
+ */
+Trader.prototype.applyPush = function (data) {
+	if (data.reset) {
+		Trader.push.state = {};
+	}
+	Trader.push.cursor = data.cursor;
+
+	for (var topic in data.topics) {
+		var values = Trader.push.state[topic] || {};
+		for (var key in data.topics[topic]) {
+			if (data.topics[topic][key] === null) {
+				delete values[key];
+			}
+			else {
+				values[key] = data.topics[topic][key];
+			}
+		}
+		Trader.push.state[topic] = values;
+
+		var list = [];
+		for (var key in values) {
+			list.push(values[key]);
+		}
+
+		switch (topic.substr(topic.indexOf(".") + 1)) {
+		case "traces":
+			list.sort(function(a, b) {
+				return b.timestamp - a.timestamp;
+			});
+			this.updateTraces(list);
+			break;
+		case "rates":
+			this.view.updateTransactionsList(list);
+			break;
+		case "balance":
+			// The view consumes its argument
+			this.view.updateBalance($.extend(true, {}, values));
+			break;
+		case "orders":
+			this.view.updateActiveOrderList(list);
+			break;
+		}
+	}
+};
+
 /**
  * Main function, running every seconds
  */
@@ -84,9 +187,8 @@ Trader.prototype.stateMachine = function (counterSeconds) {
 				}
 			}
 
-			// Every 10 seconds
+			// Every 10 seconds, the traces are pushed
 			if ((counterSeconds % 10) == 0) {
-				this.updateTraces();
 				this.updateThreads();
 			}
 		};
@@ -94,20 +196,14 @@ Trader.prototype.stateMachine = function (counterSeconds) {
 	case "exchange":
 		var index = Trader.selectedView.index;
 		commonTasks = function (counterSeconds) {
-			// First set the transaction list and then update it
+			// Set the transaction list, the rates, balance and active orders are pushed
 			if (counterSeconds == 0) {
 				this.updateTransactionsList(index);
 			}
-			else {
-				this.updateTickerList(index);
-			}
 
-			// Only needs to be updated every 5 seconds
+			// Only needs to be updated every 5 seconds, in a single request
 			if ((counterSeconds % 5) == 0) {
-				this.updateActiveOrderList(index);
-				this.updateOrderList(index);
-				this.updateBalance(index);
-				this.updateInitialBalance(index);
+				this.updateExchangeSnapshot(index);
 			}
 
 			// Also monitor the pairMonitor
@@ -159,26 +255,24 @@ Trader.prototype.updateManager = function () {
 	});
 };
 
-Trader.prototype.updateTraces = function () {
-	this.get("api/v1/manager/traces", function (data) {
-		var traces = {warnings: {timestamp: 0, list: []}, errors: {timestamp: 0, list: []}};
-		for (var i in data.list) {
-			var type = data.list[i].level;
-			if (type == "w") {
-				if (traces.warnings.timestamp == 0) {
-					traces.warnings.timestamp = data.list[i].timestamp;
-				}
-				traces.warnings.list.push(data.list[i]);
+Trader.prototype.updateTraces = function (list) {
+	var traces = {warnings: {timestamp: 0, list: []}, errors: {timestamp: 0, list: []}};
+	for (var i in list) {
+		var type = list[i].level;
+		if (type == "w") {
+			if (traces.warnings.timestamp == 0) {
+				traces.warnings.timestamp = list[i].timestamp;
 			}
-			else {
-				if (traces.errors.timestamp == 0) {
-					traces.errors.timestamp = data.list[i].timestamp;
-				}
-				traces.errors.list.push(data.list[i]);
+			traces.warnings.list.push(list[i]);
+		}
+		else {
+			if (traces.errors.timestamp == 0) {
+				traces.errors.timestamp = list[i].timestamp;
 			}
+			traces.errors.list.push(list[i]);
 		}
-		this.view.updateTraces(traces);
-	});
+	}
+	this.view.updateTraces(traces);
 };
 
 Trader.prototype.updateThreads = function () {
@@ -193,6 +287,18 @@ Trader.prototype.updateThreads = function () {
 	});
 };
 
+Trader.prototype.updateExchangeSnapshot = function (exchangeId) {
+	this.get("api/v1/snapshot/" + exchangeId + "/orders,initialBalance", function (data) {
+		var exchange = (data.exchanges) ? data.exchanges[0] : undefined;
+		if (exchange) {
+			if (exchange.orders.list) {
+				this.view.updateOrderList(exchange.orders.list);
+			}
+			this.view.updateInitialBalance(exchange.initialBalance);
+		}
+	});
+};
+
 Trader.prototype.updateActiveOrderList = function (exchangeId) {
 	this.get("api/v1/exchange/" + exchangeId + "/orders/active", function (data) {
 		if (data.list) {
@@ -188,6 +188,11 @@ App.prototype.createRouter = function() {
 		template: '<div v-if="isValid">'
 				+ '<h1>{{ strategy.getName() }}</h1>'
 				+ '<metric :text="\'Processing Time\'" :value="strategy.getProcessTimePercent().toFixed(1)" :unit="\'%\'"></metric>'
+				+ '<h2>Latency</h2>'
+				+ '<div v-for="type in [\'process\', \'trigger\']">'
+					+ '<metric v-for="(value, percentile) in strategy.getLatency(type)" :text="type + \' \' + percentile" :value="(value / 1000).toFixed(1)" :unit="\'ms\'"></metric>'
+				+ '</div>'
+				+ '<metric :text="\'Missed Triggers\'" :value="strategy.getNbMissedTriggers()" :unit="\'Trigger(s)\'"></metric>'
 				+ '<h2>Configuration</h2>'
 				+ '<properties :propertiesList="strategy.configuration"></properties>'
 				+ '<div v-for="(profit, index) in strategy.getProfit()">'
@@ -60,6 +60,24 @@ Strategy.prototype.getProcessTimePercent = function () {
 	return (this.status) ? this.status.processTime : 0;
 }
 
+/**
+ * Latency statistics of the processing in microseconds,
+ * type is either "process" or "trigger"
+ */
+Strategy.prototype.getLatency = function (type) {
+	const status = this.status || {};
+	return {
+		p50: status[type + "LatencyP50"] || 0,
+		p90: status[type + "LatencyP90"] || 0,
+		p99: status[type + "LatencyP99"] || 0,
+		max: status[type + "LatencyMax"] || 0
+	};
+}
+
+Strategy.prototype.getNbMissedTriggers = function () {
+	return (this.status) ? (this.status.nbMissedTriggers || 0) : 0;
+}
+
 Strategy.prototype.updateStatus = function () {
 	return irAjaxJson("api/v1/strategy/" + this.id + "/status").success((data) => {
 		this.status = data;